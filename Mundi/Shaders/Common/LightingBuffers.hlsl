@@ -21,10 +21,10 @@ cbuffer LightBuffer : register(b8)
     uint SpotLightCount;
 };
 
-// --- 타일 기반 라이트 컬링 리소스 ---
-// t2: 타일별 라이트 인덱스 Structured Buffer
-// 구조:  [TileIndex * MaxLightsPerTile] = LightCount
-//        [TileIndex * MaxLightsPerTile + 1 ~ ...] = LightIndices (상위 16비트: 타입, 하위 16비트: 인덱스)
+// --- 클러스터 기반 라이트 컬링 리소스 ---
+// t2: 클러스터별 라이트 인덱스 Structured Buffer (TileLightCuller.h와 일치)
+// 구조:  [ClusterIndex * 2] = 인덱스 목록 시작 위치, [ClusterIndex * 2 + 1] = LightCount
+//        [ClusterCount * 2 ~ ...] = LightIndices (상위 16비트: 타입, 하위 16비트: 인덱스)
 StructuredBuffer<uint> g_TileLightIndices : register(t2);
 
 // PointLight, SpotLight Structured Buffer
@@ -40,7 +40,10 @@ cbuffer TileCullingBuffer : register(b11)
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint ViewportStartX;    // 뷰포트 시작 X 좌표
     uint ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint2 Padding;          // 16바이트 정렬을 위한 패딩
+    uint ClusterSliceCount; // 깊이 슬라이스 개수
+    float ClusterSliceScale; // Slice = floor(log2(ViewZ) * Scale + Bias)
+    float ClusterSliceBias;
+    float3 TileCullingPadding; // 16바이트 정렬을 위한 패딩
 };
 
 TextureCubeArray g_PointShadowMapArray : register(t10);
@@ -55,12 +55,20 @@ uint CalculateTileIndex(float4 screenPos, float viewportStartX, float viewportSt
     return tileY * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
-uint GetTileDataOffset(uint tileIndex)
+// 클러스터 인덱스 계산 (타일 + 뷰 공간 깊이의 지수 슬라이스)
+uint CalculateClusterIndex(float4 screenPos, float viewDepth, float viewportStartX, float viewportStartY)
 {
-    // MaxLightsPerTile = 256 (TileLightCuller.h와 일치)
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    uint tileIndex = CalculateTileIndex(screenPos, viewportStartX, viewportStartY);
+    int slice = (int)floor(log2(max(viewDepth, 1e-4f)) * ClusterSliceScale + ClusterSliceBias);
+    slice = clamp(slice, 0, (int)ClusterSliceCount - 1);
+
+    return (uint)slice * TileCountX * TileCountY + tileIndex;
+}
+
+// 클러스터의 라이트 목록 범위 (x: 인덱스 목록 시작 위치, y: 라이트 개수)
+uint2 GetClusterLightRange(uint clusterIndex)
+{
+    return uint2(g_TileLightIndices[clusterIndex * 2], g_TileLightIndices[clusterIndex * 2 + 1]);
 }
 
 //================================================================================================
@@ -879,13 +887,13 @@ float3 CalculateAllLights(
     // Point + Spot with 타일 컬링
     if (bUseTileCulling)
     {
-        uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint clusterIndex = CalculateClusterIndex(screenPos, viewPos.z, ViewportStartX, ViewportStartY);
+        uint2 lightRange = GetClusterLightRange(clusterIndex);
+        uint lightCount = lightRange.y;
 
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightRange.x + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;
             uint lightIdx = packedIndex & 0xFFFF;
 
@@ -17,6 +17,11 @@
 #define USE_CARTOON_SHADING 0
 #endif
 
+// 자동 인스턴싱: 월드 행렬/UUID를 상수 버퍼 대신 인스턴스 스트림(slot 1)에서 읽는다
+#ifndef USE_INSTANCING
+#define USE_INSTANCING 0
+#endif
+
 // --- Material 구조체 (OBJ 머티리얼 정보) ---
 // 주의: SPECULAR_COLOR 매크로에서 사용하므로 include 전에 정의 필요
 struct FMaterial
@@ -165,6 +170,17 @@ struct VS_INPUT
     uint4 BoneIndices : BLENDINDICES0;
     float4 BoneWeights : BLENDWEIGHT0;
 #endif        
+#if USE_INSTANCING
+    float4 InstanceWorld0 : INSTANCE_WORLD0;
+    float4 InstanceWorld1 : INSTANCE_WORLD1;
+    float4 InstanceWorld2 : INSTANCE_WORLD2;
+    float4 InstanceWorld3 : INSTANCE_WORLD3;
+    float4 InstanceInvWorld0 : INSTANCE_INVWORLD0;
+    float4 InstanceInvWorld1 : INSTANCE_INVWORLD1;
+    float4 InstanceInvWorld2 : INSTANCE_INVWORLD2;
+    float4 InstanceInvWorld3 : INSTANCE_INVWORLD3;
+    uint InstanceUUID : INSTANCE_UUID;
+#endif
 };
 
 struct PS_INPUT
@@ -175,6 +191,9 @@ struct PS_INPUT
     row_major float3x3 TBN : TBN;
     float4 Color : COLOR;
     float2 TexCoord : TEXCOORD0;
+#if USE_INSTANCING
+    nointerpolation uint InstanceUUID : INSTANCE_UUID;
+#endif
 };
 
 struct PS_OUTPUT
@@ -200,16 +219,26 @@ PS_INPUT mainVS(VS_INPUT Input)
     float3 ModelTangent = Input.Tangent.xyz;
 #endif
 
-    float4 WorldPos = mul(float4(ModelPosition, 1.0f), WorldMatrix);
+#if USE_INSTANCING
+    // 인스턴스 스트림의 행렬 (row_major 상수 버퍼와 같은 행 순서)
+    float4x4 ObjectWorld = float4x4(Input.InstanceWorld0, Input.InstanceWorld1, Input.InstanceWorld2, Input.InstanceWorld3);
+    float4x4 ObjectInvWorld = float4x4(Input.InstanceInvWorld0, Input.InstanceInvWorld1, Input.InstanceInvWorld2, Input.InstanceInvWorld3);
+    Out.InstanceUUID = Input.InstanceUUID;
+#else
+    float4x4 ObjectWorld = WorldMatrix;
+    float4x4 ObjectInvWorld = WorldInverseTranspose;
+#endif
+
+    float4 WorldPos = mul(float4(ModelPosition, 1.0f), ObjectWorld);
     Out.WorldPos = WorldPos.xyz;
 
     float4 ViewPos = mul(WorldPos, ViewMatrix);
     Out.Position = mul(ViewPos, ProjectionMatrix);
 
-    float3 WorldNormal = normalize(mul(ModelNormal, (float3x3)WorldInverseTranspose));
+    float3 WorldNormal = normalize(mul(ModelNormal, (float3x3)ObjectInvWorld));
     Out.Normal = WorldNormal;
 
-    float3 Tangent = normalize(mul(ModelTangent, (float3x3)WorldMatrix));
+    float3 Tangent = normalize(mul(ModelTangent, (float3x3)ObjectWorld));
     float3 BiTangent = normalize(cross(WorldNormal, Tangent) * Input.Tangent.w);
     row_major float3x3 TBN;
     TBN._m00_m01_m02 = Tangent;
@@ -296,7 +325,11 @@ PS_INPUT mainVS(VS_INPUT Input)
 PS_OUTPUT mainPS(PS_INPUT Input)
 {
     PS_OUTPUT Output;
+#if USE_INSTANCING
+    Output.UUID = Input.InstanceUUID;
+#else
     Output.UUID = UUID;
+#endif
     
     //CSM 구간 시각화
     float3 Color[2] =
@@ -456,18 +489,18 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 타일 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        // 현재 픽셀이 속한 클러스터 계산 (타일 + 깊이 슬라이스)
+        uint clusterIndex = CalculateClusterIndex(Input.Position, ViewPos.z, ViewportStartX, ViewportStartY);
+        uint2 lightRange = GetClusterLightRange(clusterIndex);
 
-        // 타일에 영향을 주는 라이트 개수
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        // 클러스터에 영향을 주는 라이트 개수
+        uint lightCount = lightRange.y;
 
-        // 타일 내 라이트만 순회
+        // 클러스터 내 라이트만 순회
         [loop]
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightRange.x + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
 
@@ -682,18 +715,18 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 타일 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        // 현재 픽셀이 속한 클러스터 계산 (타일 + 깊이 슬라이스)
+        uint clusterIndex = CalculateClusterIndex(Input.Position, ViewPos.z, ViewportStartX, ViewportStartY);
+        uint2 lightRange = GetClusterLightRange(clusterIndex);
 
-        // 타일에 영향을 주는 라이트 개수
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        // 클러스터에 영향을 주는 라이트 개수
+        uint lightCount = lightRange.y;
 
-        // 타일 내 라이트만 순회
+        // 클러스터 내 라이트만 순회
         [loop]
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightRange.x + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
 
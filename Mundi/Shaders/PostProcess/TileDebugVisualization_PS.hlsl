@@ -1,7 +1,7 @@
 //================================================================================================
 // Filename:      TileDebugVisualization_PS.hlsl
-// Description:   타일 기반 라이트 컬링 디버그 시각화 픽셀 셰이더
-//                각 타일의 라이트 개수를 히트맵으로 표시
+// Description:   클러스터 기반 라이트 컬링 디버그 시각화 픽셀 셰이더
+//                각 타일(깊이 슬라이스 중 최대)의 라이트 개수를 히트맵으로 표시
 //================================================================================================
 
 // b11: 타일 컬링 설정 상수 버퍼
@@ -13,16 +13,19 @@ cbuffer TileCullingBuffer : register(b11)
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint ViewportStartX;    // 뷰포트 시작 X 좌표
     uint ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint2 Padding;          // 16바이트 정렬을 위한 패딩
+    uint ClusterSliceCount; // 깊이 슬라이스 개수
+    float ClusterSliceScale; // Slice = floor(log2(ViewZ) * Scale + Bias)
+    float ClusterSliceBias;
+    float3 TileCullingPadding; // 16바이트 정렬을 위한 패딩
 };
 
 // t0: 원본 씬 텍스처
 Texture2D g_SceneTexture : register(t0);
 SamplerState g_SamplerLinear : register(s0);
 
-// t2: 타일별 라이트 인덱스 Structured Buffer
-// 구조: [TileIndex * MaxLightsPerTile] = LightCount
-//       [TileIndex * MaxLightsPerTile + 1 ~ ...] = LightIndices
+// t2: 클러스터별 라이트 인덱스 Structured Buffer
+// 구조: [ClusterIndex * 2] = 인덱스 목록 시작 위치, [ClusterIndex * 2 + 1] = LightCount
+//       [ClusterCount * 2 ~ ...] = LightIndices
 StructuredBuffer<uint> g_TileLightIndices : register(t2);
 
 // 타일 인덱스 계산
@@ -38,11 +41,19 @@ uint CalculateTileIndex(float2 screenPos)
     return tileY * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
-uint GetTileDataOffset(uint tileIndex)
+// 타일의 모든 깊이 슬라이스 중 최대 라이트 개수 (후처리 패스라 픽셀 깊이를 쓰지 않는다)
+uint GetMaxClusterLightCount(uint tileIndex)
 {
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    uint tileCount = TileCountX * TileCountY;
+    uint maxCount = 0;
+
+    [loop]
+    for (uint slice = 0; slice < ClusterSliceCount; slice++)
+    {
+        uint clusterIndex = slice * tileCount + tileIndex;
+        maxCount = max(maxCount, g_TileLightIndices[clusterIndex * 2 + 1]);
+    }
+    return maxCount;
 }
 
 // 라이트 개수를 색상으로 변환 (히트맵)
@@ -98,10 +109,9 @@ float4 mainPS(float4 Pos : SV_Position, float2 TexCoord : TEXCOORD0) : SV_Target
 
     // 현재 픽셀이 속한 타일 계산
     uint tileIndex = CalculateTileIndex(Pos.xy);
-    uint tileDataOffset = GetTileDataOffset(tileIndex);
 
-    // 타일의 라이트 개수
-    uint lightCount = g_TileLightIndices[tileDataOffset];
+    // 타일의 라이트 개수 (슬라이스 중 최대)
+    uint lightCount = GetMaxClusterLightCount(tileIndex);
 
     // 히트맵 색상 계산
     float3 heatmapColor = LightCountToHeatmap(lightCount);
@@ -0,0 +1,24 @@
+// 섀도우 아틀라스의 한 영역만 지우는 PS
+// - FullScreenTriangle_VS와 함께 뷰포트를 해당 영역에 맞춰 그린다
+// - 깊이는 SV_Depth로 1(가장 먼 값)을 기록하므로 AlwaysWrite 뎁스 상태가 필요하다
+// - VSM 모멘트 타겟이 바인딩되어 있으면 ClearRenderTargetView와 같은 (1, 1)을 기록한다
+
+struct PS_INPUT
+{
+    float4 Position : SV_POSITION;
+    float2 TexCoord : TEXCOORD0;
+};
+
+struct PS_OUTPUT
+{
+    float2 Moments : SV_TARGET;
+    float Depth : SV_Depth;
+};
+
+PS_OUTPUT mainPS(PS_INPUT Input)
+{
+    PS_OUTPUT Output;
+    Output.Moments = float2(1.0f, 1.0f);
+    Output.Depth = 1.0f;
+    return Output;
+}
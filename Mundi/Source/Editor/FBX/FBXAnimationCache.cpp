@@ -2,12 +2,20 @@
 #include "FBXAnimationCache.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
 #include "Source/Runtime/Engine/Animation/AnimDateModel.h"
+#include "Source/Runtime/Engine/Animation/AnimCompression.h"
 #include "ObjectFactory.h"
 #include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
 #include "PathUtils.h"
 #include <filesystem>
 
+namespace
+{
+	// 캐시 포맷 식별자. 포맷이 바뀌면 버전을 올려서 예전 캐시는 FBX에서 다시 추출되게 한다
+	constexpr uint32 AnimCacheMagic = 0xA11C0DE5;
+	constexpr uint32 AnimCacheVersion = 2;
+}
+
 bool FBXAnimationCache::TryLoadAnimationsFromCache(const FString& NormalizedPath, TArray<UAnimSequence*>& OutAnimations)
 {
 #ifdef USE_OBJ_CACHE
@@ -80,7 +88,12 @@ bool FBXAnimationCache::SaveAnimationToCache(UAnimSequence* Animation, const FSt
 			return false;
 		}
 
-		// 애니메이션 이름 먼저 쓰기
+		// 포맷 헤더
+		uint32 Magic = AnimCacheMagic;
+		uint32 Version = AnimCacheVersion;
+		Writer << Magic << Version;
+
+		// 애니메이션 이름
 		FString AnimName = Animation->ObjectName.ToString();
 		Serialization::WriteString(Writer, AnimName);
 
@@ -110,12 +123,22 @@ bool FBXAnimationCache::SaveAnimationToCache(UAnimSequence* Animation, const FSt
 		uint32 NumTracks = (uint32)Tracks.Num();
 		Writer << NumTracks;
 
+		// 압축된 모델은 원본 키가 비어 있으므로 이름만 쓰고 압축 데이터를 뒤에 붙인다
+		const FCompressedAnimData* CompressedKeys = DataModel->GetCompressedKeys();
+		uint8 bHasCompressedKeys = CompressedKeys ? 1 : 0;
+		Writer << bHasCompressedKeys;
+
 		for (FBoneAnimationTrack& Track : Tracks)
 		{
 			// 본 이름 쓰기
 			FString BoneName = Track.Name.ToString();
 			Serialization::WriteString(Writer, BoneName);
 
+			if (bHasCompressedKeys)
+			{
+				continue;
+			}
+
 			// 위치 키 쓰기
 			Serialization::WriteArray(Writer, Track.InternalTrack.PosKeys);
 
@@ -132,6 +155,12 @@ bool FBXAnimationCache::SaveAnimationToCache(UAnimSequence* Animation, const FSt
 			Serialization::WriteArray(Writer, Track.InternalTrack.ScaleKeys);
 		}
 
+		if (bHasCompressedKeys)
+		{
+			FCompressedAnimData CompressedCopy = *CompressedKeys;
+			CompressedCopy.Serialize(Writer);
+		}
+
 		Writer.Close();
 		UE_LOG("Animation saved to cache: %s", CachePath.c_str());
 		return true;
@@ -153,6 +182,16 @@ UAnimSequence* FBXAnimationCache::LoadAnimationFromCache(const FString& CachePat
 			return nullptr;
 		}
 
+		// 포맷 헤더 확인 (예전 포맷이면 FBX에서 다시 추출)
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		Reader << Magic << Version;
+		if (Magic != AnimCacheMagic || Version != AnimCacheVersion)
+		{
+			UE_LOG("Animation cache format is outdated, re-extracting: %s", CachePath.c_str());
+			return nullptr;
+		}
+
 		// 새 애니메이션 시퀀스 생성
 		UAnimSequence* Animation = NewObject<UAnimSequence>();
 
@@ -199,6 +238,9 @@ UAnimSequence* FBXAnimationCache::LoadAnimationFromCache(const FString& CachePat
 		uint32 NumTracks;
 		Reader << NumTracks;
 
+		uint8 bHasCompressedKeys = 0;
+		Reader << bHasCompressedKeys;
+
 		for (uint32 i = 0; i < NumTracks; ++i)
 		{
 			// 본 이름 읽기
@@ -209,6 +251,11 @@ UAnimSequence* FBXAnimationCache::LoadAnimationFromCache(const FString& CachePat
 			// 본 트랙 추가
 			DataModel->AddBoneTrack(BoneName);
 
+			if (bHasCompressedKeys)
+			{
+				continue;
+			}
+
 			// 위치 키 읽기
 			TArray<FVector> PosKeys;
 			Serialization::ReadArray(Reader, PosKeys);
@@ -233,6 +280,13 @@ UAnimSequence* FBXAnimationCache::LoadAnimationFromCache(const FString& CachePat
 			DataModel->SetBoneTrackKeys(BoneName, PosKeys, RotKeys, ScaleKeys);
 		}
 
+		if (bHasCompressedKeys)
+		{
+			auto CompressedKeys = std::make_shared<FCompressedAnimData>();
+			CompressedKeys->Serialize(Reader);
+			DataModel->SetCompressedKeys(std::move(CompressedKeys));
+		}
+
 		Reader.Close();
 		UE_LOG("Animation loaded from cache: %s (Name: %s)", CachePath.c_str(), AnimName.c_str());
 		return Animation;
@@ -4,6 +4,7 @@
 #include "FBXSceneUtilities.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
 #include "Source/Runtime/Engine/Animation/AnimDateModel.h"
+#include "Source/Runtime/Engine/Animation/AnimCompression.h"
 #include "ObjectFactory.h"
 #include "PathUtils.h"
 #include <filesystem>
@@ -173,6 +174,16 @@ void FBXAnimationLoader::ProcessAnimations(FbxScene* Scene, const FSkeletalMeshD
 
 		UE_LOG("Extracted animation data for %d bones", ExtractedBones);
 
+		// 키 압축 (원본 키는 버려지고 캐시에도 압축본만 저장된다)
+		FAnimCompressionStats CompressionStats;
+		if (DataModel->CompressKeys(FAnimCompressionSettings(), &CompressionStats))
+		{
+			UE_LOG("Compressed animation keys: %.1f KB -> %.1f KB (keys kept %d/%d, max error pos %.4f, rot %.4f rad, scale %.4f)",
+				CompressionStats.RawBytes / 1024.0, CompressionStats.CompressedBytes / 1024.0,
+				CompressionStats.NumKeptKeys, CompressionStats.NumRawKeys,
+				CompressionStats.MaxPositionError, CompressionStats.MaxRotationError, CompressionStats.MaxScaleError);
+		}
+
 		// 호환성 검사를 위해 본 이름 저장
 		TArray<FName> BoneNames;
 		for (const FBone& Bone : MeshData.Skeleton.Bones)
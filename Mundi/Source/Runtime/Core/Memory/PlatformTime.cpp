@@ -1,11 +1,15 @@
 ﻿
 #include "pch.h"
 #include "PlatformTime.h"
+#include <mutex>
 
 TMap<FString, FTimeProfile> TimeProfileMap;
+// Job System 워커에서도 TIME_PROFILE을 쓰므로 Map 갱신은 락으로 보호
+std::mutex TimeProfileLock;
 //Map에 이미 있으면 시간, 콜스택 추가
 void FScopeCycleCounter::AddTimeProfile(const TStatId& Key, double InMilliseconds)
 {
+	std::lock_guard<std::mutex> Guard(TimeProfileLock);
 	if (TimeProfileMap.Contains(Key.Key) == false)
 	{
 		TimeProfileMap[Key.Key] = FTimeProfile{ InMilliseconds, 1 };
@@ -19,6 +23,7 @@ void FScopeCycleCounter::AddTimeProfile(const TStatId& Key, double InMillisecond
 //시간, 콜스택 초기화
 void FScopeCycleCounter::TimeProfileInit()
 {
+	std::lock_guard<std::mutex> Guard(TimeProfileLock);
 	const TArray<FString> Keys = TimeProfileMap.GetKeys();
 	for (const FString& Key : Keys)
 	{
@@ -1,22 +1,75 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 
 namespace
 {
-    // NameMap을 안전하게 가져오는 getter
-    static TMap<FString, uint32>& GetNameMap()
+    constexpr uint32 NumShards = 16;
+
+    // 소문자 이름 → 인덱스 (샤드별로 따로 잠근다)
+    struct FNameShard
     {
-        // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게
-        // 단 한 번만 초기화됩니다.
-        static TMap<FString, uint32> GNameMap;
-        return GNameMap;
-    }
+        std::shared_mutex Lock;
+        std::unordered_map<FString, uint32> Map;
+    };
 
-    // Entries를 안전하게 가져오는 getter
-    static TArray<FNameEntry>& GetEntries()
+    struct FNameTable
     {
-        static TArray<FNameEntry> GEntries;
-        return GEntries;
+        FNameShard Shards[NumShards];
+
+        // 청크 포인터는 한 번 쓰이면 바뀌지 않는다 (락 없는 조회용)
+        std::atomic<FNameEntry*> Chunks[FNamePool::MaxChunks] = {};
+        std::atomic<uint32> NumEntries{ 0 };
+
+        // 엔트리 추가 (인덱스 발급 + 청크 할당)
+        std::mutex AppendLock;
+
+        FNameTable()
+        {
+            // 0번은 None (빈 문자열, Add가 맵을 거치지 않고 바로 돌려준다)
+            Append(FString(), FString());
+        }
+
+        // 청크는 해제하지 않는다: 다른 정적 객체의 소멸자가 종료 시점에 FName을 읽어도 안전하도록
+
+        static uint32 ShardOf(const FString& Lower)
+        {
+            return static_cast<uint32>(std::hash<FString>{}(Lower) % NumShards);
+        }
+
+        uint32 Append(const FString& Display, const FString& Lower)
+        {
+            std::lock_guard<std::mutex> Guard(AppendLock);
+
+            const uint32 Index = NumEntries.load(std::memory_order_relaxed);
+            const uint32 ChunkIndex = Index / FNamePool::EntriesPerChunk;
+            assert(ChunkIndex < FNamePool::MaxChunks && "FNamePool: too many names");
+
+            FNameEntry* Chunk = Chunks[ChunkIndex].load(std::memory_order_relaxed);
+            if (!Chunk)
+            {
+                Chunk = new FNameEntry[FNamePool::EntriesPerChunk];
+                Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+            }
+
+            FNameEntry& Entry = Chunk[Index % FNamePool::EntriesPerChunk];
+            Entry.Display = Display;
+            Entry.Comparison = Lower;
+
+            // 엔트리를 다 쓴 뒤에 개수를 올린다 (Get의 범위 검사가 미완성 엔트리를 보지 않도록)
+            NumEntries.store(Index + 1, std::memory_order_release);
+            return Index;
+        }
+    };
+
+    FNameTable& GetNameTable()
+    {
+        // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게
+        // 단 한 번만 초기화됩니다. (정적 초기화 중 FName 생성도 안전)
+        static FNameTable Table;
+        return Table;
     }
 
     // FString을 소문자로 변환하는 헬퍼 함수
@@ -31,32 +84,62 @@ namespace
 
 uint32 FNamePool::Add(const FString& InStr)
 {
+    if (InStr.empty())
+    {
+        return NoneIndex;
+    }
+
+    FNameTable& Table = GetNameTable();
     FString Lower = ToLower(InStr);
+    FNameShard& Shard = Table.Shards[FNameTable::ShardOf(Lower)];
 
-    // 전역 변수 대신 getter를 통해 접근
-    TMap<FString, uint32>& NameMap = GetNameMap();
-    TArray<FNameEntry>& Entries = GetEntries();
+    // 1. 이미 있는 이름 (대부분의 경우): 읽기 락만
+    {
+        std::shared_lock<std::shared_mutex> ReadGuard(Shard.Lock);
+        auto It = Shard.Map.find(Lower);
+        if (It != Shard.Map.end())
+        {
+            return It->second;
+        }
+    }
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+    // 2. 새 이름: 쓰기 락을 잡고 다시 확인 (그 사이 다른 스레드가 넣었을 수 있음)
+    std::unique_lock<std::shared_mutex> WriteGuard(Shard.Lock);
+    auto It = Shard.Map.find(Lower);
+    if (It != Shard.Map.end())
+    {
+        return It->second;
+    }
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
+    const uint32 NewIndex = Table.Append(InStr, Lower);
+    Shard.Map.emplace(std::move(Lower), NewIndex);
     return NewIndex;
 }
 
+uint32 FNamePool::Add(const char* InStr)
+{
+    if (!InStr || !*InStr)
+    {
+        return NoneIndex;
+    }
+    return Add(FString(InStr));
+}
+
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    // 전역 변수 대신 getter를 통해 접근
-    TArray<FNameEntry>& Entries = GetEntries();
+    FNameTable& Table = GetNameTable();
 
-    // (안전성 강화) 경계 검사 추가
-    if (Index >= Entries.size())
+    // (안전성 강화) 경계 검사: 범위 밖 인덱스는 None
+    if (Index >= Table.NumEntries.load(std::memory_order_acquire))
     {
-        static FNameEntry InvalidEntry = { "Invalid", "invalid" };
-        return InvalidEntry;
+        Index = NoneIndex;
     }
-    return Entries[Index];
-}
\ No newline at end of file
+
+    const FNameEntry* Chunk = Table.Chunks[Index / EntriesPerChunk].load(std::memory_order_acquire);
+    return Chunk[Index % EntriesPerChunk];
+}
+
+uint32 FNamePool::Num()
+{
+    return GetNameTable().NumEntries.load(std::memory_order_acquire);
+}
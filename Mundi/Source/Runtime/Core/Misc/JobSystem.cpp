@@ -0,0 +1,391 @@
+﻿#include "pch.h"
+#include "JobSystem.h"
+
+namespace
+{
+	// 워커 스레드는 자기 인덱스, 그 외 스레드는 -1
+	thread_local int32 GJobWorkerIndex = -1;
+}
+
+const TArray<FJobHandle> FJobSystem::NoPrerequisites;
+
+FJobPool::~FJobPool()
+{
+	for (FJob* Job : FreeJobs)
+	{
+		delete Job;
+	}
+}
+
+FJob* FJobPool::Acquire()
+{
+	RefCount.fetch_add(1, std::memory_order_relaxed);
+	{
+		std::lock_guard<std::mutex> Guard(Lock);
+		if (!FreeJobs.IsEmpty())
+		{
+			return FreeJobs.Pop();
+		}
+
+		// 새 Job이 돌아올 자리를 미리 확보해서 Recycle이 할당하지 않게 한다
+		++NumJobs;
+		if (static_cast<int32>(FreeJobs.capacity()) < NumJobs)
+		{
+			FreeJobs.Reserve(static_cast<int64>(NumJobs) * 2);
+			AddAllocation();
+		}
+	}
+
+	FJob* Job = new FJob();
+	Job->Pool = this;
+	AddAllocation();
+	return Job;
+}
+
+void FJobPool::Recycle(FJob* Job)
+{
+	// 락 밖에서 초기화한다 (남은 의존성 참조를 놓다가 같은 풀로 다시 들어올 수 있음)
+	Job->Task.Reset();
+	Job->Dependents.Empty();
+	Job->Fence = nullptr;
+	Job->PendingPrerequisites.store(1, std::memory_order_relaxed);
+	Job->bCompleted.store(false, std::memory_order_relaxed);
+
+	{
+		std::lock_guard<std::mutex> Guard(Lock);
+		FreeJobs.Add(Job);
+	}
+	Release();
+}
+
+void FJobPool::Release()
+{
+	if (RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		delete this;
+	}
+}
+
+FJobSystem::~FJobSystem()
+{
+	Shutdown();
+}
+
+void FJobSystem::Initialize(int32 InNumWorkers)
+{
+	if (bInit)
+	{
+		return;
+	}
+	if (bShutdown)
+	{
+		UE_LOG("[JobSystem] Initialize ignored after Shutdown");
+		return;
+	}
+
+	int32 NumWorkers = InNumWorkers;
+	if (NumWorkers <= 0)
+	{
+		// 게임 스레드 몫으로 하나 남겨둔다
+		NumWorkers = static_cast<int32>(std::thread::hardware_concurrency()) - 1;
+	}
+	NumWorkers = std::max(NumWorkers, 1);
+
+	bStopping = false;
+	Queues.Reserve(NumWorkers);
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		Queues.Emplace(std::make_unique<FWorkerQueue>());
+	}
+
+	Workers.Reserve(NumWorkers);
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.Emplace([this, i]() { WorkerMain(i); });
+	}
+
+	bInit = true;
+	UE_LOG("[JobSystem] Initialized with %d worker threads", NumWorkers);
+}
+
+void FJobSystem::Shutdown()
+{
+	bShutdown = true;
+	if (!bInit)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Guard(WakeLock);
+		bStopping = true;
+	}
+	WakeCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.Empty();
+	Queues.Empty();
+	QueuedJobCount = 0;
+	bInit = false;
+}
+
+FJobHandle FJobSystem::SubmitJob(FJob* RawJob, const TArray<FJobHandle>& Prerequisites, FJobFence* Fence)
+{
+	FJobRef Job(RawJob);
+	Job->Fence = Fence;
+	if (Fence)
+	{
+		Fence->PendingJobs.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// PendingPrerequisites는 1에서 시작한다 (등록 도중 선행 Job이 끝나도 먼저 실행되지 않도록 막는 몫)
+	for (const FJobHandle& Prerequisite : Prerequisites)
+	{
+		FJob* PrereqJob = Prerequisite.Job.Get();
+		if (!PrereqJob)
+		{
+			continue;
+		}
+
+		std::lock_guard<std::mutex> Guard(PrereqJob->DependentsLock);
+		if (!PrereqJob->bCompleted.load(std::memory_order_acquire))
+		{
+			Job->PendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+			if (PrereqJob->Dependents.size() == PrereqJob->Dependents.capacity())
+			{
+				PrereqJob->Pool->AddAllocation();
+			}
+			PrereqJob->Dependents.Add(Job);
+		}
+	}
+
+	if (Job->PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		Enqueue(Job);
+	}
+
+	return FJobHandle(std::move(Job));
+}
+
+void FJobSystem::Wait(const FJobHandle& Handle)
+{
+	while (!Handle.IsComplete())
+	{
+		if (!TryExecuteOne())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FJobSystem::Wait(const FJobFence& Fence)
+{
+	while (!Fence.IsDone())
+	{
+		if (!TryExecuteOne())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FJobSystem::WaitAll(const TArray<FJobHandle>& Handles)
+{
+	for (const FJobHandle& Handle : Handles)
+	{
+		Wait(Handle);
+	}
+}
+
+void FJobSystem::ParallelFor(int32 Num, int32 MinBatchSize, const std::function<void(int32 Begin, int32 End)>& Body)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	const int32 MaxChunks = GetNumWorkers() + 1;
+	const int32 BatchSize = std::max(MinBatchSize, 1);
+	const int32 NumChunks = std::min(MaxChunks, (Num + BatchSize - 1) / BatchSize);
+	if (NumChunks <= 1)
+	{
+		Body(0, Num);
+		return;
+	}
+
+	const int32 ChunkSize = (Num + NumChunks - 1) / NumChunks;
+
+	FJobFence Fence;
+	for (int32 Chunk = 1; Chunk < NumChunks; ++Chunk)
+	{
+		const int32 Begin = Chunk * ChunkSize;
+		const int32 End = std::min(Num, Begin + ChunkSize);
+		if (Begin >= End)
+		{
+			break;
+		}
+		Submit([&Body, Begin, End]() { Body(Begin, End); }, &Fence);
+	}
+
+	// 첫 구간은 호출 스레드가 직접 처리
+	Body(0, std::min(Num, ChunkSize));
+	Wait(Fence);
+}
+
+bool FJobSystem::IsWorkerThread() const
+{
+	return GJobWorkerIndex >= 0;
+}
+
+void FJobSystem::WorkerMain(int32 WorkerIndex)
+{
+	GJobWorkerIndex = WorkerIndex;
+
+	while (true)
+	{
+		if (FJobRef Job = FindJob(WorkerIndex))
+		{
+			Execute(Job);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> Lock(WakeLock);
+		WakeCondition.wait(Lock, [this]()
+		{
+			return bStopping.load() || QueuedJobCount.load() > 0;
+		});
+
+		if (bStopping.load() && QueuedJobCount.load() == 0)
+		{
+			break;
+		}
+	}
+
+	GJobWorkerIndex = -1;
+}
+
+void FJobSystem::Enqueue(FJobRef Job)
+{
+	if (!bInit)
+	{
+		// Shutdown 이후 제출된 Job은 호출 스레드에서 바로 처리
+		Execute(Job);
+		return;
+	}
+
+	// 워커가 제출한 Job은 자기 큐로 (캐시가 따뜻할 때 바로 이어서 처리), 외부 스레드는 라운드 로빈
+	const int32 NumQueues = Queues.Num();
+	const int32 QueueIndex = (GJobWorkerIndex >= 0 && GJobWorkerIndex < NumQueues)
+		? GJobWorkerIndex
+		: static_cast<int32>(NextQueueIndex.fetch_add(1, std::memory_order_relaxed) % NumQueues);
+
+	{
+		FWorkerQueue& Queue = *Queues[QueueIndex];
+		std::lock_guard<std::mutex> Guard(Queue.Lock);
+		Queue.Jobs.push_back(std::move(Job));
+	}
+	QueuedJobCount.fetch_add(1, std::memory_order_release);
+
+	{
+		// 워커가 조건 검사 후 잠들기 직전에 깨우는 신호를 놓치지 않도록 락을 한 번 거친다
+		std::lock_guard<std::mutex> Guard(WakeLock);
+	}
+	WakeCondition.notify_one();
+}
+
+FJobRef FJobSystem::FindJob(int32 WorkerIndex)
+{
+	if (QueuedJobCount.load(std::memory_order_acquire) <= 0)
+	{
+		return FJobRef();
+	}
+
+	const int32 NumQueues = Queues.Num();
+
+	// 1. 자기 큐의 뒤쪽 (가장 최근에 넣은 Job)
+	if (WorkerIndex >= 0 && WorkerIndex < NumQueues)
+	{
+		FWorkerQueue& Own = *Queues[WorkerIndex];
+		std::lock_guard<std::mutex> Guard(Own.Lock);
+		if (!Own.Jobs.empty())
+		{
+			FJobRef Job = std::move(Own.Jobs.back());
+			Own.Jobs.pop_back();
+			QueuedJobCount.fetch_sub(1, std::memory_order_acq_rel);
+			return Job;
+		}
+	}
+
+	// 2. 다른 큐의 앞쪽에서 훔쳐오기
+	const int32 Start = (WorkerIndex >= 0) ? WorkerIndex + 1 : static_cast<int32>(NextQueueIndex.load(std::memory_order_relaxed));
+	for (int32 Offset = 0; Offset < NumQueues; ++Offset)
+	{
+		const int32 VictimIndex = (Start + Offset) % NumQueues;
+		if (VictimIndex == WorkerIndex)
+		{
+			continue;
+		}
+
+		FWorkerQueue& Victim = *Queues[VictimIndex];
+		std::lock_guard<std::mutex> Guard(Victim.Lock);
+		if (!Victim.Jobs.empty())
+		{
+			FJobRef Job = std::move(Victim.Jobs.front());
+			Victim.Jobs.pop_front();
+			QueuedJobCount.fetch_sub(1, std::memory_order_acq_rel);
+			return Job;
+		}
+	}
+
+	return FJobRef();
+}
+
+bool FJobSystem::TryExecuteOne()
+{
+	if (!bInit)
+	{
+		return false;
+	}
+
+	if (FJobRef Job = FindJob(GJobWorkerIndex))
+	{
+		Execute(Job);
+		return true;
+	}
+	return false;
+}
+
+void FJobSystem::Execute(const FJobRef& Job)
+{
+	if (Job->Task)
+	{
+		Job->Task.Invoke();
+		Job->Task.Reset(); // 캡처한 리소스는 바로 놓아준다
+	}
+
+	{
+		std::lock_guard<std::mutex> Guard(Job->DependentsLock);
+		if (Job->Fence)
+		{
+			Job->Fence->PendingJobs.fetch_sub(1, std::memory_order_acq_rel);
+			Job->Fence = nullptr;
+		}
+		Job->bCompleted.store(true, std::memory_order_release);
+	}
+
+	// 완료 표시 뒤로는 Submit이 Dependents에 더하지 않으므로 락 없이 돈다. 용량은 남긴 채 비운다 (풀 재사용)
+	for (FJobRef& Dependent : Job->Dependents)
+	{
+		if (Dependent->PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Enqueue(std::move(Dependent));
+		}
+	}
+	Job->Dependents.Empty();
+}
@@ -0,0 +1,342 @@
+﻿#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include "UEContainer.h"
+
+class FJobFence;
+class FJobPool;
+struct FJob;
+
+/**
+ * Job이 실행할 호출 가능 객체.
+ * 캡처를 고정 크기 인라인 버퍼에 담으므로 std::function과 달리 힙을 쓰지 않는다.
+ * 캡처가 InlineSize를 넘으면 컴파일 에러가 나므로 큰 상태는 포인터로 넘긴다.
+ */
+class FJobTask
+{
+public:
+	static constexpr size_t InlineSize = 48;
+
+	FJobTask() = default;
+	~FJobTask() { Reset(); }
+	FJobTask(const FJobTask&) = delete;
+	FJobTask& operator=(const FJobTask&) = delete;
+
+	template<typename FuncType>
+	void Set(FuncType&& Func)
+	{
+		using FStored = std::decay_t<FuncType>;
+		static_assert(sizeof(FStored) <= InlineSize, "Job capture is too large for FJobTask; pass large state by pointer");
+		static_assert(alignof(FStored) <= alignof(std::max_align_t), "Job capture alignment is not supported by FJobTask");
+
+		Reset();
+		new (Storage) FStored(std::forward<FuncType>(Func));
+		InvokeFn = [](void* Ptr) { (*static_cast<FStored*>(Ptr))(); };
+		DestroyFn = [](void* Ptr) { static_cast<FStored*>(Ptr)->~FStored(); };
+	}
+
+	void Invoke()
+	{
+		if (InvokeFn)
+		{
+			InvokeFn(Storage);
+		}
+	}
+
+	void Reset()
+	{
+		if (DestroyFn)
+		{
+			DestroyFn(Storage);
+		}
+		InvokeFn = nullptr;
+		DestroyFn = nullptr;
+	}
+
+	explicit operator bool() const { return InvokeFn != nullptr; }
+
+private:
+	alignas(std::max_align_t) unsigned char Storage[InlineSize];
+	void (*InvokeFn)(void*) = nullptr;
+	void (*DestroyFn)(void*) = nullptr;
+};
+
+/** FJob 참조 카운트 포인터. 마지막 참조가 사라지면 Job은 자기 풀로 돌아간다. */
+class FJobRef
+{
+public:
+	FJobRef() = default;
+	explicit FJobRef(FJob* InJob);
+	FJobRef(const FJobRef& Other);
+	FJobRef(FJobRef&& Other) noexcept : Job(Other.Job) { Other.Job = nullptr; }
+	~FJobRef() { Reset(); }
+
+	FJobRef& operator=(const FJobRef& Other);
+	FJobRef& operator=(FJobRef&& Other) noexcept;
+
+	void Reset();
+
+	FJob* Get() const { return Job; }
+	FJob* operator->() const { return Job; }
+	explicit operator bool() const { return Job != nullptr; }
+
+private:
+	FJob* Job = nullptr;
+};
+
+/**
+ * Job System에 제출되는 작업 단위.
+ * 직접 만들지 말고 FJobSystem::Submit이 돌려주는 FJobHandle로만 다룬다.
+ */
+struct FJob
+{
+	FJobTask Task;
+
+	/** 아직 끝나지 않은 선행 Job 수 (0이 되면 큐에 들어간다) */
+	std::atomic<int32> PendingPrerequisites{ 1 };
+	std::atomic<bool> bCompleted{ false };
+
+	/** 이 Job이 끝나야 실행될 수 있는 후행 Job 목록 */
+	std::mutex DependentsLock;
+	TArray<FJobRef> Dependents;
+
+	/** 완료 시 카운트를 내려줄 펜스 (선택) */
+	FJobFence* Fence = nullptr;
+
+	/** FJobRef 참조 수와 반납될 풀 */
+	std::atomic<int32> RefCount{ 0 };
+	FJobPool* Pool = nullptr;
+};
+
+/**
+ * 재사용되는 FJob 묶음.
+ * 매 프레임 같은 모양의 Job을 내는 시스템(파티클 등)이 하나씩 가지면 정상 상태 프레임에는 Job 할당이 없다.
+ * 돌아온 Job은 의존성 배열 용량을 유지한 채 자유 목록에 들어간다.
+ * 풀도 참조 카운트로 산다: 소유자가 놓아도 나가 있는 Job이 모두 돌아온 뒤에 삭제된다.
+ */
+class FJobPool
+{
+public:
+	struct FDeleter
+	{
+		void operator()(FJobPool* Pool) const
+		{
+			if (Pool)
+			{
+				Pool->Release();
+			}
+		}
+	};
+	using FPtr = std::unique_ptr<FJobPool, FDeleter>;
+
+	static FPtr Create() { return FPtr(new FJobPool()); }
+
+	/** 마지막 호출 이후 새로 힙 할당한 횟수 (Job 객체, 자유 목록/의존성 배열 확장) */
+	uint32 ConsumeAllocationCount() { return AllocationCount.exchange(0, std::memory_order_relaxed); }
+
+private:
+	friend class FJobSystem;
+	friend class FJobRef;
+
+	FJobPool() = default;
+	~FJobPool();
+	FJobPool(const FJobPool&) = delete;
+	FJobPool& operator=(const FJobPool&) = delete;
+
+	FJob* Acquire();
+	void Recycle(FJob* Job);
+	void Release();
+	void AddAllocation() { AllocationCount.fetch_add(1, std::memory_order_relaxed); }
+
+	std::mutex Lock;
+	TArray<FJob*> FreeJobs;
+	int32 NumJobs = 0;
+
+	// 소유자 몫 1 + 나가 있는 Job 수
+	std::atomic<int32> RefCount{ 1 };
+	std::atomic<uint32> AllocationCount{ 0 };
+};
+
+inline FJobRef::FJobRef(FJob* InJob)
+	: Job(InJob)
+{
+	if (Job)
+	{
+		Job->RefCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+inline FJobRef::FJobRef(const FJobRef& Other)
+	: FJobRef(Other.Job)
+{
+}
+
+inline FJobRef& FJobRef::operator=(const FJobRef& Other)
+{
+	if (Job != Other.Job)
+	{
+		FJobRef Copy(Other);
+		*this = std::move(Copy);
+	}
+	return *this;
+}
+
+inline FJobRef& FJobRef::operator=(FJobRef&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		Reset();
+		Job = Other.Job;
+		Other.Job = nullptr;
+	}
+	return *this;
+}
+
+inline void FJobRef::Reset()
+{
+	FJob* Released = Job;
+	Job = nullptr;
+	if (Released && Released->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		Released->Pool->Recycle(Released);
+	}
+}
+
+/** 제출된 Job을 가리키는 핸들. 완료 확인과 선행 작업 지정에 사용한다. */
+class FJobHandle
+{
+public:
+	FJobHandle() = default;
+
+	bool IsValid() const { return static_cast<bool>(Job); }
+	bool IsComplete() const { return !Job || Job->bCompleted.load(std::memory_order_acquire); }
+	void Reset() { Job.Reset(); }
+
+private:
+	friend class FJobSystem;
+	explicit FJobHandle(FJobRef InJob) : Job(std::move(InJob)) {}
+
+	FJobRef Job;
+};
+
+/**
+ * 여러 Job을 묶어서 한 번에 기다리기 위한 카운터.
+ * Submit 시 펜스를 넘기면 카운트가 오르고, Job이 끝나면 내려간다.
+ */
+class FJobFence
+{
+public:
+	FJobFence() = default;
+	FJobFence(const FJobFence&) = delete;
+	FJobFence& operator=(const FJobFence&) = delete;
+
+	bool IsDone() const { return PendingJobs.load(std::memory_order_acquire) == 0; }
+	int32 GetPendingJobCount() const { return PendingJobs.load(std::memory_order_relaxed); }
+
+private:
+	friend class FJobSystem;
+	std::atomic<int32> PendingJobs{ 0 };
+};
+
+/**
+ * 엔진 전역 Job System
+ * - 고정 개수의 워커 스레드, 워커마다 하나씩 가진 Work-Stealing Deque
+ * - 자기 Deque는 뒤에서(LIFO) 꺼내고, 놀고 있으면 다른 워커의 앞에서(FIFO) 훔쳐온다
+ * - Wait 중인 스레드(게임 스레드 포함)도 놀지 않고 큐에 남은 Job을 대신 처리한다
+ */
+class FJobSystem
+{
+public:
+	static FJobSystem& GetInstance()
+	{
+		static FJobSystem Instance;
+		return Instance;
+	}
+
+	/**
+	 * 엔진 Startup에서 한 번만 호출한다. Shutdown 이후의 호출은 무시된다 (워커를 다시 띄우지 않음).
+	 * 초기화 전/종료 후에 제출된 Job은 호출 스레드에서 바로 실행되고 ParallelFor는 직렬로 돈다.
+	 * @param InNumWorkers 0이면 (논리 코어 수 - 1)개를 만든다
+	 */
+	void Initialize(int32 InNumWorkers = 0);
+	void Shutdown();
+
+	/**
+	 * 캡처는 FJobTask::InlineSize 안에 들어가야 한다 (힙을 쓰지 않음).
+	 * @param Pool Job을 꺼내올 풀. nullptr이면 Job System 기본 풀을 쓴다
+	 */
+	template<typename FuncType>
+	FJobHandle Submit(FuncType&& Task, FJobFence* Fence = nullptr, FJobPool* Pool = nullptr)
+	{
+		return Submit(std::forward<FuncType>(Task), NoPrerequisites, Fence, Pool);
+	}
+
+	template<typename FuncType>
+	FJobHandle Submit(FuncType&& Task, const TArray<FJobHandle>& Prerequisites, FJobFence* Fence = nullptr, FJobPool* Pool = nullptr)
+	{
+		FJob* Job = (Pool ? Pool : DefaultPool.get())->Acquire();
+		Job->Task.Set(std::forward<FuncType>(Task));
+		return SubmitJob(Job, Prerequisites, Fence);
+	}
+
+	/** 대기하는 동안 호출 스레드도 다른 Job을 처리한다 */
+	void Wait(const FJobHandle& Handle);
+	void Wait(const FJobFence& Fence);
+	void WaitAll(const TArray<FJobHandle>& Handles);
+
+	/**
+	 * [0, Num) 구간을 나눠 워커들과 호출 스레드가 함께 처리하고, 모두 끝날 때까지 기다린다.
+	 * @param MinBatchSize 한 Job이 맡을 최소 원소 수 (너무 잘게 쪼개지지 않도록)
+	 */
+	void ParallelFor(int32 Num, int32 MinBatchSize, const std::function<void(int32 Begin, int32 End)>& Body);
+
+	int32 GetNumWorkers() const { return static_cast<int32>(Workers.size()); }
+	bool IsWorkerThread() const;
+
+private:
+	struct FWorkerQueue
+	{
+		std::mutex Lock;
+		std::deque<FJobRef> Jobs;
+	};
+
+	FJobSystem() = default;
+	~FJobSystem();
+	FJobSystem(const FJobSystem&) = delete;
+	FJobSystem& operator=(const FJobSystem&) = delete;
+
+	FJobHandle SubmitJob(FJob* RawJob, const TArray<FJobHandle>& Prerequisites, FJobFence* Fence);
+	void WorkerMain(int32 WorkerIndex);
+	void Enqueue(FJobRef Job);
+	FJobRef FindJob(int32 WorkerIndex);
+	bool TryExecuteOne();
+	void Execute(const FJobRef& Job);
+
+private:
+	static const TArray<FJobHandle> NoPrerequisites;
+
+	// 풀을 지정하지 않은 Submit이 쓰는 풀
+	FJobPool::FPtr DefaultPool = FJobPool::Create();
+
+	bool bInit = false;
+	// 한 번 종료되면 다시 초기화하지 않는다 (종료 중 소멸자 등에서 워커가 되살아나지 않도록)
+	bool bShutdown = false;
+	std::atomic<bool> bStopping{ false };
+
+	TArray<std::thread> Workers;
+	TArray<std::unique_ptr<FWorkerQueue>> Queues;
+
+	std::atomic<int32> QueuedJobCount{ 0 };
+	std::atomic<uint32> NextQueueIndex{ 0 };
+
+	std::mutex WakeLock;
+	std::condition_variable WakeCondition;
+};
@@ -15,11 +15,26 @@ struct FNameEntry
     FString Comparison; // lower-case
 };
 
+/**
+ * 전역 이름 테이블
+ * - 엔트리는 고정 크기 청크에 추가만 하므로 주소가 바뀌지 않는다 (Get이 돌려준 참조는 프로그램 끝까지 유효)
+ * - 조회(Get)는 락 없이 인덱스 → 청크 → 엔트리 두 번 읽기
+ * - 추가(Add)는 소문자 문자열 해시로 고른 샤드만 잠가서 워커 스레드끼리 덜 부딪친다
+ *   (이미 있는 이름은 샤드 읽기 락만 잡는다)
+ * - 0번 엔트리는 빈 문자열(None)로 예약. 기본 FName과 FName("")이 여기를 가리킨다
+ */
 class FNamePool
 {
 public:
+    static constexpr uint32 NoneIndex = 0;
+    static constexpr uint32 EntriesPerChunk = 4096;
+    static constexpr uint32 MaxChunks = 1024;
+
     static uint32 Add(const FString& InStr);
+    static uint32 Add(const char* InStr);
     static const FNameEntry& Get(uint32 Index);
+    /** 등록된 이름 수 (None 포함) */
+    static uint32 Num();
 };
 
 // ──────────────────────────────
@@ -27,37 +42,40 @@ public:
 // ──────────────────────────────
 struct FName
 {
-    uint32 DisplayIndex = -1;
-    uint32 ComparisonIndex = -1;
+    uint32 DisplayIndex = FNamePool::NoneIndex;
+    uint32 ComparisonIndex = FNamePool::NoneIndex;
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
-    FName(const FString& InStr) { Init(InStr); }
+    FName(const char* InStr) { Init(FNamePool::Add(InStr)); }
+    FName(const FString& InStr) { Init(FNamePool::Add(InStr)); }
 
-    void Init(const FString& InStr)
+    void Init(uint32 Index)
     {
-        int32_t Index = FNamePool::Add(InStr);
         DisplayIndex = Index;
         ComparisonIndex = Index; // 필요시 다른 규칙 적용 가능
     }
 
     bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex; }
     FString ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+    /** 복사 없이 원문 참조 (이름 테이블이 프로그램 끝까지 들고 있다) */
+    const FString& GetString() const { return FNamePool::Get(DisplayIndex).Display; }
+    /** 빈 이름(기본값, "") 여부. 문자열을 보지 않는다 */
+    bool IsNone() const { return ComparisonIndex == FNamePool::NoneIndex; }
     bool IsValid() const { return DisplayIndex >= 0 && ComparisonIndex >= 0; }
 
     friend FName operator+(const FName& A, const FName& B)
     {
-        return FName(A.ToString() + B.ToString());
+        return FName(A.GetString() + B.GetString());
     }
 
     friend FName operator+(const FName& A, const FString& B)
     {
-        return FName(A.ToString() + B);
+        return FName(A.GetString() + B);
     }
 
     friend FName operator+(const FString& A, const FName& B)
     {
-        return FName(A + B.ToString());
+        return FName(A + B.GetString());
     }
 };
 
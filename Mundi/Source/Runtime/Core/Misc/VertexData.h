@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <atomic>
 #include "Archive.h"
 #include "Vector.h"
 #include "Name.h"
@@ -364,6 +365,13 @@ struct FSkeleton
     TArray<FBone> Bones; // 본 배열
     TArray<FSkeletalMeshSocket> Sockets; // 소켓 배열
     TMap <FString, int32> BoneNameToIndex; // 이름으로 본 검색
+    uint32 LayoutId = AllocateLayoutId(); // 본 구성 식별 번호 (애니메이션 트랙→본 리맵 캐시 키, 로드할 때마다 새로 받음)
+
+    static uint32 AllocateLayoutId()
+    {
+        static std::atomic<uint32> NextLayoutId{ 1 };
+        return NextLayoutId.fetch_add(1, std::memory_order_relaxed);
+    }
 
     /**
      * @brief 본 이름으로 본 인덱스를 찾기
@@ -372,7 +380,7 @@ struct FSkeleton
      */
     int32 FindBoneIndex(const FName& BoneName) const
     {
-        auto It = BoneNameToIndex.find(BoneName.ToString());
+        auto It = BoneNameToIndex.find(BoneName.GetString());
         if (It != BoneNameToIndex.end())
         {
             return It->second;
@@ -480,7 +488,8 @@ struct FSkeleton
                 Ar << bone;
             }
 
-            // BoneNameToIndex 재구축
+            // BoneNameToIndex 재구축 (본 구성이 바뀌었으므로 리맵 캐시도 새로 만들게 한다)
+            Skeleton.LayoutId = FSkeleton::AllocateLayoutId();
             Skeleton.BoneNameToIndex.clear();
             for (int32 i = 0; i < static_cast<int32>(Skeleton.Bones.size()); ++i)
             {
@@ -646,6 +655,15 @@ struct FMeshParticleInstanceData
     FLinearColor Color;
 };
 
+// 자동 인스턴싱된 스태틱 메시 한 개 (UberLit USE_INSTANCING의 slot 1)
+struct FStaticMeshInstanceData
+{
+    FMatrix WorldMatrix;
+    FMatrix WorldInverseTranspose;
+    uint32  ObjectID;
+    uint32  Padding[3];
+};
+
 struct FParticleBeamVertex
 {
     FVector Position;       // 월드 위치
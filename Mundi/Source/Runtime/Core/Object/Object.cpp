@@ -23,6 +23,79 @@ void UClass::RegisterFunction(UClass* Class, const FName& Name, VoidFuncPtr Func
 	Class->FunctionMap[Name] = Func;
 }
 
+void UClass::BuildClassTree()
+{
+	// 1. 부모 → 자식 목록 (UObject는 SignUpClass를 거치지 않으므로 루트로 직접 넣는다)
+	UClass* ObjectClass = UObject::StaticClass();
+	TArray<UClass*> Roots;
+	Roots.Add(ObjectClass);
+	ObjectClass->ClassTreeIndex = -1;
+	ObjectClass->ClassTreeLastDescendant = -1;
+
+	std::unordered_map<const UClass*, TArray<UClass*>> Children;
+	for (UClass* Class : GetAllClasses())
+	{
+		if (!Class || Class == ObjectClass)
+		{
+			continue;
+		}
+
+		Class->ClassTreeIndex = -1;
+		Class->ClassTreeLastDescendant = -1;
+		if (Class->Super)
+		{
+			Children[Class->Super].Add(Class);
+		}
+		else
+		{
+			Roots.Add(Class);
+		}
+	}
+
+	// 2. 전위 순회로 번호 매기기 (빠져나올 때 서브트리 끝 번호 기록)
+	struct FStackEntry
+	{
+		UClass* Class;
+		bool bExit;
+	};
+	TArray<FStackEntry> Stack;
+	int32 NextIndex = 0;
+
+	for (UClass* Root : Roots)
+	{
+		Stack.Add({ Root, false });
+		while (!Stack.IsEmpty())
+		{
+			const FStackEntry Entry = Stack.back();
+			Stack.pop_back();
+
+			if (Entry.bExit)
+			{
+				Entry.Class->ClassTreeLastDescendant = NextIndex - 1;
+				continue;
+			}
+			if (Entry.Class->ClassTreeIndex >= 0)
+			{
+				continue; // 중복 등록 방어
+			}
+
+			Entry.Class->ClassTreeIndex = NextIndex++;
+			Stack.Add({ Entry.Class, true });
+
+			auto It = Children.find(Entry.Class);
+			if (It != Children.end())
+			{
+				for (UClass* Child : It->second)
+				{
+					Stack.Add({ Child, false });
+				}
+			}
+		}
+	}
+
+	UE_LOG("[UClass] Class tree built: %d classes", NextIndex);
+}
+
 void UObject::ProcessEvent(FName FuncName)
 {
 	// 1. 내 설계도(UClass)를 가져옴
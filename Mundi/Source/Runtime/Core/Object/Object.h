@@ -31,6 +31,10 @@ struct UClass
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
 
+    // 클래스 트리 전위 순회 번호 (BuildClassTree 이후 유효, -1이면 번호 없음 → Super 체인 순회)
+    int32 ClassTreeIndex = -1;
+    int32 ClassTreeLastDescendant = -1;    // 서브트리의 마지막 자손 번호 (자손이 없으면 자기 번호)
+
     /* 간단한 UFUNC */
     TMap<FName, VoidFuncPtr> FunctionMap;
     VoidFuncPtr FindFunction(const FName& InName) const;    
@@ -43,6 +47,19 @@ struct UClass
     {
     }
     bool IsChildOf(const UClass* Base) const noexcept
+    {
+        if (!Base) return false;
+        if (ClassTreeIndex >= 0 && Base->ClassTreeIndex >= 0)
+        {
+            // Base 서브트리 구간 [Index, LastDescendant] 안이면 자손 (부호 없는 비교 한 번으로 양쪽 경계 검사)
+            return static_cast<uint32>(ClassTreeIndex - Base->ClassTreeIndex)
+                <= static_cast<uint32>(Base->ClassTreeLastDescendant - Base->ClassTreeIndex);
+        }
+        return IsChildOfBySuperChain(Base);
+    }
+
+    // 번호가 없는 클래스(트리 구성 전/후에 늦게 등록된 클래스)용 기존 경로
+    bool IsChildOfBySuperChain(const UClass* Base) const noexcept
     {
         if (!Base) return false;
         for (auto c = this; c; c = c->Super)
@@ -50,6 +67,13 @@ struct UClass
         return false;
     }
 
+    /**
+     * 등록된 모든 클래스에 전위 순회 번호와 서브트리 끝 번호를 매긴다
+     * 정적 초기화(IMPLEMENT_CLASS/SignUpClass)가 끝난 뒤 한 번 호출하면 IsChildOf가 정수 비교 두 번이 된다
+     * 이후에 등록되는 클래스는 번호 없이 Super 체인 순회로 동작한다
+     */
+    static void BuildClassTree();
+
     static TArray<UClass*>& GetAllClasses()
     {
         static TArray<UClass*> AllClasses;
@@ -0,0 +1,120 @@
+﻿#include "pch.h"
+#include "ObjectBenchmark.h"
+#include "PlatformTime.h"
+#include "SceneComponent.h"
+#include "PrimitiveComponent.h"
+#include "MeshComponent.h"
+#include "StaticMeshComponent.h"
+#include "DecalComponent.h"
+#include "BillboardComponent.h"
+#include "LightComponent.h"
+#include "PointLightComponent.h"
+#include "SpotLightComponent.h"
+#include "DirectionalLightComponent.h"
+
+namespace
+{
+    // 번호 비교 이전의 Cast (Super 체인을 끝까지 올라간다)
+    template<class T>
+    T* CastBySuperChain(UObject* Obj)
+    {
+        return (Obj && Obj->GetClass()->IsChildOfBySuperChain(T::StaticClass())) ? static_cast<T*>(Obj) : nullptr;
+    }
+
+    // GatherVisibleProxies의 컴포넌트당 Cast 연쇄를 흉내 낸다 (일치한 Cast 수를 반환)
+    template<bool bSuperChain>
+    int32 RunCastChain(const TArray<UObject*>& Objects)
+    {
+        int32 Hits = 0;
+        for (UObject* Obj : Objects)
+        {
+            if constexpr (bSuperChain)
+            {
+                Hits += CastBySuperChain<UPrimitiveComponent>(Obj) ? 1 : 0;
+                Hits += CastBySuperChain<UMeshComponent>(Obj) ? 1 : 0;
+                Hits += CastBySuperChain<UStaticMeshComponent>(Obj) ? 1 : 0;
+                Hits += CastBySuperChain<UBillboardComponent>(Obj) ? 1 : 0;
+                Hits += CastBySuperChain<UDecalComponent>(Obj) ? 1 : 0;
+                Hits += CastBySuperChain<UDirectionalLightComponent>(Obj) ? 1 : 0;
+                Hits += CastBySuperChain<USpotLightComponent>(Obj) ? 1 : 0;
+                Hits += CastBySuperChain<UPointLightComponent>(Obj) ? 1 : 0;
+                Hits += CastBySuperChain<ULightComponent>(Obj) ? 1 : 0;
+                Hits += CastBySuperChain<USceneComponent>(Obj) ? 1 : 0;
+            }
+            else
+            {
+                Hits += Cast<UPrimitiveComponent>(Obj) ? 1 : 0;
+                Hits += Cast<UMeshComponent>(Obj) ? 1 : 0;
+                Hits += Cast<UStaticMeshComponent>(Obj) ? 1 : 0;
+                Hits += Cast<UBillboardComponent>(Obj) ? 1 : 0;
+                Hits += Cast<UDecalComponent>(Obj) ? 1 : 0;
+                Hits += Cast<UDirectionalLightComponent>(Obj) ? 1 : 0;
+                Hits += Cast<USpotLightComponent>(Obj) ? 1 : 0;
+                Hits += Cast<UPointLightComponent>(Obj) ? 1 : 0;
+                Hits += Cast<ULightComponent>(Obj) ? 1 : 0;
+                Hits += Cast<USceneComponent>(Obj) ? 1 : 0;
+            }
+        }
+        return Hits;
+    }
+}
+
+void FObjectBenchmark::RunCastBenchmark(int32 NumObjects, int32 NumIterations)
+{
+    constexpr int32 CastsPerObject = 10;
+    UE_LOG("[ObjectBenchmark] Cast chain: %d objects x %d casts x %d iterations", NumObjects, CastsPerObject, NumIterations);
+
+    const UClass* SpotClass = USpotLightComponent::StaticClass();
+    if (SpotClass->ClassTreeIndex < 0)
+    {
+        UE_LOG("[ObjectBenchmark] WARNING: class tree not built, both paths walk the Super chain");
+    }
+
+    // 1. 깊은 계층(스포트 라이트: UObject에서 7단계)과 얕은 계층을 섞는다
+    TArray<UObject*> Objects;
+    Objects.Reserve(NumObjects);
+    for (int32 i = 0; i < NumObjects; ++i)
+    {
+        switch (i % 4)
+        {
+        case 0: Objects.Add(NewObject<USpotLightComponent>()); break;
+        case 1: Objects.Add(NewObject<UPointLightComponent>()); break;
+        case 2: Objects.Add(NewObject<UStaticMeshComponent>()); break;
+        default: Objects.Add(NewObject<USceneComponent>()); break;
+        }
+    }
+
+    // 2. 번호 비교 vs Super 체인 순회 (결과가 같아야 한다)
+    int64 TreeHits = 0;
+    int64 ChainHits = 0;
+    const uint64 TreeStart = FPlatformTime::Cycles64();
+    for (int32 Iter = 0; Iter < NumIterations; ++Iter)
+    {
+        TreeHits += RunCastChain<false>(Objects);
+    }
+    const uint64 TreeCycles = FPlatformTime::Cycles64() - TreeStart;
+
+    const uint64 ChainStart = FPlatformTime::Cycles64();
+    for (int32 Iter = 0; Iter < NumIterations; ++Iter)
+    {
+        ChainHits += RunCastChain<true>(Objects);
+    }
+    const uint64 ChainCycles = FPlatformTime::Cycles64() - ChainStart;
+
+    const double NumCasts = static_cast<double>(NumObjects) * CastsPerObject * FMath::Max(NumIterations, 1);
+    const double TreeNs = FPlatformTime::ToMilliseconds(TreeCycles) * 1.0e6 / NumCasts;
+    const double ChainNs = FPlatformTime::ToMilliseconds(ChainCycles) * 1.0e6 / NumCasts;
+
+    UE_LOG("[ObjectBenchmark] Class tree index : %.2f ns/cast (%.1f M casts/s)", TreeNs, TreeNs > 0.0 ? 1000.0 / TreeNs : 0.0);
+    UE_LOG("[ObjectBenchmark] Super chain walk : %.2f ns/cast (%.1f M casts/s, x%.1f)",
+        ChainNs, ChainNs > 0.0 ? 1000.0 / ChainNs : 0.0, TreeNs > 0.0 ? ChainNs / TreeNs : 0.0);
+    if (TreeHits != ChainHits)
+    {
+        UE_LOG("[ObjectBenchmark] WARNING: cast result mismatch (tree %lld, chain %lld)", TreeHits, ChainHits);
+    }
+
+    for (UObject* Obj : Objects)
+    {
+        ObjectFactory::DeleteObject(Obj);
+    }
+}
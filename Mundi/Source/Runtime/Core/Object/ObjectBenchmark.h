@@ -0,0 +1,15 @@
+﻿#pragma once
+
+/**
+ * UObject 타입 시스템 헤드리스 벤치마크 (콘솔: BENCH CAST)
+ * 월드 없이 컴포넌트만 만들어 Cast 비용을 잰다
+ */
+class FObjectBenchmark
+{
+public:
+    /**
+     * 스포트/포인트 라이트, 스태틱 메시, 씬 컴포넌트를 섞은 NumObjects개에 대해 GatherVisibleProxies와 같은
+     * Cast 연쇄를 NumIterations번 돌려 클래스 트리 번호 비교와 Super 체인 순회의 Cast당 시간을 로그로 출력
+     */
+    static void RunCastBenchmark(int32 NumObjects = 4096, int32 NumIterations = 200);
+};
@@ -1,7 +1,5 @@
 ﻿#include "pch.h"
 #include "ObjectFactory.h"
-// 전역 오브젝트 배열 정의 (한 번만!)
-TArray<UObject*> GUObjectArray;
 
 namespace ObjectFactory
 {
@@ -29,10 +27,8 @@ namespace ObjectFactory
         UObject* Obj = ConstructObject(Class);
         if (!Obj) return nullptr;
 
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-
+        // 빈 슬롯 재사용 (세대가 바뀌어 옛 약참조는 새 객체를 가리키지 않는다)
+        const int32 idx = GUObjectArray.Allocate(Obj);
         Obj->InternalIndex = static_cast<uint32>(idx);
 
         static TMap<UClass*, int> NameCounters;
@@ -55,10 +51,7 @@ namespace ObjectFactory
         if (!Obj) return nullptr;
 
         // 배열에 등록: 빈 슬롯 재사용
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-        //}
+        const int32 idx = GUObjectArray.Allocate(Obj);
         Obj->InternalIndex = static_cast<uint32>(idx);
 
         static TMap<UClass*, int> NameCounters;
@@ -81,24 +74,16 @@ namespace ObjectFactory
     {
         if (!Obj) return;
 
-        // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 FoundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
-        {
-            if (GUObjectArray[i] == Obj)
-            {
-                FoundIndex = i;
-                break;
-            }
-        }
-        if (FoundIndex < 0)
+        // 주소로 슬롯을 찾아 살아 있을 때만 삭제 (관리 대상 아님/이미 삭제됨이면 무시)
+        // 소유자 소멸자가 DeleteAll에서 먼저 지워진 자식을 다시 지우는 경우가 있어 Obj를 역참조하기 전에 확인한다
+        const int32 Index = GUObjectArray.FindIndex(Obj);
+        if (Index < 0)
         {
-            // Not managed or already deleted.
             return;
         }
 
-        GUObjectArray[FoundIndex] = nullptr;
-        // Safe to delete now; Obj still valid since we found it in GUObjectArray
+        GUObjectArray.Free(Index);
+        Obj->InternalIndex = UINT32_MAX;
         Obj->DestroyInternal();
     }
 
@@ -113,27 +98,5 @@ namespace ObjectFactory
             }
         }
         GUObjectArray.Empty();
-        GUObjectArray.Shrink();
-    }
-
-    // (선택) null 슬롯 압축
-    void CompactNullSlots()
-    {
-        int32 write = 0;
-        for (int32 read = 0; read < GUObjectArray.Num(); ++read)
-        {
-            if (UObject* Obj = GUObjectArray[read])
-            {
-                if (write != read)
-                {
-                    GUObjectArray[write] = Obj;
-                    Obj->InternalIndex = static_cast<uint32>(write);
-                    GUObjectArray[read] = nullptr;
-                }
-                ++write;
-            }
-        }
-        // 크기(Num) 축소 + 불필요한 capacity도 반환
-        GUObjectArray.SetNum(write);
     }
 }
@@ -1,11 +1,11 @@
 ﻿#pragma once
 #include "UEContainer.h"
+#include "UObjectArray.h"
 
 
 // ── 외부 심볼 ─────────────────────────────────────────────
 class UObject;
 struct UClass;
-extern TArray<UObject*> GUObjectArray;
 
 // ── ObjectFactory 네임스페이스 ─────────────────────────────
 namespace ObjectFactory
@@ -42,12 +42,10 @@ namespace ObjectFactory
         return static_cast<T*>(AddToGUObjectArray(T::StaticClass(), Dest));
     }
 
-    // 개별 삭제(단일 소유자: Factory)
+    // 개별 삭제(단일 소유자: Factory). 주소 → 슬롯 맵으로 찾으므로 이미 삭제된 포인터도 안전하게 무시한다 (O(1))
     void DeleteObject(UObject* Obj);
     // 종료시 일괄 정리
     void DeleteAll(bool bCallBeginDestroy = true);
-    // Null 슬롯 압축하여 배열 크기 축소
-    void CompactNullSlots();
 }
 
 // ── 등록 매크로 ─────────────────────────────────────────────
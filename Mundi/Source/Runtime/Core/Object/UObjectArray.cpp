@@ -0,0 +1,91 @@
+﻿#include "pch.h"
+#include "UObjectArray.h"
+
+// 전역 오브젝트 배열 정의 (한 번만!)
+FUObjectArray GUObjectArray;
+
+FUObjectArray::FUObjectArray()
+{
+    ReserveNullSlot();
+}
+
+void FUObjectArray::ReserveNullSlot()
+{
+    // 0번 슬롯은 피킹의 "선택 없음"과 겹치므로 영구히 비워 둔다
+    Allocate(nullptr);
+}
+
+int32 FUObjectArray::Allocate(UObject* Object)
+{
+    const int32 Index = AllocateSlot(Object);
+    if (Object)
+    {
+        ObjectIndices.Add(Object, Index);
+    }
+    return Index;
+}
+
+int32 FUObjectArray::AllocateSlot(UObject* Object)
+{
+    // 1. 프리 리스트 재사용 (최근에 비운 슬롯부터, 세대는 Free에서 이미 올라가 있음)
+    if (FirstFreeIndex >= 0)
+    {
+        const int32 Index = FirstFreeIndex;
+        FUObjectItem& Item = GetItem(Index);
+        FirstFreeIndex = Item.NextFreeIndex;
+        Item.NextFreeIndex = -1;
+        Item.Object = Object;
+        --NumFree;
+        return Index;
+    }
+
+    // 2. 끝에 추가 (청크가 차면 새 청크, 기존 청크는 옮기지 않는다)
+    const int32 Index = NumSlots;
+    if (Index / NumElementsPerChunk >= Chunks.Num())
+    {
+        Chunks.Add(std::make_unique<FUObjectItem[]>(NumElementsPerChunk));
+    }
+    ++NumSlots;
+
+    FUObjectItem& Item = GetItem(Index);
+    Item.Object = Object;
+    Item.NextFreeIndex = -1;
+    return Index;
+}
+
+void FUObjectArray::Free(int32 Index)
+{
+    // 0번 슬롯과 이미 빈 슬롯은 무시 (중복 해제로 프리 리스트가 꼬이지 않게)
+    if (Index <= 0 || Index >= NumSlots)
+    {
+        return;
+    }
+
+    FUObjectItem& Item = GetItem(Index);
+    if (!Item.Object)
+    {
+        return;
+    }
+
+    ObjectIndices.Remove(Item.Object);
+    Item.Object = nullptr;
+    // 0은 무효 세대라 건너뛴다
+    if (++Item.SerialNumber == 0)
+    {
+        Item.SerialNumber = 1;
+    }
+    Item.NextFreeIndex = FirstFreeIndex;
+    FirstFreeIndex = Index;
+    ++NumFree;
+}
+
+void FUObjectArray::Empty()
+{
+    Chunks.Empty();
+    Chunks.Shrink();
+    NumSlots = 0;
+    NumFree = 0;
+    FirstFreeIndex = -1;
+    ObjectIndices = TMap<const UObject*, int32>();
+    ReserveNullSlot();
+}
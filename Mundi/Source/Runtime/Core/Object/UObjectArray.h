@@ -0,0 +1,88 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+class UObject;
+
+/** GUObjectArray 슬롯 하나 */
+struct FUObjectItem
+{
+    UObject* Object = nullptr;
+    // 슬롯이 비워질 때마다 증가 (0은 "무효"로 예약, 약참조가 파괴된 객체를 알아내는 기준)
+    uint32 SerialNumber = 1;
+    // 빈 슬롯일 때 다음 빈 슬롯 인덱스 (-1이면 끝)
+    int32 NextFreeIndex = -1;
+};
+
+/**
+ * 모든 UObject를 담는 청크 배열
+ * - 청크는 한 번 할당되면 옮기지 않으므로 슬롯 주소가 고정된다
+ * - 삭제된 슬롯은 프리 리스트로 재사용하고 세대(SerialNumber)를 올려 이전 약참조를 무효화한다
+ * - 인덱스는 재번호되지 않으므로 InternalIndex(ID 버퍼 피킹)가 객체 수명 동안 유지된다
+ * - 0번 슬롯은 ID 버퍼의 "선택 없음" 값이라 비워 둔다
+ * - 주소 → 슬롯 맵이 있어 이미 해제됐을 수도 있는 포인터도 역참조 없이 살아 있는지 확인할 수 있다
+ */
+class FUObjectArray
+{
+public:
+    static constexpr int32 NumElementsPerChunk = 16 * 1024;
+
+    FUObjectArray();
+
+    /** 빈 슬롯(없으면 끝)에 등록하고 인덱스를 반환 */
+    int32 Allocate(UObject* Object);
+    /** 슬롯을 비우고 세대를 올린다 */
+    void Free(int32 Index);
+    /** 모든 슬롯과 프리 리스트 초기화 (객체 삭제는 호출자 책임) */
+    void Empty();
+
+    /** 지금까지 사용된 슬롯 수 (순회 상한, 빈 슬롯 포함) */
+    int32 Num() const { return NumSlots; }
+    /** 살아 있는 객체 수 */
+    int32 NumLive() const { return NumSlots - NumFree - 1; }
+    int32 GetChunkCount() const { return Chunks.Num(); }
+
+    bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < NumSlots; }
+
+    /** Object가 등록된 슬롯 인덱스 (없으면 -1). 포인터를 역참조하지 않는다 */
+    int32 FindIndex(const UObject* Object) const
+    {
+        const int32* Index = ObjectIndices.Find(Object);
+        return Index ? *Index : -1;
+    }
+
+    UObject* operator[](int32 Index) const { return GetItem(Index).Object; }
+    uint32 GetSerialNumber(int32 Index) const { return GetItem(Index).SerialNumber; }
+
+    /** Index 슬롯이 아직 SerialNumber 세대의 객체를 들고 있는지 (O(1)) */
+    bool IsValid(int32 Index, uint32 SerialNumber) const
+    {
+        if (!IsValidIndex(Index))
+        {
+            return false;
+        }
+        const FUObjectItem& Item = GetItem(Index);
+        return Item.SerialNumber == SerialNumber && Item.Object != nullptr;
+    }
+
+private:
+    FUObjectItem& GetItem(int32 Index)
+    {
+        return Chunks[Index / NumElementsPerChunk][Index % NumElementsPerChunk];
+    }
+    const FUObjectItem& GetItem(int32 Index) const
+    {
+        return Chunks[Index / NumElementsPerChunk][Index % NumElementsPerChunk];
+    }
+
+    void ReserveNullSlot();
+    int32 AllocateSlot(UObject* Object);
+
+    TArray<std::unique_ptr<FUObjectItem[]>> Chunks;
+    int32 NumSlots = 0;
+    int32 NumFree = 0;
+    int32 FirstFreeIndex = -1;
+    // 살아 있는 객체 주소 → 슬롯 인덱스
+    TMap<const UObject*, int32> ObjectIndices;
+};
+
+extern FUObjectArray GUObjectArray;
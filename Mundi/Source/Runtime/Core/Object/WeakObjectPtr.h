@@ -0,0 +1,70 @@
+﻿#pragma once
+#include "UObjectArray.h"
+
+// GUObjectArray 슬롯 인덱스 + 세대로 객체를 가리키는 약참조
+// - IsValid()는 슬롯 세대 비교 한 번 (O(1)), 객체가 삭제되면 슬롯 세대가 올라가 자동으로 무효가 된다
+// - 슬롯이 다른 객체로 재사용돼도 세대가 달라 옛 약참조가 새 객체를 가리키지 않는다
+// - GUObjectArray에 등록되지 않은 객체(InternalIndex 없음)는 null로 취급
+template<typename T>
+class TWeakObjectPtr
+{
+public:
+    using ElementType = T;
+
+    TWeakObjectPtr() = default;
+    TWeakObjectPtr(std::nullptr_t) {}
+    explicit TWeakObjectPtr(const T* InPtr) { Reset(InPtr); }
+
+    TWeakObjectPtr& operator=(const T* InPtr)
+    {
+        Reset(InPtr);
+        return *this;
+    }
+
+    bool IsValid() const { return GUObjectArray.IsValid(ObjectIndex, SerialNumber); }
+    T* Get() const { return IsValid() ? static_cast<T*>(GUObjectArray[ObjectIndex]) : nullptr; }
+    void Reset() { ObjectIndex = -1; SerialNumber = 0; }
+
+    T& operator*() const { return *Get(); }
+    T* operator->() const { return Get(); }
+    explicit operator bool() const { return IsValid(); }
+
+    bool operator==(const TWeakObjectPtr& Other) const { return ObjectIndex == Other.ObjectIndex && SerialNumber == Other.SerialNumber; }
+    bool operator!=(const TWeakObjectPtr& Other) const { return !(*this == Other); }
+
+    int32 GetObjectIndex() const { return ObjectIndex; }
+    uint32 GetSerialNumber() const { return SerialNumber; }
+
+private:
+    void Reset(const T* InPtr)
+    {
+        Reset();
+        if (!InPtr || InPtr->InternalIndex == UINT32_MAX)
+        {
+            return;
+        }
+
+        const int32 Index = static_cast<int32>(InPtr->InternalIndex);
+        if (GUObjectArray.IsValidIndex(Index) && GUObjectArray[Index] == InPtr)
+        {
+            ObjectIndex = Index;
+            SerialNumber = GUObjectArray.GetSerialNumber(Index);
+        }
+    }
+
+    int32 ObjectIndex = -1;
+    uint32 SerialNumber = 0;
+};
+
+namespace std {
+    template <typename T>
+    struct hash<TWeakObjectPtr<T>>
+    {
+        size_t operator()(const TWeakObjectPtr<T>& Key) const noexcept
+        {
+            // 삭제된 뒤에도 키 해시가 바뀌지 않도록 포인터가 아니라 인덱스/세대로 계산
+            const uint64 Packed = (static_cast<uint64>(Key.GetSerialNumber()) << 32) | static_cast<uint32>(Key.GetObjectIndex());
+            return hash<uint64>()(Packed);
+        }
+    };
+}
@@ -203,14 +203,18 @@ void FCrashHandler::InjectCrash()
 void FCrashHandler::Crash()
 {
     if (!bCrashInjection) { return; }
-    TArray<UObject*>& ObjectArray = GUObjectArray;
-    if (ObjectArray.Num() == 0) return;
+    FUObjectArray& ObjectArray = GUObjectArray;
+    if (ObjectArray.NumLive() == 0) return;
 
     bool bCrashInjected = false;
     while (!bCrashInjected)
     {
         int32 RandomIndex = rand() % ObjectArray.Num();
         UObject* Victim = ObjectArray[RandomIndex];
+        if (!Victim)
+        {
+            continue; // 빈 슬롯
+        }
 
         void** VTablePtr = reinterpret_cast<void**>(Victim);
         if (*VTablePtr == reinterpret_cast<void*>(0xDEADBEEFDEADBEEF))
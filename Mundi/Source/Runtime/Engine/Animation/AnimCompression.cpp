@@ -0,0 +1,518 @@
+﻿#include "pch.h"
+#include "AnimCompression.h"
+#include "AnimDateModel.h"
+
+namespace
+{
+    constexpr float QuantizeMax16 = 65535.0f;
+    constexpr float QuantizeMax15 = 32767.0f;
+    // smallest-three에서 가장 큰 성분을 뺀 나머지는 [-1/√2, 1/√2] 범위
+    constexpr float SmallestThreeRange = 0.70710678f;
+
+    // ───── 벡터 양자화 ─────
+
+    uint16 QuantizeUnit16(float Value, float Min, float Extent)
+    {
+        if (Extent <= 0.0f)
+        {
+            return 0;
+        }
+        const float Normalized = FMath::Clamp((Value - Min) / Extent, 0.0f, 1.0f);
+        return static_cast<uint16>(Normalized * QuantizeMax16 + 0.5f);
+    }
+
+    FVector DecodeVectorKey(const FCompressedVectorChannel& Channel, int32 KeyIndex)
+    {
+        const uint16* Key = &Channel.Keys[KeyIndex * 3];
+        return FVector(
+            Channel.Min.X + Channel.Extent.X * (Key[0] / QuantizeMax16),
+            Channel.Min.Y + Channel.Extent.Y * (Key[1] / QuantizeMax16),
+            Channel.Min.Z + Channel.Extent.Z * (Key[2] / QuantizeMax16));
+    }
+
+    // ───── 회전 양자화 (smallest-three 48비트) ─────
+
+    void EncodeQuat(const FQuat& InQuat, uint16* OutKey)
+    {
+        FQuat Quat = InQuat;
+        Quat.Normalize();
+        float Components[4] = { Quat.X, Quat.Y, Quat.Z, Quat.W };
+
+        int32 Largest = 0;
+        for (int32 i = 1; i < 4; ++i)
+        {
+            if (std::fabs(Components[i]) > std::fabs(Components[Largest]))
+            {
+                Largest = i;
+            }
+        }
+
+        // q와 -q는 같은 회전: 가장 큰 성분을 양수로 맞추면 부호 없이 복원 가능
+        const float Sign = Components[Largest] < 0.0f ? -1.0f : 1.0f;
+
+        uint16 Packed[3];
+        int32 Out = 0;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            if (i == Largest)
+            {
+                continue;
+            }
+            const float Normalized = FMath::Clamp((Components[i] * Sign / SmallestThreeRange) * 0.5f + 0.5f, 0.0f, 1.0f);
+            Packed[Out++] = static_cast<uint16>(Normalized * QuantizeMax15 + 0.5f);
+        }
+
+        OutKey[0] = static_cast<uint16>(((Largest >> 1) << 15) | Packed[0]);
+        OutKey[1] = static_cast<uint16>(((Largest & 1) << 15) | Packed[1]);
+        OutKey[2] = Packed[2];
+    }
+
+    FQuat DecodeQuat(const uint16* Key)
+    {
+        const int32 Largest = ((Key[0] >> 15) << 1) | (Key[1] >> 15);
+        const uint16 Packed[3] = { static_cast<uint16>(Key[0] & 0x7FFF), static_cast<uint16>(Key[1] & 0x7FFF), Key[2] };
+
+        float Components[4];
+        float SumSquares = 0.0f;
+        int32 In = 0;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            if (i == Largest)
+            {
+                continue;
+            }
+            const float Value = ((Packed[In++] / QuantizeMax15) * 2.0f - 1.0f) * SmallestThreeRange;
+            Components[i] = Value;
+            SumSquares += Value * Value;
+        }
+        Components[Largest] = std::sqrt(FMath::Max(0.0f, 1.0f - SumSquares));
+
+        return FQuat(Components[0], Components[1], Components[2], Components[3]);
+    }
+
+    // ───── 샘플링 ─────
+
+    /** FrameTime을 감싸는 두 키와 보간 비율 */
+    void FindBracketingKeys(const TArray<uint16>& KeyFrames, int32 NumFrames, float FrameTime, int32& OutKey0, int32& OutKey1, float& OutAlpha)
+    {
+        const float Clamped = FMath::Clamp(FrameTime, 0.0f, static_cast<float>(NumFrames - 1));
+
+        if (KeyFrames.IsEmpty())
+        {
+            // 모든 프레임이 남아 있으면 키 인덱스 == 프레임 번호
+            OutKey0 = static_cast<int32>(Clamped);
+            OutKey1 = FMath::Min(OutKey0 + 1, NumFrames - 1);
+            OutAlpha = Clamped - static_cast<float>(OutKey0);
+            return;
+        }
+
+        // KeyFrames는 첫/마지막 프레임을 항상 포함한다
+        const auto It = std::upper_bound(KeyFrames.begin(), KeyFrames.end(), static_cast<uint16>(Clamped));
+        const int32 Upper = static_cast<int32>(It - KeyFrames.begin());
+        OutKey0 = FMath::Max(Upper - 1, 0);
+        OutKey1 = FMath::Min(Upper, KeyFrames.Num() - 1);
+
+        const float Frame0 = KeyFrames[OutKey0];
+        const float Frame1 = KeyFrames[OutKey1];
+        OutAlpha = Frame1 > Frame0 ? (Clamped - Frame0) / (Frame1 - Frame0) : 0.0f;
+    }
+
+    FVector SampleVector(const FCompressedVectorChannel& Channel, float FrameTime, const FVector& Default)
+    {
+        switch (Channel.Format)
+        {
+        case EAnimKeyFormat::Identity:
+            return Default;
+        case EAnimKeyFormat::Constant:
+            return Channel.Min;
+        default:
+            break;
+        }
+
+        int32 Key0, Key1;
+        float Alpha;
+        FindBracketingKeys(Channel.KeyFrames, Channel.NumFrames, FrameTime, Key0, Key1, Alpha);
+        const FVector Value0 = DecodeVectorKey(Channel, Key0);
+        if (Alpha <= 0.0f)
+        {
+            return Value0;
+        }
+        return FVector::Lerp(Value0, DecodeVectorKey(Channel, Key1), Alpha);
+    }
+
+    FQuat SampleRotation(const FCompressedRotationChannel& Channel, float FrameTime)
+    {
+        switch (Channel.Format)
+        {
+        case EAnimKeyFormat::Identity:
+            return FQuat::Identity();
+        case EAnimKeyFormat::Constant:
+            return Channel.Constant;
+        default:
+            break;
+        }
+
+        int32 Key0, Key1;
+        float Alpha;
+        FindBracketingKeys(Channel.KeyFrames, Channel.NumFrames, FrameTime, Key0, Key1, Alpha);
+        const FQuat Rotation0 = DecodeQuat(&Channel.Keys[Key0 * 3]);
+        if (Alpha <= 0.0f)
+        {
+            return Rotation0;
+        }
+        FQuat Result = FQuat::Slerp(Rotation0, DecodeQuat(&Channel.Keys[Key1 * 3]), Alpha);
+        Result.Normalize();
+        return Result;
+    }
+
+    // ───── 키 줄이기 ─────
+
+    /**
+     * Anchor에서 시작한 구간을 가능한 한 늘리고, 중간 키 중 하나라도 보간 오차가 Tolerance를 넘으면 직전 키를 남긴다
+     * @return 남긴 키의 프레임 번호 (첫/마지막 포함)
+     */
+    template<typename T, typename FLerp, typename FError>
+    TArray<uint16> ReduceKeys(const TArray<T>& Keys, float Tolerance, FLerp Lerp, FError Error)
+    {
+        TArray<uint16> KeptFrames;
+        const int32 NumKeys = Keys.Num();
+        KeptFrames.Add(0);
+
+        int32 Anchor = 0;
+        for (int32 End = 2; End < NumKeys; ++End)
+        {
+            bool bFits = true;
+            for (int32 Mid = Anchor + 1; Mid < End && bFits; ++Mid)
+            {
+                const float Alpha = static_cast<float>(Mid - Anchor) / static_cast<float>(End - Anchor);
+                bFits = Error(Lerp(Keys[Anchor], Keys[End], Alpha), Keys[Mid]) <= Tolerance;
+            }
+
+            if (!bFits)
+            {
+                Anchor = End - 1;
+                KeptFrames.Add(static_cast<uint16>(Anchor));
+            }
+        }
+
+        if (NumKeys > 1)
+        {
+            KeptFrames.Add(static_cast<uint16>(NumKeys - 1));
+        }
+        return KeptFrames;
+    }
+
+    float VectorError(const FVector& A, const FVector& B)
+    {
+        return (A - B).Size();
+    }
+
+    void CompressVectorChannel(const TArray<FVector>& Keys, const FVector& Default, float Tolerance, bool bReduceKeys,
+        FCompressedVectorChannel& Out, FAnimCompressionStats* Stats)
+    {
+        Out = FCompressedVectorChannel();
+        Out.NumFrames = Keys.Num();
+        if (Keys.IsEmpty())
+        {
+            Out.Format = EAnimKeyFormat::Identity;
+            if (Stats) { ++Stats->NumIdentityChannels; }
+            return;
+        }
+
+        // 1. 상수/기본값 채널 제거
+        bool bConstant = true;
+        for (const FVector& Key : Keys)
+        {
+            if (VectorError(Key, Keys[0]) > Tolerance)
+            {
+                bConstant = false;
+                break;
+            }
+        }
+        if (bConstant)
+        {
+            if (VectorError(Keys[0], Default) <= Tolerance)
+            {
+                Out.Format = EAnimKeyFormat::Identity;
+                if (Stats) { ++Stats->NumIdentityChannels; }
+            }
+            else
+            {
+                Out.Format = EAnimKeyFormat::Constant;
+                Out.Min = Keys[0];
+                if (Stats) { ++Stats->NumConstantChannels; }
+            }
+            return;
+        }
+
+        // 2. 키 줄이기 (허용 오차의 절반만 쓰고 나머지는 양자화 몫)
+        Out.Format = EAnimKeyFormat::Quantized;
+        TArray<uint16> KeptFrames;
+        if (bReduceKeys && Keys.Num() <= 0xFFFF)
+        {
+            KeptFrames = ReduceKeys(Keys, Tolerance * 0.5f,
+                [](const FVector& A, const FVector& B, float Alpha) { return FVector::Lerp(A, B, Alpha); }, VectorError);
+            if (KeptFrames.Num() < Keys.Num())
+            {
+                Out.KeyFrames = KeptFrames;
+            }
+        }
+
+        // 3. 채널 범위 기준 16비트 양자화
+        FVector Max = Keys[0];
+        Out.Min = Keys[0];
+        for (const FVector& Key : Keys)
+        {
+            Out.Min = FVector(FMath::Min(Out.Min.X, Key.X), FMath::Min(Out.Min.Y, Key.Y), FMath::Min(Out.Min.Z, Key.Z));
+            Max = FVector(FMath::Max(Max.X, Key.X), FMath::Max(Max.Y, Key.Y), FMath::Max(Max.Z, Key.Z));
+        }
+        Out.Extent = Max - Out.Min;
+
+        const int32 NumKept = Out.KeyFrames.IsEmpty() ? Keys.Num() : Out.KeyFrames.Num();
+        Out.Keys.SetNum(NumKept * 3);
+        for (int32 KeyIdx = 0; KeyIdx < NumKept; ++KeyIdx)
+        {
+            const FVector& Key = Keys[Out.KeyFrames.IsEmpty() ? KeyIdx : Out.KeyFrames[KeyIdx]];
+            Out.Keys[KeyIdx * 3 + 0] = QuantizeUnit16(Key.X, Out.Min.X, Out.Extent.X);
+            Out.Keys[KeyIdx * 3 + 1] = QuantizeUnit16(Key.Y, Out.Min.Y, Out.Extent.Y);
+            Out.Keys[KeyIdx * 3 + 2] = QuantizeUnit16(Key.Z, Out.Min.Z, Out.Extent.Z);
+        }
+
+        if (Stats)
+        {
+            ++Stats->NumQuantizedChannels;
+            Stats->NumRawKeys += Keys.Num();
+            Stats->NumKeptKeys += NumKept;
+        }
+    }
+
+    void CompressRotationChannel(const TArray<FQuat>& Keys, float Tolerance, bool bReduceKeys,
+        FCompressedRotationChannel& Out, FAnimCompressionStats* Stats)
+    {
+        Out = FCompressedRotationChannel();
+        Out.NumFrames = Keys.Num();
+        if (Keys.IsEmpty())
+        {
+            Out.Format = EAnimKeyFormat::Identity;
+            if (Stats) { ++Stats->NumIdentityChannels; }
+            return;
+        }
+
+        bool bConstant = true;
+        for (const FQuat& Key : Keys)
+        {
+            if (AnimCompression::QuatAngle(Key, Keys[0]) > Tolerance)
+            {
+                bConstant = false;
+                break;
+            }
+        }
+        if (bConstant)
+        {
+            if (AnimCompression::QuatAngle(Keys[0], FQuat::Identity()) <= Tolerance)
+            {
+                Out.Format = EAnimKeyFormat::Identity;
+                if (Stats) { ++Stats->NumIdentityChannels; }
+            }
+            else
+            {
+                Out.Format = EAnimKeyFormat::Constant;
+                Out.Constant = Keys[0];
+                Out.Constant.Normalize();
+                if (Stats) { ++Stats->NumConstantChannels; }
+            }
+            return;
+        }
+
+        Out.Format = EAnimKeyFormat::Quantized;
+        if (bReduceKeys && Keys.Num() <= 0xFFFF)
+        {
+            TArray<uint16> KeptFrames = ReduceKeys(Keys, Tolerance * 0.5f,
+                [](const FQuat& A, const FQuat& B, float Alpha)
+                {
+                    FQuat Result = FQuat::Slerp(A, B, Alpha);
+                    Result.Normalize();
+                    return Result;
+                }, AnimCompression::QuatAngle);
+            if (KeptFrames.Num() < Keys.Num())
+            {
+                Out.KeyFrames = KeptFrames;
+            }
+        }
+
+        const int32 NumKept = Out.KeyFrames.IsEmpty() ? Keys.Num() : Out.KeyFrames.Num();
+        Out.Keys.SetNum(NumKept * 3);
+        for (int32 KeyIdx = 0; KeyIdx < NumKept; ++KeyIdx)
+        {
+            EncodeQuat(Keys[Out.KeyFrames.IsEmpty() ? KeyIdx : Out.KeyFrames[KeyIdx]], &Out.Keys[KeyIdx * 3]);
+        }
+
+        if (Stats)
+        {
+            ++Stats->NumQuantizedChannels;
+            Stats->NumRawKeys += Keys.Num();
+            Stats->NumKeptKeys += NumKept;
+        }
+    }
+
+    // ───── 직렬화 ─────
+
+    void SerializeVectorChannel(FArchive& Ar, FCompressedVectorChannel& Channel)
+    {
+        Ar << Channel.Format << Channel.NumFrames << Channel.Min << Channel.Extent;
+        if (Ar.IsLoading())
+        {
+            Serialization::ReadArray(Ar, Channel.KeyFrames);
+            Serialization::ReadArray(Ar, Channel.Keys);
+        }
+        else
+        {
+            Serialization::WriteArray(Ar, Channel.KeyFrames);
+            Serialization::WriteArray(Ar, Channel.Keys);
+        }
+    }
+
+    void SerializeRotationChannel(FArchive& Ar, FCompressedRotationChannel& Channel)
+    {
+        Ar << Channel.Format << Channel.NumFrames;
+        Ar << Channel.Constant.X << Channel.Constant.Y << Channel.Constant.Z << Channel.Constant.W;
+        if (Ar.IsLoading())
+        {
+            Serialization::ReadArray(Ar, Channel.KeyFrames);
+            Serialization::ReadArray(Ar, Channel.Keys);
+        }
+        else
+        {
+            Serialization::WriteArray(Ar, Channel.KeyFrames);
+            Serialization::WriteArray(Ar, Channel.Keys);
+        }
+    }
+
+    uint64 GetChannelKeyBytes(const TArray<uint16>& KeyFrames, const TArray<uint16>& Keys)
+    {
+        return (static_cast<uint64>(KeyFrames.Num()) + static_cast<uint64>(Keys.Num())) * sizeof(uint16);
+    }
+}
+
+FTransform FCompressedAnimData::EvaluateTrack(int32 TrackIndex, float FrameTime) const
+{
+    if (TrackIndex < 0 || TrackIndex >= Tracks.Num())
+    {
+        return FTransform();
+    }
+
+    const FCompressedAnimTrack& Track = Tracks[TrackIndex];
+    return FTransform(
+        SampleVector(Track.Position, FrameTime, FVector(0.0f, 0.0f, 0.0f)),
+        SampleRotation(Track.Rotation, FrameTime),
+        SampleVector(Track.Scale, FrameTime, FVector(1.0f, 1.0f, 1.0f)));
+}
+
+uint64 FCompressedAnimData::GetAllocatedSize() const
+{
+    uint64 Bytes = sizeof(FCompressedAnimData) + sizeof(FCompressedAnimTrack) * static_cast<uint64>(Tracks.Num());
+    for (const FCompressedAnimTrack& Track : Tracks)
+    {
+        Bytes += GetChannelKeyBytes(Track.Position.KeyFrames, Track.Position.Keys);
+        Bytes += GetChannelKeyBytes(Track.Rotation.KeyFrames, Track.Rotation.Keys);
+        Bytes += GetChannelKeyBytes(Track.Scale.KeyFrames, Track.Scale.Keys);
+    }
+    return Bytes;
+}
+
+void FCompressedAnimData::Serialize(FArchive& Ar)
+{
+    uint32 NumTracks = static_cast<uint32>(Tracks.Num());
+    Ar << NumTracks;
+    if (Ar.IsLoading())
+    {
+        if (NumTracks > Serialization::MAX_REASONABLE_ARRAY_SIZE)
+        {
+            throw std::runtime_error("Cache corrupt: Compressed track count is unreasonable.");
+        }
+        Tracks.SetNum(static_cast<int32>(NumTracks));
+    }
+
+    for (FCompressedAnimTrack& Track : Tracks)
+    {
+        SerializeVectorChannel(Ar, Track.Position);
+        SerializeRotationChannel(Ar, Track.Rotation);
+        SerializeVectorChannel(Ar, Track.Scale);
+    }
+}
+
+void AnimCompression::CompressTracks(const TArray<FBoneAnimationTrack>& RawTracks, const FAnimCompressionSettings& Settings,
+    FCompressedAnimData& OutData, FAnimCompressionStats* OutStats)
+{
+    if (OutStats)
+    {
+        *OutStats = FAnimCompressionStats();
+    }
+
+    OutData.Tracks.SetNum(RawTracks.Num());
+    for (int32 TrackIdx = 0; TrackIdx < RawTracks.Num(); ++TrackIdx)
+    {
+        const FRawAnimSequenceTrack& Raw = RawTracks[TrackIdx].InternalTrack;
+        FCompressedAnimTrack& Track = OutData.Tracks[TrackIdx];
+
+        CompressVectorChannel(Raw.PosKeys, FVector(0.0f, 0.0f, 0.0f), Settings.PositionTolerance, Settings.bReduceKeys, Track.Position, OutStats);
+        CompressRotationChannel(Raw.RotKeys, Settings.RotationTolerance, Settings.bReduceKeys, Track.Rotation, OutStats);
+        CompressVectorChannel(Raw.ScaleKeys, FVector(1.0f, 1.0f, 1.0f), Settings.ScaleTolerance, Settings.bReduceKeys, Track.Scale, OutStats);
+    }
+
+    if (OutStats)
+    {
+        OutStats->RawBytes = GetRawSize(RawTracks);
+        OutStats->CompressedBytes = OutData.GetAllocatedSize();
+        MeasureError(RawTracks, OutData, *OutStats);
+    }
+}
+
+void AnimCompression::MeasureError(const TArray<FBoneAnimationTrack>& RawTracks, const FCompressedAnimData& Data, FAnimCompressionStats& InOutStats)
+{
+    const int32 NumTracks = FMath::Min(RawTracks.Num(), Data.Tracks.Num());
+    for (int32 TrackIdx = 0; TrackIdx < NumTracks; ++TrackIdx)
+    {
+        const FRawAnimSequenceTrack& Raw = RawTracks[TrackIdx].InternalTrack;
+        const FCompressedAnimTrack& Track = Data.Tracks[TrackIdx];
+
+        for (int32 Frame = 0; Frame < Raw.PosKeys.Num(); ++Frame)
+        {
+            const FVector Sampled = SampleVector(Track.Position, static_cast<float>(Frame), FVector(0.0f, 0.0f, 0.0f));
+            InOutStats.MaxPositionError = FMath::Max(InOutStats.MaxPositionError, VectorError(Sampled, Raw.PosKeys[Frame]));
+        }
+        for (int32 Frame = 0; Frame < Raw.RotKeys.Num(); ++Frame)
+        {
+            const FQuat Sampled = SampleRotation(Track.Rotation, static_cast<float>(Frame));
+            InOutStats.MaxRotationError = FMath::Max(InOutStats.MaxRotationError, QuatAngle(Sampled, Raw.RotKeys[Frame]));
+        }
+        for (int32 Frame = 0; Frame < Raw.ScaleKeys.Num(); ++Frame)
+        {
+            const FVector Sampled = SampleVector(Track.Scale, static_cast<float>(Frame), FVector(1.0f, 1.0f, 1.0f));
+            InOutStats.MaxScaleError = FMath::Max(InOutStats.MaxScaleError, VectorError(Sampled, Raw.ScaleKeys[Frame]));
+        }
+    }
+}
+
+uint64 AnimCompression::GetRawSize(const TArray<FBoneAnimationTrack>& RawTracks)
+{
+    uint64 Bytes = sizeof(FBoneAnimationTrack) * static_cast<uint64>(RawTracks.Num());
+    for (const FBoneAnimationTrack& Track : RawTracks)
+    {
+        Bytes += sizeof(FVector) * static_cast<uint64>(Track.InternalTrack.PosKeys.Num());
+        Bytes += sizeof(FQuat) * static_cast<uint64>(Track.InternalTrack.RotKeys.Num());
+        Bytes += sizeof(FVector) * static_cast<uint64>(Track.InternalTrack.ScaleKeys.Num());
+    }
+    return Bytes;
+}
+
+float AnimCompression::QuatAngle(const FQuat& A, const FQuat& B)
+{
+    const float LengthProduct = std::sqrt(FQuat::Dot(A, A) * FQuat::Dot(B, B));
+    if (LengthProduct <= KINDA_SMALL_NUMBER)
+    {
+        return 0.0f;
+    }
+    const float CosHalf = FMath::Min(std::fabs(FQuat::Dot(A, B)) / LengthProduct, 1.0f);
+    return 2.0f * std::acos(CosHalf);
+}
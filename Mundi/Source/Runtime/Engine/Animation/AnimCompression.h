@@ -0,0 +1,97 @@
+﻿#pragma once
+
+struct FBoneAnimationTrack;
+
+/**
+ * @brief 애니메이션 키 압축 설정 (임포트 시 적용)
+ * 허용 오차 안에서 상수/기본값 채널을 없애고, 선형 보간으로 복원되는 키를 줄인 뒤 남은 키를 양자화한다
+ */
+struct FAnimCompressionSettings
+{
+    bool bEnabled = true;
+    bool bReduceKeys = true;            // 앞뒤 키 보간으로 복원되는 중간 키 제거
+    float PositionTolerance = 0.001f;   // 위치 허용 오차 (거리)
+    float RotationTolerance = 0.001f;   // 회전 허용 오차 (라디안)
+    float ScaleTolerance = 0.001f;      // 스케일 허용 오차
+};
+
+enum class EAnimKeyFormat : uint8
+{
+    Identity,   // 기본값 (위치 0, 회전 단위, 스케일 1) - 데이터 없음
+    Constant,   // 모든 키가 같음 - 값 하나
+    Quantized,  // 키마다 48비트
+};
+
+/** 위치/스케일 채널: 축별 [Min, Min + Extent] 범위를 16비트로 양자화 */
+struct FCompressedVectorChannel
+{
+    EAnimKeyFormat Format = EAnimKeyFormat::Identity;
+    int32 NumFrames = 0;        // 원본 키 수 (샘플링 범위)
+    FVector Min;                // Constant면 그 값
+    FVector Extent;
+    TArray<uint16> KeyFrames;   // 남긴 키의 원본 프레임 번호 (비어 있으면 모든 프레임)
+    TArray<uint16> Keys;        // 키당 3개 (X, Y, Z)
+};
+
+/** 회전 채널: smallest-three 48비트 (가장 큰 성분 인덱스 2비트 + 나머지 세 성분 15비트씩) */
+struct FCompressedRotationChannel
+{
+    EAnimKeyFormat Format = EAnimKeyFormat::Identity;
+    int32 NumFrames = 0;
+    FQuat Constant;
+    TArray<uint16> KeyFrames;
+    TArray<uint16> Keys;        // 키당 3개
+};
+
+struct FCompressedAnimTrack
+{
+    FCompressedVectorChannel Position;
+    FCompressedRotationChannel Rotation;
+    FCompressedVectorChannel Scale;
+};
+
+/** 압축 결과 통계 (원본 대비 메모리, 채널 분류, 모든 프레임에서 잰 최대 오차) */
+struct FAnimCompressionStats
+{
+    uint64 RawBytes = 0;
+    uint64 CompressedBytes = 0;
+    int32 NumIdentityChannels = 0;
+    int32 NumConstantChannels = 0;
+    int32 NumQuantizedChannels = 0;
+    int32 NumRawKeys = 0;       // 양자화 채널의 원본 키 수
+    int32 NumKeptKeys = 0;      // 양자화 채널에 남은 키 수
+    float MaxPositionError = 0.0f;
+    float MaxRotationError = 0.0f; // 라디안
+    float MaxScaleError = 0.0f;
+};
+
+/**
+ * @brief 압축된 애니메이션 키 (트랙 순서는 원본 UAnimDataModel과 같다)
+ * 샘플링은 채널마다 시간을 감싸는 두 키만 디코드하므로 클립 길이와 무관하게 비용이 일정하다
+ */
+class FCompressedAnimData
+{
+public:
+    TArray<FCompressedAnimTrack> Tracks;
+
+    /** @param FrameTime 프레임 단위 시간 (초 * FrameRate) */
+    FTransform EvaluateTrack(int32 TrackIndex, float FrameTime) const;
+
+    uint64 GetAllocatedSize() const;
+    void Serialize(FArchive& Ar);
+};
+
+namespace AnimCompression
+{
+    /** 원본 트랙을 압축한다. OutStats가 있으면 메모리와 최대 오차까지 채운다 */
+    void CompressTracks(const TArray<FBoneAnimationTrack>& RawTracks, const FAnimCompressionSettings& Settings,
+        FCompressedAnimData& OutData, FAnimCompressionStats* OutStats = nullptr);
+
+    /** 원본의 모든 프레임에서 압축 데이터와의 최대 오차를 잰다 */
+    void MeasureError(const TArray<FBoneAnimationTrack>& RawTracks, const FCompressedAnimData& Data, FAnimCompressionStats& InOutStats);
+
+    uint64 GetRawSize(const TArray<FBoneAnimationTrack>& RawTracks);
+
+    /** 두 회전 사이 각도 (라디안, q와 -q는 같은 회전) */
+    float QuatAngle(const FQuat& A, const FQuat& B);
+}
@@ -1,5 +1,7 @@
 ﻿#include "pch.h"
 #include "AnimDateModel.h"
+#include "AnimCompression.h"
+#include "AnimationRuntime.h"
 //#include "Math/MathUtility.h"
 
 IMPLEMENT_CLASS(UAnimDataModel)
@@ -13,11 +15,15 @@ int32 UAnimDataModel::AddBoneTrack(const FName& BoneName)
         return ExistingIndex;
     }
 
+    // 압축 키는 불변이라 트랙 구성이 바뀌기 전에 원본 키로 되돌린다
+    DecompressKeys();
+
     // Create new track
     FBoneAnimationTrack NewTrack;
     NewTrack.Name = BoneName;
 
     int32 NewIndex = BoneAnimationTracks.Add(NewTrack);
+    InvalidateTrackRemaps();
     return NewIndex;
 }
 
@@ -29,7 +35,9 @@ bool UAnimDataModel::RemoveBoneTrack(const FName& BoneName)
         return false;
     }
 
+    DecompressKeys();
     BoneAnimationTracks.RemoveAt(TrackIndex);
+    InvalidateTrackRemaps();
     return true;
 }
 
@@ -73,6 +81,7 @@ bool UAnimDataModel::SetBoneTrackKeys(const FName& BoneName, const TArray<FVecto
         return false;
     }
 
+    DecompressKeys();
     Track->InternalTrack.PosKeys = PosKeys;
     Track->InternalTrack.RotKeys = RotKeys;
     Track->InternalTrack.ScaleKeys = ScaleKeys;
@@ -88,6 +97,17 @@ bool UAnimDataModel::GetBoneTrackTransform(const FName& BoneName, int32 KeyIndex
         return false;
     }
 
+    if (CompressedKeys)
+    {
+        if (KeyIndex < 0)
+        {
+            return false;
+        }
+        // 프레임 번호 == 키 번호 (범위를 넘으면 마지막 키)
+        OutTransform = CompressedKeys->EvaluateTrack(FindBoneTrackIndex(BoneName), static_cast<float>(KeyIndex));
+        return true;
+    }
+
     const FRawAnimSequenceTrack& RawTrack = Track->InternalTrack;
 
     if (KeyIndex < 0)
@@ -132,11 +152,16 @@ bool UAnimDataModel::GetBoneTrackTransform(const FName& BoneName, int32 KeyIndex
 
 FTransform UAnimDataModel::EvaluateBoneTrackTransform(const FName& BoneName, float Time, bool bInterpolate) const
 {
-    const FBoneAnimationTrack* Track = FindBoneTrack(BoneName);
-    if (!Track)
+    return EvaluateTrackTransform(FindBoneTrackIndex(BoneName), Time, bInterpolate);
+}
+
+FTransform UAnimDataModel::EvaluateTrackTransform(int32 TrackIndex, float Time, bool bInterpolate) const
+{
+    if (TrackIndex < 0 || TrackIndex >= BoneAnimationTracks.Num())
     {
         return FTransform();
     }
+    const FBoneAnimationTrack* Track = &BoneAnimationTracks[TrackIndex];
 
     if (NumberOfFrames <= 0 || FrameRate <= 0)
     {
@@ -152,6 +177,12 @@ FTransform UAnimDataModel::EvaluateBoneTrackTransform(const FName& BoneName, flo
     // 시간을 프레임 번호로 변환
     float FrameTime = Time * static_cast<float>(FrameRate);
 
+    // 압축 키: 채널마다 앞뒤 두 키만 디코드
+    if (CompressedKeys)
+    {
+        return CompressedKeys->EvaluateTrack(TrackIndex, FrameTime);
+    }
+
     // 프레임 인덱스 계산 (KraftonGTL 방식)
     int32 FrameIndex0 = FMath::FloorToInt(FrameTime);
     int32 FrameIndex1 = FMath::CeilToInt(FrameTime);
@@ -197,4 +228,115 @@ FTransform UAnimDataModel::EvaluateBoneTrackTransform(const FName& BoneName, flo
     }
 
     return Result;
-}
\ No newline at end of file
+}
+
+const FAnimTrackRemap& UAnimDataModel::GetTrackRemap(const FSkeleton& Skeleton) const
+{
+    std::lock_guard<std::mutex> Guard(TrackRemaps.Lock);
+
+    for (const std::unique_ptr<FAnimTrackRemap>& Entry : TrackRemaps.Entries)
+    {
+        if (Entry->SkeletonLayoutId == Skeleton.LayoutId)
+        {
+            return *Entry;
+        }
+    }
+
+    // 처음 묶이는 스켈레톤: 트랙마다 한 번만 이름으로 찾는다
+    auto Remap = std::make_unique<FAnimTrackRemap>();
+    Remap->SkeletonLayoutId = Skeleton.LayoutId;
+
+    const int32 NumTracks = BoneAnimationTracks.Num();
+    const int32 NumBones = Skeleton.Bones.Num();
+    Remap->TrackToBone.SetNum(NumTracks, INDEX_NONE);
+    Remap->BoneToTrack.SetNum(NumBones, INDEX_NONE);
+    Remap->TrackLeafDepth.SetNum(NumTracks, 0);
+
+    TArray<uint8> BoneLeafDepths;
+    FAnimationRuntime::ComputeBoneLeafDepths(Skeleton, BoneLeafDepths);
+
+    for (int32 TrackIdx = 0; TrackIdx < NumTracks; ++TrackIdx)
+    {
+        const int32 BoneIdx = Skeleton.FindBoneIndex(BoneAnimationTracks[TrackIdx].Name);
+        if (BoneIdx == INDEX_NONE || BoneIdx >= NumBones)
+        {
+            continue;
+        }
+
+        Remap->TrackToBone[TrackIdx] = BoneIdx;
+        Remap->TrackLeafDepth[TrackIdx] = BoneLeafDepths[BoneIdx];
+        // 같은 본을 가리키는 트랙이 여럿이면 첫 트랙 (기존 이름 검색과 같은 결과)
+        if (Remap->BoneToTrack[BoneIdx] == INDEX_NONE)
+        {
+            Remap->BoneToTrack[BoneIdx] = TrackIdx;
+        }
+    }
+
+    TrackRemaps.Entries.Add(std::move(Remap));
+    return *TrackRemaps.Entries.back();
+}
+
+bool UAnimDataModel::CompressKeys(const FAnimCompressionSettings& Settings, FAnimCompressionStats* OutStats)
+{
+    if (!Settings.bEnabled || BoneAnimationTracks.IsEmpty())
+    {
+        return false;
+    }
+
+    // 이미 압축돼 있으면 원본으로 되돌려서 새 설정으로 다시 압축
+    DecompressKeys();
+
+    auto Compressed = std::make_shared<FCompressedAnimData>();
+    AnimCompression::CompressTracks(BoneAnimationTracks, Settings, *Compressed, OutStats);
+
+    // 원본 키는 버린다 (트랙 이름은 리맵/검색용으로 유지)
+    for (FBoneAnimationTrack& Track : BoneAnimationTracks)
+    {
+        Track.InternalTrack = FRawAnimSequenceTrack();
+    }
+    CompressedKeys = std::move(Compressed);
+    return true;
+}
+
+void UAnimDataModel::DecompressKeys()
+{
+    if (!CompressedKeys)
+    {
+        return;
+    }
+
+    const TArray<FCompressedAnimTrack>& CompressedTracks = CompressedKeys->Tracks;
+    const int32 NumTracks = FMath::Min(BoneAnimationTracks.Num(), CompressedTracks.Num());
+    for (int32 TrackIdx = 0; TrackIdx < NumTracks; ++TrackIdx)
+    {
+        const FCompressedAnimTrack& Compressed = CompressedTracks[TrackIdx];
+        FRawAnimSequenceTrack& Raw = BoneAnimationTracks[TrackIdx].InternalTrack;
+
+        Raw.PosKeys.SetNum(Compressed.Position.NumFrames);
+        Raw.RotKeys.SetNum(Compressed.Rotation.NumFrames);
+        Raw.ScaleKeys.SetNum(Compressed.Scale.NumFrames);
+        for (int32 Frame = 0; Frame < Raw.PosKeys.Num(); ++Frame)
+        {
+            Raw.PosKeys[Frame] = CompressedKeys->EvaluateTrack(TrackIdx, static_cast<float>(Frame)).Translation;
+        }
+        for (int32 Frame = 0; Frame < Raw.RotKeys.Num(); ++Frame)
+        {
+            Raw.RotKeys[Frame] = CompressedKeys->EvaluateTrack(TrackIdx, static_cast<float>(Frame)).Rotation;
+        }
+        for (int32 Frame = 0; Frame < Raw.ScaleKeys.Num(); ++Frame)
+        {
+            Raw.ScaleKeys[Frame] = CompressedKeys->EvaluateTrack(TrackIdx, static_cast<float>(Frame)).Scale3D;
+        }
+    }
+    CompressedKeys.reset();
+}
+
+void UAnimDataModel::SetCompressedKeys(std::shared_ptr<const FCompressedAnimData> InCompressedKeys)
+{
+    if (InCompressedKeys && InCompressedKeys->Tracks.Num() != BoneAnimationTracks.Num())
+    {
+        UE_LOG("UAnimDataModel: compressed track count mismatch (%d vs %d)", InCompressedKeys->Tracks.Num(), BoneAnimationTracks.Num());
+        return;
+    }
+    CompressedKeys = std::move(InCompressedKeys);
+}
@@ -1,6 +1,11 @@
 ﻿#pragma once
+#include <mutex>
 #include "Object.h"
 
+class FCompressedAnimData;
+struct FAnimCompressionSettings;
+struct FAnimCompressionStats;
+
 /**
  * @brief 애니메이션 클립이 순수 데이터 모델
  * 모든 종류의 애니메이션 데이터를 표현하는 인터페이스
@@ -24,6 +29,38 @@ struct FBoneAnimationTrack
     FRawAnimSequenceTrack InternalTrack; // 실제 애니메이션 데이터
 };
 
+/**
+ * @brief (스켈레톤, 애니메이션) 한 쌍의 트랙↔본 인덱스 리맵 테이블
+ * 매 프레임 본 이름(문자열)으로 찾던 것을 처음 한 번만 만들어 두고 인덱스로 바로 쓴다
+ */
+struct FAnimTrackRemap
+{
+    uint32 SkeletonLayoutId = 0;
+    TArray<int32> TrackToBone; // 트랙 순서 → 스켈레톤 본 인덱스 (스켈레톤에 없는 트랙은 INDEX_NONE)
+    TArray<int32> BoneToTrack; // 스켈레톤 본 순서 → 트랙 인덱스 (트랙이 없는 본은 INDEX_NONE)
+    TArray<uint8> TrackLeafDepth; // 트랙 순서 → 대상 본의 말단 깊이 (본 LOD 판정용, 스켈레톤에 없는 트랙은 0)
+};
+
+/**
+ * @brief 스켈레톤별 리맵 테이블 캐시
+ * 여러 스레드의 애니메이션 업데이트가 동시에 찾을 수 있으므로 락으로 보호하고, 항목은 힙에 둬서 반환한 참조가 유지된다
+ * 복사(Duplicate)되면 빈 캐시로 시작한다
+ */
+struct FAnimTrackRemapCache
+{
+    FAnimTrackRemapCache() = default;
+    FAnimTrackRemapCache(const FAnimTrackRemapCache&) {}
+    FAnimTrackRemapCache& operator=(const FAnimTrackRemapCache&) { Reset(); return *this; }
+
+    void Reset()
+    {
+        std::lock_guard<std::mutex> Guard(Lock);
+        Entries.Empty();
+    }
+
+    std::mutex Lock;
+    TArray<std::unique_ptr<FAnimTrackRemap>> Entries;
+};
 
 class UAnimDataModel : public UObject
 {
@@ -35,7 +72,7 @@ public:
 
 
 public:
-    // Getter functions
+    // Getter functions (키를 압축한 뒤에는 트랙 이름만 남고 원본 키 배열은 비어 있다)
     const TArray<FBoneAnimationTrack>& GetBoneAnimationTracks() const { return BoneAnimationTracks; }
     TArray<FBoneAnimationTrack>& GetBoneAnimationTracks() { return BoneAnimationTracks; }
     float GetPlayLength() const { return PlayLength; }
@@ -63,6 +100,27 @@ public:
 
     // Interpolation
     FTransform EvaluateBoneTrackTransform(const FName& BoneName, float Time, bool bInterpolate = true) const;
+    FTransform EvaluateTrackTransform(int32 TrackIndex, float Time, bool bInterpolate = true) const;
+
+    /**
+     * @brief 스켈레톤에 대한 트랙↔본 리맵 테이블 (처음 요청할 때 한 번 만들고 캐시)
+     * 트랙이 추가/삭제되거나 스켈레톤이 다시 로드되면(LayoutId 변경) 새로 만든다
+     */
+    const FAnimTrackRemap& GetTrackRemap(const FSkeleton& Skeleton) const;
+    void InvalidateTrackRemaps() { TrackRemaps.Reset(); }
+
+    // Key compression
+    /**
+     * @brief 원본 키를 압축 키로 바꾸고 원본 키 배열은 비운다 (평가는 압축 키에서 앞뒤 두 키만 디코드)
+     * @return 압축했으면 true (설정이 꺼져 있거나 트랙이 없으면 false)
+     */
+    bool CompressKeys(const FAnimCompressionSettings& Settings, FAnimCompressionStats* OutStats = nullptr);
+    /** @brief 압축 키를 모든 프레임의 원본 키로 되돌림 (트랙 편집 전에 자동으로 호출) */
+    void DecompressKeys();
+    /** @brief 캐시에서 읽은 압축 키 설정 (트랙 수와 순서가 같아야 함) */
+    void SetCompressedKeys(std::shared_ptr<const FCompressedAnimData> InCompressedKeys);
+    const FCompressedAnimData* GetCompressedKeys() const { return CompressedKeys.get(); }
+    bool HasCompressedKeys() const { return CompressedKeys != nullptr; }
 
 private:
     TArray<FBoneAnimationTrack> BoneAnimationTracks;
@@ -71,6 +129,10 @@ private:
     int32 NumberOfFrames = 0;
     int32 NumberOfKeys = 0;
 
+    mutable FAnimTrackRemapCache TrackRemaps;
+
+    // 압축 키 (불변 데이터라 Duplicate된 모델끼리 공유한다)
+    std::shared_ptr<const FCompressedAnimData> CompressedKeys;
 
     // 커브 데이터는 주로 애니메이션 블렌딩이나 애니메이션이 다른 시스템과 상호작용할 때 보조 정보로 쓰임
     // 예를 들어 UE의애니 블루프린트처럼 “달릴 때 카메라 흔들림 강도”나 “발 접촉 여부” 같은 값을 애니 커브에 넣어 두고,
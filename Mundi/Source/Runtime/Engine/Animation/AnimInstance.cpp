@@ -5,6 +5,7 @@
 #include "AnimationStateMachine.h"
 #include "AnimSequence.h"
 #include "AnimMontage.h"
+#include "AnimPoseKernels.h"
 // For notify dispatching
 #include "Source/Runtime/Engine/Animation/AnimNotify.h"
 
@@ -30,12 +31,30 @@ void UAnimInstance::Initialize(USkeletalMeshComponent* InComponent)
 
 void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
-    // 상태머신이 있으면 먼저 ProcessState 호출
+    NativeUpdateStateMachine(DeltaSeconds);
+    NativeEvaluateAnimation(DeltaSeconds);
+}
+
+void UAnimInstance::NativeUpdateStateMachine(float DeltaSeconds)
+{
     if (AnimStateMachine)
     {
         AnimStateMachine->ProcessState(DeltaSeconds);
     }
+}
 
+bool UAnimInstance::CanEvaluateInParallel() const
+{
+    // PoseProvider가 Sequence 자신이면 시퀀스 상태 (블렌드 스페이스 상태는 Sequence가 nullptr)
+    auto IsSequenceOnly = [](const FAnimationPlayState& PlayState)
+    {
+        return !PlayState.PoseProvider || PlayState.PoseProvider == static_cast<IAnimPoseProvider*>(PlayState.Sequence);
+    };
+    return IsSequenceOnly(CurrentPlayState) && IsSequenceOnly(BlendTargetState);
+}
+
+void UAnimInstance::NativeEvaluateAnimation(float DeltaSeconds)
+{
     // PoseProvider 또는 Sequence가 있어야 재생 가능
     if (!CurrentPlayState.PoseProvider && !CurrentPlayState.Sequence)
     {
@@ -59,8 +78,8 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
                     {
                         TArray<FTransform> PrevPoseRaw, CurrPoseRaw;
                         TArray<FTransform> PrevPoseMapped, CurrPoseMapped;
-                        PrevSeq->EvaluatePose(MontageState->PreviousSectionEndTime, DeltaSeconds, PrevPoseRaw);
-                        CurrentSeq->EvaluatePose(MontageState->Position, DeltaSeconds, CurrPoseRaw);
+                        ExtractPose(PrevSeq, MontageState->PreviousSectionEndTime, DeltaSeconds, PrevPoseRaw);
+                        ExtractPose(CurrentSeq, MontageState->Position, DeltaSeconds, CurrPoseRaw);
 
                         // 스켈레톤 순서로 변환
                         MapPoseToSkeleton(PrevPoseRaw, PrevSeq, PrevPoseMapped);
@@ -75,14 +94,14 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
                     else
                     {
                         TArray<FTransform> RawPose;
-                        CurrentSeq->EvaluatePose(MontageState->Position, DeltaSeconds, RawPose);
+                        ExtractPose(CurrentSeq, MontageState->Position, DeltaSeconds, RawPose);
                         MapPoseToSkeleton(RawPose, CurrentSeq, FinalPose);
                     }
                 }
                 else
                 {
                     TArray<FTransform> RawPose;
-                    CurrentSeq->EvaluatePose(MontageState->Position, DeltaSeconds, RawPose);
+                    ExtractPose(CurrentSeq, MontageState->Position, DeltaSeconds, RawPose);
                     MapPoseToSkeleton(RawPose, CurrentSeq, FinalPose);
                 }
 
@@ -178,8 +197,8 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
                 {
                     TArray<FTransform> PrevPoseRaw, CurrPoseRaw;
                     TArray<FTransform> PrevPoseMapped, CurrPoseMapped;
-                    PrevSeq->EvaluatePose(MontageState->PreviousSectionEndTime, DeltaSeconds, PrevPoseRaw);
-                    CurrentSeq->EvaluatePose(MontageState->Position, DeltaSeconds, CurrPoseRaw);
+                    ExtractPose(PrevSeq, MontageState->PreviousSectionEndTime, DeltaSeconds, PrevPoseRaw);
+                    ExtractPose(CurrentSeq, MontageState->Position, DeltaSeconds, CurrPoseRaw);
 
                     // 스켈레톤 순서로 변환
                     MapPoseToSkeleton(PrevPoseRaw, PrevSeq, PrevPoseMapped);
@@ -194,14 +213,14 @@ void UAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
                 else
                 {
                     TArray<FTransform> RawPose;
-                    CurrentSeq->EvaluatePose(MontageState->Position, DeltaSeconds, RawPose);
+                    ExtractPose(CurrentSeq, MontageState->Position, DeltaSeconds, RawPose);
                     MapPoseToSkeleton(RawPose, CurrentSeq, MontagePose);
                 }
             }
             else
             {
                 TArray<FTransform> RawPose;
-                CurrentSeq->EvaluatePose(MontageState->Position, DeltaSeconds, RawPose);
+                ExtractPose(CurrentSeq, MontageState->Position, DeltaSeconds, RawPose);
                 MapPoseToSkeleton(RawPose, CurrentSeq, MontagePose);
             }
 
@@ -455,60 +474,12 @@ void UAnimInstance::TriggerAnimNotifies(float DeltaSeconds)
 
     NotifySequence->GetAnimNotify(PrevTime, DeltaMove, PendingNotifies);
 
-    // 수집된 노티파이 처리
-    for (const FPendingAnimNotify& Pending : PendingNotifies)
+    // 바로 실행하지 않고 컴포넌트 큐에 쌓는다 (포즈 평가가 워커 스레드에서 돌 수 있으므로)
+    // 실행은 게임 스레드에서 USkeletalMeshComponent::DispatchAnimNotifies가 담당
+    if (OwningComponent)
     {
-        const FAnimNotifyEvent& Event = *Pending.Event;
-
-        //UE_LOG("AnimNotify Triggered: %s at %.2f (Type: %d)",
-        //    Event.NotifyName.ToString().c_str(), Event.TriggerTime, (int)Pending.Type);
-
-        // Dispatch to notifies using the same policy as SkeletalMeshComponent
-        if (OwningComponent)
-        {
-            switch (Pending.Type)
-            {
-            case EPendingNotifyType::Trigger:
-                if (Event.Notify)
-                {
-                    Event.Notify->Notify(OwningComponent, NotifySequence);
-                }
-                break;
-            case EPendingNotifyType::StateBegin:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyBegin(OwningComponent, NotifySequence, Event.Duration);
-                }
-                break;
-            case EPendingNotifyType::StateTick:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyTick(OwningComponent, NotifySequence, Event.Duration);
-                }
-                break;
-            case EPendingNotifyType::StateEnd:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyEnd(OwningComponent, NotifySequence, Event.Duration);
-                }
-                break;
-            default:
-                break;
-            }
-        }
-
-        // TODO: 노티파이 타입별 처리
-        // switch (Pending.Type)
-        // {
-        //     case EAnimNotifyEventType::Begin:
-        //         // 노티파이 시작
-        //         break;
-        //     case EAnimNotifyEventType::End:
-        //         // 노티파이 종료
-        //         break;
-        // }
+        OwningComponent->QueueAnimNotifies(PendingNotifies, NotifySequence);
     }
-
 }
 
 void UAnimInstance::UpdateAnimationCurves()
@@ -557,8 +528,7 @@ void UAnimInstance::EvaluatePoseForState(const FAnimationPlayState& PlayState, T
         OutPose.SetNum(NumBones);
 
         // const_cast 필요: EvaluatePose가 non-const (내부 상태 변경 가능)
-        const_cast<IAnimPoseProvider*>(PlayState.PoseProvider)->EvaluatePose(
-            PlayState.CurrentTime, DeltaTime, OutPose);
+        ExtractPose(const_cast<IAnimPoseProvider*>(PlayState.PoseProvider), PlayState.CurrentTime, DeltaTime, OutPose);
         return;
     }
 
@@ -578,12 +548,29 @@ void UAnimInstance::EvaluatePoseForState(const FAnimationPlayState& PlayState, T
     OutPose.SetNum(NumBones);
 
     FAnimExtractContext ExtractContext(PlayState.CurrentTime, PlayState.bIsLooping);
+    if (BoneLODStripDepth > 0 && CurrentSkeleton)
+    {
+        ExtractContext.BoneLODSkeleton = CurrentSkeleton;
+        ExtractContext.BoneLODStripDepth = BoneLODStripDepth;
+    }
     FPoseContext PoseContext(NumBones);
     PlayState.Sequence->GetAnimationPose(PoseContext, ExtractContext);
 
     OutPose = PoseContext.Pose;
 }
 
+void UAnimInstance::ExtractPose(IAnimPoseProvider* Provider, float Time, float DeltaTime, TArray<FTransform>& OutPose) const
+{
+    if (BoneLODStripDepth > 0 && CurrentSkeleton)
+    {
+        Provider->EvaluatePoseWithBoneLOD(Time, DeltaTime, *CurrentSkeleton, BoneLODStripDepth, OutPose);
+    }
+    else
+    {
+        Provider->EvaluatePose(Time, DeltaTime, OutPose);
+    }
+}
+
 void UAnimInstance::AdvancePlayState(FAnimationPlayState& PlayState, float DeltaSeconds)
 {
     // PoseProvider 또는 Sequence가 있어야 재생 가능
@@ -642,20 +629,8 @@ void UAnimInstance::BlendPoseArrays(const TArray<FTransform>& FromPose, const TA
     const float ClampedAlpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
     OutPose.SetNum(NumBones);
 
-    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
-    {
-        const FTransform& From = FromPose[BoneIndex];
-        const FTransform& To = ToPose[BoneIndex];
-
-        FTransform Result;
-        //Result.Lerp(From,To,ClampedAlpha);
-        Result.Translation = FMath::Lerp(From.Translation, To.Translation, ClampedAlpha);
-        Result.Scale3D = FMath::Lerp(From.Scale3D, To.Scale3D, ClampedAlpha);
-        Result.Rotation = FQuat::Slerp(From.Rotation, To.Rotation, ClampedAlpha);
-        Result.Rotation.Normalize();
-
-        OutPose[BoneIndex] = Result;
-    }
+    // 본 4개씩 SSE로 섞는다 (회전은 최단 호 nlerp)
+    AnimPoseKernels::BlendTransforms(FromPose.data(), ToPose.data(), ClampedAlpha, OutPose.data(), NumBones);
 }
 
 void UAnimInstance::GetPoseForLayer(int32 LayerIndex, TArray<FTransform>& OutPose,float DeltaSeconds)
@@ -1038,46 +1013,10 @@ void UAnimInstance::TriggerMontageNotifies(float DeltaSeconds)
 
     UAnimSequence* CurrentSeq = Montage->GetSectionSequence(MontageState->CurrentSectionIndex);
 
-    // 노티파이 처리
-    for (const FPendingAnimNotify& Pending : PendingNotifies)
+    // 시퀀스 노티파이와 같은 큐에 쌓아서 발생 순서대로 게임 스레드에서 실행
+    if (OwningComponent)
     {
-        const FAnimNotifyEvent& Event = *Pending.Event;
-
-        // UE_LOG("[TriggerMontageNotifies] Montage Notify Triggered: %s at %.4f",
-        //     Event.NotifyName.ToString().c_str(), Event.TriggerTime);
-
-        if (OwningComponent)
-        {
-            switch (Pending.Type)
-            {
-            case EPendingNotifyType::Trigger:
-                if (Event.Notify)
-                {
-                    Event.Notify->Notify(OwningComponent, CurrentSeq);
-                }
-                break;
-            case EPendingNotifyType::StateBegin:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyBegin(OwningComponent, CurrentSeq, Event.Duration);
-                }
-                break;
-            case EPendingNotifyType::StateTick:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyTick(OwningComponent, CurrentSeq, Event.Duration);
-                }
-                break;
-            case EPendingNotifyType::StateEnd:
-                if (Event.NotifyState)
-                {
-                    Event.NotifyState->NotifyEnd(OwningComponent, CurrentSeq, Event.Duration);
-                }
-                break;
-            default:
-                break;
-            }
-        }
+        OwningComponent->QueueAnimNotifies(PendingNotifies, CurrentSeq);
     }
 }
 
@@ -1101,7 +1040,7 @@ void UAnimInstance::MapPoseToSkeleton(const TArray<FTransform>& InPose, UAnimSeq
     }
 
     const int32 NumSkeletonBones = CurrentSkeleton->Bones.Num();
-    const TArray<FBoneAnimationTrack>& Tracks = DataModel->GetBoneAnimationTracks();
+    const TArray<int32>& TrackToBone = DataModel->GetTrackRemap(*CurrentSkeleton).TrackToBone;
 
     // 스켈레톤 본 개수로 초기화 (Identity로, 애니메이션이 덮어씀)
     OutPose.SetNum(NumSkeletonBones);
@@ -1110,11 +1049,12 @@ void UAnimInstance::MapPoseToSkeleton(const TArray<FTransform>& InPose, UAnimSeq
         OutPose[i] = FTransform();
     }
 
-    // 애니메이션 트랙을 본 이름으로 매핑
-    for (int32 TrackIdx = 0; TrackIdx < Tracks.Num() && TrackIdx < InPose.Num(); ++TrackIdx)
+    // 애니메이션 트랙을 캐시된 리맵 테이블로 매핑
+    const int32 NumTracks = FMath::Min(TrackToBone.Num(), InPose.Num());
+    for (int32 TrackIdx = 0; TrackIdx < NumTracks; ++TrackIdx)
     {
-        int32 BoneIdx = CurrentSkeleton->FindBoneIndex(Tracks[TrackIdx].Name);
-        if (BoneIdx != INDEX_NONE && BoneIdx < NumSkeletonBones)
+        const int32 BoneIdx = TrackToBone[TrackIdx];
+        if (BoneIdx != INDEX_NONE)
         {
             OutPose[BoneIdx] = InPose[TrackIdx];
         }
@@ -1142,50 +1082,21 @@ void UAnimInstance::BlendPosesByBoneName(
         OutPose[i] = FTransform();
     }
 
-    // From 애니메이션 트랙 정보
+    // 본 순서 → 트랙 인덱스 (캐시된 리맵 테이블, 시퀀스가 없으면 비어 있음)
     UAnimDataModel* FromModel = FromSeq ? FromSeq->GetDataModel() : nullptr;
-    const TArray<FBoneAnimationTrack>* FromTracks = FromModel ? &FromModel->GetBoneAnimationTracks() : nullptr;
-
-    // To 애니메이션 트랙 정보
     UAnimDataModel* ToModel = ToSeq ? ToSeq->GetDataModel() : nullptr;
-    const TArray<FBoneAnimationTrack>* ToTracks = ToModel ? &ToModel->GetBoneAnimationTracks() : nullptr;
+    const TArray<int32>* FromBoneToTrack = FromModel ? &FromModel->GetTrackRemap(*CurrentSkeleton).BoneToTrack : nullptr;
+    const TArray<int32>* ToBoneToTrack = ToModel ? &ToModel->GetTrackRemap(*CurrentSkeleton).BoneToTrack : nullptr;
 
     // 각 스켈레톤 본에 대해 블렌딩
     for (int32 BoneIdx = 0; BoneIdx < NumSkeletonBones; ++BoneIdx)
     {
-        const FString& BoneName = CurrentSkeleton->Bones[BoneIdx].Name;
-        FTransform FromTransform = FTransform();
-        FTransform ToTransform = FTransform();
-        bool bFoundFrom = false;
-        bool bFoundTo = false;
-
-        // From 애니메이션에서 본 찾기
-        if (FromTracks)
-        {
-            for (int32 t = 0; t < FromTracks->Num() && t < FromPose.Num(); ++t)
-            {
-                if ((*FromTracks)[t].Name.ToString() == BoneName)
-                {
-                    FromTransform = FromPose[t];
-                    bFoundFrom = true;
-                    break;
-                }
-            }
-        }
-
-        // To 애니메이션에서 본 찾기
-        if (ToTracks)
-        {
-            for (int32 t = 0; t < ToTracks->Num() && t < ToPose.Num(); ++t)
-            {
-                if ((*ToTracks)[t].Name.ToString() == BoneName)
-                {
-                    ToTransform = ToPose[t];
-                    bFoundTo = true;
-                    break;
-                }
-            }
-        }
+        const int32 FromTrack = FromBoneToTrack ? (*FromBoneToTrack)[BoneIdx] : INDEX_NONE;
+        const int32 ToTrack = ToBoneToTrack ? (*ToBoneToTrack)[BoneIdx] : INDEX_NONE;
+        const bool bFoundFrom = FromTrack != INDEX_NONE && FromTrack < FromPose.Num();
+        const bool bFoundTo = ToTrack != INDEX_NONE && ToTrack < ToPose.Num();
+        const FTransform FromTransform = bFoundFrom ? FromPose[FromTrack] : FTransform();
+        const FTransform ToTransform = bFoundTo ? ToPose[ToTrack] : FTransform();
 
         // 블렌딩
         if (bFoundFrom && bFoundTo)
@@ -133,11 +133,32 @@ public:
     // ============================================================
 
     /**
-     * @brief 애니메이션 업데이트 (매 프레임 호출)
+     * @brief 애니메이션 업데이트 (매 프레임 호출) = NativeUpdateStateMachine + NativeEvaluateAnimation
      * @param DeltaSeconds 프레임 시간
      */
     virtual void NativeUpdateAnimation(float DeltaSeconds);
 
+    /**
+     * @brief 상태머신 단계 (상태 OnUpdate + 전이 조건)
+     * @note 항상 게임 스레드에서 호출된다. 블루프린트 콜백이 인스턴스끼리 공유하는 그래프 노드와
+     *       블렌드 스페이스 파라미터를 쓰므로 워커 스레드에서 부르면 안 된다.
+     */
+    virtual void NativeUpdateStateMachine(float DeltaSeconds);
+
+    /**
+     * @brief 포즈 단계 (시간 진행, 추출, 블렌딩, 몽타주, 노티파이 수집, 커브)
+     * @note CanEvaluateInParallel()이 true면 월드의 애니메이션 업데이트 단계에서 워커 스레드로 호출된다.
+     *       소유 컴포넌트 밖의 상태를 건드리지 말고, 노티파이는 큐에만 쌓는다.
+     */
+    void NativeEvaluateAnimation(float DeltaSeconds);
+
+    /**
+     * @brief 포즈 단계를 워커 스레드에서 돌려도 되는가
+     * - 재생 중/블렌드 대상 상태가 시퀀스만 쓰면 true (시퀀스 샘플링은 읽기 전용)
+     * - 블렌드 스페이스는 파라미터와 재생 시간을 에셋 자체에 두므로 같은 에셋을 쓰는 인스턴스끼리 겹치면 안 된다
+     */
+    bool CanEvaluateInParallel() const;
+
     /**
      * @brief 현재 포즈를 평가하여 반환
      * @param OutPose 출력 포즈
@@ -209,12 +230,19 @@ public:
     // 상/하체 분리 설정
     void EnableUpperBodySplit(FName BoneName);
 
+    /**
+     * @brief 본 LOD 설정 (말단 깊이가 StripDepth 미만인 본은 트랙 추출을 건너뜀, 0이면 전체)
+     * @note 건너뛴 본의 출력은 의미가 없으므로 컴포넌트가 SetAnimationPose에서 그 본을 멈춰 둔다
+     */
+    void SetBoneLODStripDepth(int32 InStripDepth) { BoneLODStripDepth = InStripDepth; }
+    int32 GetBoneLODStripDepth() const { return BoneLODStripDepth; }
+
     // ============================================================
     // Notify & Curve Processing
     // ============================================================
 
     /**
-     * @brief 애니메이션 노티파이 트리거
+     * @brief 이번 프레임 구간의 노티파이를 소유 컴포넌트의 큐에 수집 (실행은 DispatchAnimNotifies)
      * @param DeltaSeconds 프레임 시간
      */
     void TriggerAnimNotifies(float DeltaSeconds);
@@ -320,6 +348,8 @@ protected:
     // PlayState 헬퍼
     void EvaluatePoseForState(const FAnimationPlayState& PlayState, TArray<FTransform>& OutPose, float DeltaTime = 0.0f) const;
     void AdvancePlayState(FAnimationPlayState& PlayState, float DeltaSeconds);
+    /** 포즈 제공자 평가 (본 LOD가 켜져 있으면 말단 본 트랙은 건너뜀) */
+    void ExtractPose(IAnimPoseProvider* Provider, float Time, float DeltaTime, TArray<FTransform>& OutPose) const;
     void BlendPoseArrays(const TArray<FTransform>& FromPose, const TArray<FTransform>& ToPose, float Alpha, TArray<FTransform>& OutPose) const;
     void GetPoseForLayer(int32 LayerIndex, TArray<FTransform>& OutPose, float DeltaSeconds);
 
@@ -372,6 +402,9 @@ protected:
     float LayerBlendTimeRemaining[(int32)EAnimLayer::Count] = { 0.0f };
     float LayerBlendTotalTime[(int32)EAnimLayer::Count] = { 0.0f };
 
+    // 본 LOD (컴포넌트의 업데이트 빈도 최적화가 프레임마다 설정)
+    int32 BoneLODStripDepth = 0;
+
     //마스킹 데이터
     bool bUseUpperBody = false;
     TArray<bool> UpperBodyMask; // true면 상체
@@ -389,7 +422,7 @@ protected:
     /** 몽타주 업데이트 */
     void UpdateMontage(float DeltaTime);
 
-    /** 몽타주 노티파이 트리거 */
+    /** 몽타주 노티파이를 소유 컴포넌트의 큐에 수집 */
     void TriggerMontageNotifies(float DeltaSeconds);
 };
 
@@ -0,0 +1,157 @@
+﻿#include "pch.h"
+#include "AnimPoseKernels.h"
+#include <immintrin.h>
+
+namespace
+{
+    // BlendTransforms는 FTransform 4개를 __m128 10개로 읽는다 (Translation 3 + Rotation 4 + Scale 3)
+    static_assert(sizeof(FTransform) == sizeof(float) * 10, "FTransform must be ten tightly packed floats");
+
+    inline __m128 Lerp4(__m128 A, __m128 B, __m128 Alpha)
+    {
+        return _mm_add_ps(A, _mm_mul_ps(_mm_sub_ps(B, A), Alpha));
+    }
+
+    /**
+     * 본 4개 회전의 최단 호 nlerp (FQuat::Nlerp와 같은 규칙). 결과는 A 레지스터에 덮어쓴다
+     * 길이가 0에 가까운 레인은 FQuat::Normalize처럼 항등 회전으로 바꾼다
+     */
+    inline void NlerpLanes(__m128& AX, __m128& AY, __m128& AZ, __m128& AW,
+        __m128 BX, __m128 BY, __m128 BZ, __m128 BW, __m128 Alpha)
+    {
+        const __m128 Dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(AX, BX), _mm_mul_ps(AY, BY)),
+            _mm_add_ps(_mm_mul_ps(AZ, BZ), _mm_mul_ps(AW, BW)));
+
+        // 내적이 음수인 레인은 B를 뒤집는다 (내적의 부호 비트를 그대로 XOR)
+        const __m128 FlipMask = _mm_and_ps(Dot, _mm_set1_ps(-0.0f));
+        BX = _mm_xor_ps(BX, FlipMask);
+        BY = _mm_xor_ps(BY, FlipMask);
+        BZ = _mm_xor_ps(BZ, FlipMask);
+        BW = _mm_xor_ps(BW, FlipMask);
+
+        __m128 X = Lerp4(AX, BX, Alpha);
+        __m128 Y = Lerp4(AY, BY, Alpha);
+        __m128 Z = Lerp4(AZ, BZ, Alpha);
+        __m128 W = Lerp4(AW, BW, Alpha);
+
+        const __m128 LengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, X), _mm_mul_ps(Y, Y)),
+            _mm_add_ps(_mm_mul_ps(Z, Z), _mm_mul_ps(W, W)));
+        const __m128 Length = _mm_sqrt_ps(LengthSq);
+        const __m128 Valid = _mm_cmpgt_ps(Length, _mm_set1_ps(KINDA_SMALL_NUMBER));
+        const __m128 InvLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_max_ps(Length, _mm_set1_ps(KINDA_SMALL_NUMBER)));
+
+        AX = _mm_and_ps(Valid, _mm_mul_ps(X, InvLength));
+        AY = _mm_and_ps(Valid, _mm_mul_ps(Y, InvLength));
+        AZ = _mm_and_ps(Valid, _mm_mul_ps(Z, InvLength));
+        AW = _mm_or_ps(_mm_and_ps(Valid, _mm_mul_ps(W, InvLength)), _mm_andnot_ps(Valid, _mm_set1_ps(1.0f)));
+    }
+
+    inline float SafeReciprocal(float Value)
+    {
+        return std::fabs(Value) > KINDA_SMALL_NUMBER ? 1.0f / Value : 0.0f;
+    }
+}
+
+void AnimPoseKernels::BlendTransforms(const FTransform* From, const FTransform* To, float Alpha, FTransform* Out, int32 NumBones)
+{
+    const __m128 AlphaV = _mm_set1_ps(Alpha);
+
+    int32 Bone = 0;
+    for (; Bone + 4 <= NumBones; Bone += 4)
+    {
+        // 1. 회전 4개를 읽어 성분별 레지스터로 전치 (Out이 From/To와 같아도 되도록 쓰기 전에 읽는다)
+        __m128 AX = _mm_loadu_ps(&From[Bone + 0].Rotation.X);
+        __m128 AY = _mm_loadu_ps(&From[Bone + 1].Rotation.X);
+        __m128 AZ = _mm_loadu_ps(&From[Bone + 2].Rotation.X);
+        __m128 AW = _mm_loadu_ps(&From[Bone + 3].Rotation.X);
+        __m128 BX = _mm_loadu_ps(&To[Bone + 0].Rotation.X);
+        __m128 BY = _mm_loadu_ps(&To[Bone + 1].Rotation.X);
+        __m128 BZ = _mm_loadu_ps(&To[Bone + 2].Rotation.X);
+        __m128 BW = _mm_loadu_ps(&To[Bone + 3].Rotation.X);
+        _MM_TRANSPOSE4_PS(AX, AY, AZ, AW);
+        _MM_TRANSPOSE4_PS(BX, BY, BZ, BW);
+
+        NlerpLanes(AX, AY, AZ, AW, BX, BY, BZ, BW, AlphaV);
+        _MM_TRANSPOSE4_PS(AX, AY, AZ, AW);
+
+        // 2. 본 4개 = float 40개를 통째로 선형 보간 (이동/스케일은 이걸로 끝, 회전 자리는 아래에서 덮어쓴다)
+        const float* FromFloats = &From[Bone].Translation.X;
+        const float* ToFloats = &To[Bone].Translation.X;
+        float* OutFloats = &Out[Bone].Translation.X;
+        for (int32 Offset = 0; Offset < 40; Offset += 4)
+        {
+            _mm_storeu_ps(OutFloats + Offset, Lerp4(_mm_loadu_ps(FromFloats + Offset), _mm_loadu_ps(ToFloats + Offset), AlphaV));
+        }
+
+        _mm_storeu_ps(&Out[Bone + 0].Rotation.X, AX);
+        _mm_storeu_ps(&Out[Bone + 1].Rotation.X, AY);
+        _mm_storeu_ps(&Out[Bone + 2].Rotation.X, AZ);
+        _mm_storeu_ps(&Out[Bone + 3].Rotation.X, AW);
+    }
+
+    // 남는 본 (4개 미만)
+    for (; Bone < NumBones; ++Bone)
+    {
+        const FTransform& A = From[Bone];
+        const FTransform& B = To[Bone];
+        Out[Bone] = FTransform(
+            FVector::Lerp(A.Translation, B.Translation, Alpha),
+            FQuat::Nlerp(A.Rotation, B.Rotation, Alpha),
+            FVector::Lerp(A.Scale3D, B.Scale3D, Alpha));
+    }
+}
+
+void AnimPoseKernels::BuildInverseBindNormalMatrices(const FSkeleton& Skeleton, TArray<FMatrix>& OutMatrices)
+{
+    const int32 NumBones = Skeleton.Bones.Num();
+    OutMatrices.SetNum(NumBones);
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        OutMatrices[BoneIndex] = Skeleton.Bones[BoneIndex].InverseBindPose.Inverse().Transpose();
+    }
+}
+
+void AnimPoseKernels::ComputeComponentSpaceAndSkinning(const FSkeleton& Skeleton, const FMatrix* InverseBindNormalMatrices,
+    const FTransform* LocalPose, FTransform* OutComponentPose, FMatrix* OutSkinMatrices, FMatrix* OutNormalMatrices)
+{
+    const int32 NumBones = Skeleton.Bones.Num();
+    const __m128 AxisW = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        const FBone& Bone = Skeleton.Bones[BoneIndex];
+
+        // 1. 컴포넌트 공간 트랜스폼 (부모는 이미 계산됨)
+        FTransform& Component = OutComponentPose[BoneIndex];
+        Component = (Bone.ParentIndex < 0)
+            ? LocalPose[BoneIndex]
+            : OutComponentPose[Bone.ParentIndex].GetWorldTransform(LocalPose[BoneIndex]);
+
+        // 2. 회전 행렬의 행 (행벡터 규약, FQuat::ToMatrix와 같은 값)
+        const FQuat& Q = Component.Rotation;
+        const float XX = Q.X * Q.X, YY = Q.Y * Q.Y, ZZ = Q.Z * Q.Z;
+        const float XY = Q.X * Q.Y, XZ = Q.X * Q.Z, YZ = Q.Y * Q.Z;
+        const float WX = Q.W * Q.X, WY = Q.W * Q.Y, WZ = Q.W * Q.Z;
+        const __m128 R0 = _mm_set_ps(0.0f, 2.0f * (XZ - WY), 2.0f * (XY + WZ), 1.0f - 2.0f * (YY + ZZ));
+        const __m128 R1 = _mm_set_ps(0.0f, 2.0f * (YZ + WX), 1.0f - 2.0f * (XX + ZZ), 2.0f * (XY - WZ));
+        const __m128 R2 = _mm_set_ps(0.0f, 1.0f - 2.0f * (XX + YY), 2.0f * (YZ - WX), 2.0f * (XZ + WY));
+
+        // 3. 스키닝 행렬 = InverseBindPose * (S * R * T)
+        const FVector& S = Component.Scale3D;
+        const FVector& T = Component.Translation;
+        FMatrix ComponentMatrix;
+        ComponentMatrix.Rows[0] = _mm_mul_ps(R0, _mm_set1_ps(S.X));
+        ComponentMatrix.Rows[1] = _mm_mul_ps(R1, _mm_set1_ps(S.Y));
+        ComponentMatrix.Rows[2] = _mm_mul_ps(R2, _mm_set1_ps(S.Z));
+        ComponentMatrix.Rows[3] = _mm_set_ps(1.0f, T.Z, T.Y, T.X);
+        OutSkinMatrices[BoneIndex] = Bone.InverseBindPose * ComponentMatrix;
+
+        // 4. 법선 행렬 = (IB * S * R)^-T = IB^-T * S^-1 * R (회전의 역전치는 자기 자신, 이동은 법선에 영향 없음)
+        FMatrix NormalMatrix;
+        NormalMatrix.Rows[0] = _mm_mul_ps(R0, _mm_set1_ps(SafeReciprocal(S.X)));
+        NormalMatrix.Rows[1] = _mm_mul_ps(R1, _mm_set1_ps(SafeReciprocal(S.Y)));
+        NormalMatrix.Rows[2] = _mm_mul_ps(R2, _mm_set1_ps(SafeReciprocal(S.Z)));
+        NormalMatrix.Rows[3] = AxisW;
+        OutNormalMatrices[BoneIndex] = InverseBindNormalMatrices[BoneIndex] * NormalMatrix;
+    }
+}
@@ -0,0 +1,26 @@
+﻿#pragma once
+
+struct FSkeleton;
+
+// 포즈 블렌드/컴포넌트 공간 변환 커널
+namespace AnimPoseKernels
+{
+    /**
+     * Out = Lerp(From, To, Alpha). 회전은 최단 호 nlerp (정규화된 선형 보간), Out은 From/To와 같은 배열이어도 된다
+     * 본 4개(= __m128 10개)를 한 번에 읽어 레지스터 안에서 성분별로 전치해 섞고, 남는 본은 스칼라로 처리한다
+     * 포즈는 엔진 전체가 TArray<FTransform>으로 주고받으므로 별도 SoA 버퍼로 옮기지 않는다
+     */
+    void BlendTransforms(const FTransform* From, const FTransform* To, float Alpha, FTransform* Out, int32 NumBones);
+
+    /** 스키닝 법선 행렬 계산용으로 InverseBindPose의 역전치를 미리 구한다 (메시가 바뀔 때 한 번) */
+    void BuildInverseBindNormalMatrices(const FSkeleton& Skeleton, TArray<FMatrix>& OutMatrices);
+
+    /**
+     * 로컬 포즈 → 컴포넌트 공간 포즈 → 스키닝 행렬/법선 행렬을 본 순서대로 한 번에 계산한다
+     * - 행렬은 합성된 회전/스케일에서 바로 만들고 (FTransform::ToMatrix의 전치 없이)
+     * - 법선 행렬은 일반 4x4 역행렬 대신 InverseBindNormal * (회전 행 / 스케일)로 구한다
+     * 부모 본은 항상 자식보다 앞 인덱스여야 한다
+     */
+    void ComputeComponentSpaceAndSkinning(const FSkeleton& Skeleton, const FMatrix* InverseBindNormalMatrices,
+        const FTransform* LocalPose, FTransform* OutComponentPose, FMatrix* OutSkinMatrices, FMatrix* OutNormalMatrices);
+}
@@ -23,63 +23,95 @@ void UAnimSequence::GetAnimationPose(FPoseContext& OutPoseContext, const FAnimEx
     GetBonePose(OutPoseContext, ExtractionContext);
 }
 
+namespace
+{
+    /**
+     * @brief 추출 시간을 애니메이션 구간으로 정리 (루핑이면 감싸기)
+     * @return 키 데이터가 없어 평가할 수 없으면 false
+     */
+    bool ResolveExtractTime(const UAnimDataModel& Model, const FAnimExtractContext& ExtractionContext, float& OutTime)
+    {
+        if (Model.GetNumberOfFrames() <= 0 || Model.GetFrameRate() <= 0)
+        {
+            return false;
+        }
+
+        OutTime = static_cast<float>(ExtractionContext.CurrentTime);
+
+        // Handle looping
+        if (ExtractionContext.bLooping)
+        {
+            const float PlayLength = Model.GetPlayLength();
+            if (PlayLength > 0.0f)
+            {
+                OutTime = FMath::Fmod(OutTime, PlayLength);
+                if (OutTime < 0.0f)
+                {
+                    OutTime += PlayLength;
+                }
+            }
+        }
+        return true;
+    }
+}
+
 void UAnimSequence::GetBonePose(FPoseContext& OutPoseContext, const FAnimExtractContext& ExtractionContext)
 {
     const UAnimDataModel* Model = GetDataModel();
-    if (!Model)
+    float CurrentTime = 0.0f;
+    if (!Model || !ResolveExtractTime(*Model, ExtractionContext, CurrentTime))
     {
         return;
     }
 
-    const int32 FrameRate = Model->GetFrameRate();
-    const int32 NumberOfFrames = Model->GetNumberOfFrames();
+    // 각 본의 전체 키 배열을 그대로 담고 있는 컨테이너를 리턴
+    const TArray<FBoneAnimationTrack>& BoneTracks = Model->GetBoneAnimationTracks();
+    const int32 NumTracks = FMath::Min(BoneTracks.Num(), OutPoseContext.Pose.Num());
 
-    if (NumberOfFrames <= 0 || FrameRate <= 0)
+    // 본 LOD: 말단 쪽 본의 트랙은 건너뛴다 (그 슬롯은 기존 값 그대로, 호출자가 해당 본을 무시해야 함)
+    const TArray<uint8>* TrackLeafDepth = nullptr;
+    if (ExtractionContext.BoneLODSkeleton && ExtractionContext.BoneLODStripDepth > 0)
     {
-        return;
+        TrackLeafDepth = &Model->GetTrackRemap(*ExtractionContext.BoneLODSkeleton).TrackLeafDepth;
     }
 
-    // Get current time and convert to frame
-    float CurrentTime = static_cast<float>(ExtractionContext.CurrentTime);
-
-    // Handle looping
-    if (ExtractionContext.bLooping)
+    // 트랙 순서 포즈: 트랙 인덱스로 바로 평가 (이름으로 트랙을 다시 찾지 않는다)
+    // EvaluateTrackTransform은 현재 시간(Time)을 프레임 인덱스 두개(Frame0/Frame1)와 보간 비율로 바꿔
+    // 위치·스케일은 선형 보간, 회전은 쿼터니언 Slerp을 쓴다 (키를 정확히 지나야 하므로 근사 대신 보간)
+    for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
     {
-        float PlayLength = Model->GetPlayLength();
-        if (PlayLength > 0.0f)
+        if (TrackLeafDepth && (*TrackLeafDepth)[TrackIndex] < ExtractionContext.BoneLODStripDepth)
         {
-            CurrentTime = FMath::Fmod(CurrentTime, PlayLength);
-            if (CurrentTime < 0.0f)
-            {
-                CurrentTime += PlayLength;
-            }
+            continue;
         }
+        OutPoseContext.Pose[TrackIndex] = Model->EvaluateTrackTransform(TrackIndex, CurrentTime, true);
     }
+}
 
-    // 각 본의 전체 키 배열을 그대로 담고 있는 컨테이너를 리턴
-    const TArray<FBoneAnimationTrack>& BoneTracks = Model->GetBoneAnimationTracks();
+void UAnimSequence::GetSkeletonPose(const FSkeleton& Skeleton, const FAnimExtractContext& ExtractionContext, TArray<FTransform>& InOutBonePose)
+{
+    const UAnimDataModel* Model = GetDataModel();
+    float CurrentTime = 0.0f;
+    if (!Model || !ResolveExtractTime(*Model, ExtractionContext, CurrentTime))
+    {
+        return;
+    }
 
-    for (int32 TrackIndex = 0; TrackIndex < BoneTracks.Num(); ++TrackIndex)
+    const FAnimTrackRemap& Remap = Model->GetTrackRemap(Skeleton);
+    const int32 NumBones = InOutBonePose.Num();
+    const int32 StripDepth = ExtractionContext.BoneLODStripDepth;
+    for (int32 TrackIndex = 0; TrackIndex < Remap.TrackToBone.Num(); ++TrackIndex)
     {
-        const FBoneAnimationTrack& Track = BoneTracks[TrackIndex];
-        FName BoneName = Track.Name;
-
-        // 이 본 이름의 트랙 데이터를 주어진 시간(Time)에 맞춰 평가해, 하나의 FTransform으로 돌려주는 함수
-        // 1. 본 이름으로 FBoneAnimationTrack을 찾음
-        // 2. 애니 전체 프레임 수와 프레임 레이트를 보고, 현재 시간(Time)을 정수 프레임 인덱스 두개(Frame0/Frame1)와 보간 비율로 선형보간
-        //
-        // <선형보간 하는 이유>
-        // 애니메이션 키가 프레임 기반으로 저장되어 있기 때문에, 임의의 시간(Time)이 두 키 사이에 걸쳐 있으면 그냥 가까운 키를 그
-        // 대로 쓰면 "툭툭 끊겨" 보임. EvaluateBoneTrackTransform은 그걸 부드럽게 만들기 위해 Time을 프레임 단위로 환산하고,
-        // 바로 앞/뒤의 두 키(Frame0, Frame1) 값을 가져와서 Alpha 비율만큼 보간 위치·스케일은 선형 보간, 회전은 쿼터니언 Slerp을 씀
-        // 애니메이션은 "어느 타이밍에 정확히 이 포즈"같이 명시된 키를 그대로 지켜야 하므로 Apporximation 대신 Interpolation을 사용해야함
-        FTransform BoneTransform = Model->EvaluateBoneTrackTransform(BoneName, CurrentTime, true);
-
-        // Store in pose context (you'll need to map bone name to index)
-        // For now, we'll just use track index
-        if (TrackIndex < OutPoseContext.Pose.Num())
+        // 본 LOD로 멈춘 본은 기존 포즈 유지
+        if (StripDepth > 0 && Remap.TrackLeafDepth[TrackIndex] < StripDepth)
+        {
+            continue;
+        }
+
+        const int32 BoneIndex = Remap.TrackToBone[TrackIndex];
+        if (BoneIndex != INDEX_NONE && BoneIndex < NumBones)
         {
-            OutPoseContext.Pose[TrackIndex] = BoneTransform;
+            InOutBonePose[BoneIndex] = Model->EvaluateTrackTransform(TrackIndex, CurrentTime, true);
         }
     }
 }
@@ -134,6 +166,26 @@ void UAnimSequence::EvaluatePose(float Time, float DeltaTime, TArray<FTransform>
     OutPose = PoseContext.Pose;
 }
 
+void UAnimSequence::EvaluatePoseWithBoneLOD(float Time, float DeltaTime, const FSkeleton& Skeleton, int32 StripDepth, TArray<FTransform>& OutPose)
+{
+    const UAnimDataModel* Model = GetDataModel();
+    if (!Model)
+    {
+        return;
+    }
+
+    const int32 NumBones = Model->GetNumBoneTracks();
+
+    FAnimExtractContext ExtractContext(Time, true);
+    ExtractContext.BoneLODSkeleton = &Skeleton;
+    ExtractContext.BoneLODStripDepth = StripDepth;
+    FPoseContext PoseContext(NumBones);
+
+    GetAnimationPose(PoseContext, ExtractContext);
+
+    OutPose = PoseContext.Pose;
+}
+
 int32 UAnimSequence::GetNumBoneTracks() const
 {
     const UAnimDataModel* Model = GetDataModel();
@@ -44,6 +44,12 @@ public:
     // Get bone pose for specific bones
     void GetBonePose(FPoseContext& OutPoseContext, const FAnimExtractContext& ExtractionContext);
 
+    /**
+     * @brief 스켈레톤 본 순서 포즈 버퍼에 바로 추출 (캐시된 트랙→본 리맵 사용)
+     * 트랙이 없는 본은 InOutBonePose의 기존 값을 그대로 둔다
+     */
+    void GetSkeletonPose(const FSkeleton& Skeleton, const FAnimExtractContext& ExtractionContext, TArray<FTransform>& InOutBonePose);
+
     // Override GetPlayLength from base class
     virtual float GetPlayLength() const override;
 
@@ -56,6 +62,11 @@ public:
      */
     virtual void EvaluatePose(float Time, float DeltaTime, TArray<FTransform>& OutPose) override;
 
+    /**
+     * @brief 본 LOD를 적용한 포즈 평가 (말단 쪽 본의 트랙은 키 보간을 하지 않는다)
+     */
+    virtual void EvaluatePoseWithBoneLOD(float Time, float DeltaTime, const FSkeleton& Skeleton, int32 StripDepth, TArray<FTransform>& OutPose) override;
+
     /**
      * @brief 본 트랙 개수 반환
      */
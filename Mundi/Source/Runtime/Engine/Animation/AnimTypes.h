@@ -46,6 +46,8 @@ struct FPendingAnimNotify
 {
 	const FAnimNotifyEvent* Event;
     EPendingNotifyType Type = EPendingNotifyType::Trigger; 
+    // 노티파이를 발생시킨 애니메이션 (nullptr이면 컴포넌트의 CurrentAnimation)
+    UAnimSequenceBase* SourceAnimation = nullptr;
 };
 
 enum class EAnimLayer
@@ -73,6 +75,15 @@ public:
      */
     virtual void EvaluatePose(float Time, float DeltaTime, TArray<FTransform>& OutPose) = 0;
 
+    /**
+     * @brief 본 LOD를 적용해 포즈 평가 (Skeleton 기준 말단 깊이가 StripDepth 미만인 본의 트랙은 건너뜀)
+     * @note 건너뛴 트랙 슬롯의 값은 의미가 없으므로 호출자가 그 본을 무시해야 한다. 기본 구현은 전체 평가
+     */
+    virtual void EvaluatePoseWithBoneLOD(float Time, float DeltaTime, const FSkeleton& Skeleton, int32 StripDepth, TArray<FTransform>& OutPose)
+    {
+        EvaluatePose(Time, DeltaTime, OutPose);
+    }
+
     /**
      * @brief 애니메이션 총 재생 길이 반환
      */
@@ -0,0 +1,85 @@
+﻿#include "pch.h"
+#include "AnimUpdateRate.h"
+
+void FAnimUpdateRateParams::MarkRendered(float ScreenSize)
+{
+    if (!bRenderedSinceLastTick)
+    {
+        bRenderedSinceLastTick = true;
+        MaxScreenSizeSinceLastTick = ScreenSize;
+        return;
+    }
+    MaxScreenSizeSinceLastTick = FMath::Max(MaxScreenSizeSinceLastTick, ScreenSize);
+}
+
+void FAnimUpdateRateParams::Tick(float DeltaTime, bool bAllowSkipping, uint32 PhaseOffset)
+{
+    const FAnimUpdateRateSettings& Settings = FAnimUpdateRateSettings::GetInstance();
+    const bool bOptimize = bAllowSkipping && Settings.bEnabled;
+
+    // 1. 지난 프레임 컬링 결과로 단계 결정
+    if (!bOptimize)
+    {
+        Tier = EAnimUpdateRateTier::Full;
+    }
+    else if (!bRenderedSinceLastTick)
+    {
+        Tier = EAnimUpdateRateTier::Offscreen;
+    }
+    else if (MaxScreenSizeSinceLastTick >= Settings.ScreenSizeThresholds[0])
+    {
+        Tier = EAnimUpdateRateTier::Full;
+    }
+    else if (MaxScreenSizeSinceLastTick >= Settings.ScreenSizeThresholds[1])
+    {
+        Tier = EAnimUpdateRateTier::Half;
+    }
+    else if (MaxScreenSizeSinceLastTick >= Settings.ScreenSizeThresholds[2])
+    {
+        Tier = EAnimUpdateRateTier::Third;
+    }
+    else
+    {
+        Tier = EAnimUpdateRateTier::Quarter;
+    }
+
+    EvaluationInterval = FMath::Max(Settings.TierIntervals[static_cast<int32>(Tier)], 1);
+
+    const bool bSmallOnScreen = (Tier == EAnimUpdateRateTier::Offscreen) || (MaxScreenSizeSinceLastTick < Settings.BoneLODScreenSize);
+    BoneLODStripDepth = (bOptimize && bSmallOnScreen) ? FMath::Max(Settings.BoneLODStripDepth, 0) : 0;
+
+    // 화면 밖이면 보간할 필요가 없다
+    bInterpolate = bOptimize && Settings.bInterpolateSkippedFrames
+        && Tier != EAnimUpdateRateTier::Offscreen && EvaluationInterval > 1;
+
+    // 다음 프레임 렌더 결과를 새로 받는다
+    bRenderedSinceLastTick = false;
+    MaxScreenSizeSinceLastTick = 0.0f;
+
+    // 2. 이번 프레임 평가 여부
+    AccumulatedDeltaTime += DeltaTime;
+    ++FramesSinceEvaluation;
+    bShouldEvaluate = !bHasEvaluated || FramesSinceEvaluation >= EvaluationInterval;
+
+    if (bShouldEvaluate)
+    {
+        EvaluationDeltaTime = AccumulatedDeltaTime;
+        AccumulatedDeltaTime = 0.0f;
+        // 첫 평가 뒤 주기를 컴포넌트마다 어긋나게 시작해 같은 프레임에 평가가 몰리지 않게 한다
+        FramesSinceEvaluation = bHasEvaluated ? 0 : static_cast<int32>(PhaseOffset % 4);
+        bHasEvaluated = true;
+    }
+    else
+    {
+        EvaluationDeltaTime = 0.0f;
+    }
+}
+
+float FAnimUpdateRateParams::GetInterpolationAlpha() const
+{
+    if (EvaluationInterval <= 1)
+    {
+        return 1.0f;
+    }
+    return FMath::Clamp(static_cast<float>(FramesSinceEvaluation + 1) / static_cast<float>(EvaluationInterval), 0.0f, 1.0f);
+}
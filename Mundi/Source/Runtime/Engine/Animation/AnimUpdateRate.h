@@ -0,0 +1,86 @@
+﻿#pragma once
+
+/** 애니메이션 업데이트 빈도 단계 (지난 프레임의 화면 크기/가시성으로 결정) */
+enum class EAnimUpdateRateTier : uint8
+{
+    Full,       // 매 프레임 평가
+    Half,       // 2프레임마다
+    Third,      // 3프레임마다
+    Quarter,    // 4프레임마다
+    Offscreen,  // 지난 프레임에 어느 뷰에도 그려지지 않음
+
+    Count
+};
+
+/**
+ * 업데이트 빈도 최적화(URO) 전역 설정
+ * - 화면 크기 = 바운딩 구 지름 / 화면 높이 (1이면 화면 높이를 꽉 채움)
+ */
+struct FAnimUpdateRateSettings
+{
+    static FAnimUpdateRateSettings& GetInstance()
+    {
+        static FAnimUpdateRateSettings Instance;
+        return Instance;
+    }
+
+    bool bEnabled = true;
+
+    /** 화면 크기가 이 값 이상이면 Full / Half / Third, 그 아래는 Quarter */
+    float ScreenSizeThresholds[3] = { 0.4f, 0.2f, 0.1f };
+
+    /** 단계별 평가 간격 (프레임) */
+    int32 TierIntervals[static_cast<int32>(EAnimUpdateRateTier::Count)] = { 1, 2, 3, 4, 8 };
+
+    /** 건너뛴 프레임에 직전 두 평가 포즈 사이를 보간 (화면에 보일 때만) */
+    bool bInterpolateSkippedFrames = true;
+
+    /** 화면 크기가 이보다 작거나 화면 밖이면 본 LOD 적용 */
+    float BoneLODScreenSize = 0.1f;
+
+    /** 본 LOD에서 평가를 멈출 말단 깊이 (2면 말단 본과 그 부모: 손가락 끝/마디, 얼굴 본 등). 0이면 본 LOD 끔 */
+    int32 BoneLODStripDepth = 2;
+};
+
+/**
+ * 컴포넌트 하나의 업데이트 빈도 상태
+ * - 렌더러가 MarkRendered로 가시성과 화면 크기를 남기고, 다음 게임 스레드 Tick이 그걸로 이번 프레임 평가 여부를 정한다
+ * - 건너뛴 프레임의 시간은 누적했다가 평가 프레임에 한 번에 넘기므로 재생 위치와 노티파이 구간은 빠지지 않는다
+ */
+struct FAnimUpdateRateParams
+{
+    /** 렌더러가 이 컴포넌트를 그릴 때 호출 (뷰가 여러 개면 가장 큰 화면 크기를 쓴다) */
+    void MarkRendered(float ScreenSize);
+
+    /**
+     * 게임 스레드에서 프레임마다 한 번 호출. 이번 프레임 평가 여부와 평가에 쓸 누적 시간을 정한다
+     * @param bAllowSkipping false면 항상 Full (물리 구동, 최적화를 끈 컴포넌트 등)
+     * @param PhaseOffset 같은 간격의 컴포넌트들이 같은 프레임에 몰리지 않도록 첫 주기를 엇갈리게 하는 값
+     */
+    void Tick(float DeltaTime, bool bAllowSkipping, uint32 PhaseOffset);
+
+    bool ShouldEvaluate() const { return bShouldEvaluate; }
+    bool ShouldInterpolate() const { return bInterpolate; }
+    /** 평가 프레임이면 지난 평가 이후 누적된 시간 */
+    float GetEvaluationDeltaTime() const { return EvaluationDeltaTime; }
+    /** 직전 표시 포즈 → 최신 평가 포즈 보간 비율 (간격의 마지막 프레임에 1) */
+    float GetInterpolationAlpha() const;
+    EAnimUpdateRateTier GetTier() const { return Tier; }
+    int32 GetEvaluationInterval() const { return EvaluationInterval; }
+    int32 GetBoneLODStripDepth() const { return BoneLODStripDepth; }
+
+private:
+    EAnimUpdateRateTier Tier = EAnimUpdateRateTier::Full;
+    int32 EvaluationInterval = 1;
+    int32 FramesSinceEvaluation = 0;
+    float AccumulatedDeltaTime = 0.0f;
+    float EvaluationDeltaTime = 0.0f;
+    int32 BoneLODStripDepth = 0;
+    bool bShouldEvaluate = true;
+    bool bInterpolate = false;
+    bool bHasEvaluated = false;
+
+    // 지난 Tick 이후 렌더러가 남긴 가시성 (첫 프레임은 보이는 것으로 가정)
+    bool bRenderedSinceLastTick = true;
+    float MaxScreenSizeSinceLastTick = 1.0f;
+};
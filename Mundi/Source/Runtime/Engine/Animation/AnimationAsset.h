@@ -26,6 +26,10 @@ struct FAnimExtractContext
 
     // 루프 여부
     bool bLooping;
+
+    // 본 LOD: 이 스켈레톤 기준 말단 깊이가 BoneLODStripDepth 미만인 본의 트랙은 추출하지 않는다 (0이면 전체 추출)
+    const FSkeleton* BoneLODSkeleton = nullptr;
+    int32 BoneLODStripDepth = 0;
 };
 
 class USkeleton;
@@ -0,0 +1,520 @@
+﻿#include "pch.h"
+#include "AnimationBenchmark.h"
+#include <random>
+#include "CPUSkinning.h"
+#include "AnimCompression.h"
+#include "AnimDateModel.h"
+#include "AnimPoseKernels.h"
+#include "AnimSequence.h"
+#include "JobSystem.h"
+#include "PlatformTime.h"
+#include "ResourceManager.h"
+
+namespace
+{
+    // 예전 USkinnedMeshComponent::PerformSkinning과 같은 방식 (본마다 위치/법선/탄젠트를 따로 변환해서 섞음)
+    void SkinVertexLegacy(const FSkinnedVertex& In, const TArray<FMatrix>& SkinMatrices, const TArray<FMatrix>& NormalMatrices, FNormalVertex& Out)
+    {
+        const FVector TangentDir(In.Tangent.X, In.Tangent.Y, In.Tangent.Z);
+        FVector Position(0.f, 0.f, 0.f);
+        FVector Normal(0.f, 0.f, 0.f);
+        FVector Tangent(0.f, 0.f, 0.f);
+
+        for (int32 Idx = 0; Idx < 4; ++Idx)
+        {
+            const float Weight = In.BoneWeights[Idx];
+            if (Weight > 0.f)
+            {
+                Position += SkinMatrices[In.BoneIndices[Idx]].TransformPosition(In.Position) * Weight;
+            }
+        }
+        for (int32 Idx = 0; Idx < 4; ++Idx)
+        {
+            const float Weight = In.BoneWeights[Idx];
+            if (Weight > 0.f)
+            {
+                Normal += NormalMatrices[In.BoneIndices[Idx]].TransformVector(In.Normal) * Weight;
+            }
+        }
+        for (int32 Idx = 0; Idx < 4; ++Idx)
+        {
+            const float Weight = In.BoneWeights[Idx];
+            if (Weight > 0.f)
+            {
+                Tangent += SkinMatrices[In.BoneIndices[Idx]].TransformVector(TangentDir) * Weight;
+            }
+        }
+
+        const FVector FinalTangent = Tangent.GetSafeNormal();
+        Out.pos = Position;
+        Out.normal = Normal.GetSafeNormal();
+        Out.Tangent = FVector4(FinalTangent.X, FinalTangent.Y, FinalTangent.Z, In.Tangent.W);
+        Out.tex = In.UV;
+    }
+
+    // UAnimDataModel::EvaluateTrackTransform의 원본 키 경로와 같은 방식 (앞뒤 프레임 보간)
+    FTransform SampleRawTrack(const FRawAnimSequenceTrack& Track, float FrameTime)
+    {
+        const int32 Frame0 = FMath::FloorToInt(FrameTime);
+        const int32 Frame1 = FMath::CeilToInt(FrameTime);
+        const float Alpha = FrameTime - Frame0;
+
+        FTransform Result;
+        if (Track.PosKeys.Num() > 0)
+        {
+            const int32 Last = Track.PosKeys.Num() - 1;
+            Result.Translation = FVector::Lerp(Track.PosKeys[FMath::Clamp(Frame0, 0, Last)], Track.PosKeys[FMath::Clamp(Frame1, 0, Last)], Alpha);
+        }
+        if (Track.RotKeys.Num() > 0)
+        {
+            const int32 Last = Track.RotKeys.Num() - 1;
+            Result.Rotation = FQuat::Slerp(Track.RotKeys[FMath::Clamp(Frame0, 0, Last)], Track.RotKeys[FMath::Clamp(Frame1, 0, Last)], Alpha);
+        }
+        if (Track.ScaleKeys.Num() > 0)
+        {
+            const int32 Last = Track.ScaleKeys.Num() - 1;
+            Result.Scale3D = FVector::Lerp(Track.ScaleKeys[FMath::Clamp(Frame0, 0, Last)], Track.ScaleKeys[FMath::Clamp(Frame1, 0, Last)], Alpha);
+        }
+        return Result;
+    }
+
+    // 예전 UAnimInstance::BlendPoseArrays (본마다 Lerp + Slerp + 정규화)
+    void BlendPoseLegacy(const TArray<FTransform>& FromPose, const TArray<FTransform>& ToPose, float Alpha, TArray<FTransform>& OutPose)
+    {
+        const int32 NumBones = FMath::Min(FromPose.Num(), ToPose.Num());
+        OutPose.SetNum(NumBones);
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            const FTransform& From = FromPose[BoneIndex];
+            const FTransform& To = ToPose[BoneIndex];
+
+            FTransform Result;
+            Result.Translation = FMath::Lerp(From.Translation, To.Translation, Alpha);
+            Result.Scale3D = FMath::Lerp(From.Scale3D, To.Scale3D, Alpha);
+            Result.Rotation = FQuat::Slerp(From.Rotation, To.Rotation, Alpha);
+            Result.Rotation.Normalize();
+            OutPose[BoneIndex] = Result;
+        }
+    }
+
+    // 예전 USkeletalMeshComponent::UpdateComponentSpaceTransforms + UpdateFinalSkinningMatrices
+    void ComputeSkinningLegacy(const FSkeleton& Skeleton, const TArray<FTransform>& LocalPose, TArray<FTransform>& ComponentPose,
+        TArray<FMatrix>& SkinMatrices, TArray<FMatrix>& NormalMatrices)
+    {
+        const int32 NumBones = Skeleton.Bones.Num();
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            const int32 ParentIndex = Skeleton.Bones[BoneIndex].ParentIndex;
+            ComponentPose[BoneIndex] = (ParentIndex == -1) ? LocalPose[BoneIndex] : ComponentPose[ParentIndex].GetWorldTransform(LocalPose[BoneIndex]);
+        }
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            SkinMatrices[BoneIndex] = Skeleton.Bones[BoneIndex].InverseBindPose * ComponentPose[BoneIndex].ToMatrix();
+            NormalMatrices[BoneIndex] = SkinMatrices[BoneIndex].Inverse().Transpose();
+        }
+    }
+
+    float MaxMatrix3x3Difference(const FMatrix& A, const FMatrix& B)
+    {
+        float MaxDifference = 0.0f;
+        for (int32 Row = 0; Row < 3; ++Row)
+        {
+            for (int32 Col = 0; Col < 3; ++Col)
+            {
+                MaxDifference = FMath::Max(MaxDifference, std::fabs(A.M[Row][Col] - B.M[Row][Col]));
+            }
+        }
+        return MaxDifference;
+    }
+
+    /**
+     * 사람형 캐릭터 흉내 합성 클립
+     * - 루트: 이동 + 회전, 몸통/팔다리: 주파수가 다른 사인 회전, 손가락 끝 등: 고정, 일부 스케일 트랙: 항등
+     */
+    TArray<FBoneAnimationTrack> BuildSyntheticClip(int32 NumBones, int32 NumFrames)
+    {
+        std::mt19937 Rng(4321);
+        std::uniform_real_distribution<float> PhaseDist(0.0f, 6.2831853f);
+        std::uniform_real_distribution<float> AmpDist(0.05f, 0.6f);
+        std::uniform_real_distribution<float> FreqDist(0.5f, 3.0f);
+        std::uniform_real_distribution<float> OffsetDist(-20.0f, 20.0f);
+
+        TArray<FBoneAnimationTrack> Tracks;
+        Tracks.SetNum(NumBones);
+        for (int32 Bone = 0; Bone < NumBones; ++Bone)
+        {
+            FBoneAnimationTrack& Track = Tracks[Bone];
+            Track.Name = FName("Bone_" + std::to_string(Bone));
+            FRawAnimSequenceTrack& Raw = Track.InternalTrack;
+            Raw.PosKeys.SetNum(NumFrames);
+            Raw.RotKeys.SetNum(NumFrames);
+            Raw.ScaleKeys.SetNum(NumFrames);
+
+            const bool bStatic = (Bone % 5) == 4;
+            const FVector Offset(OffsetDist(Rng), OffsetDist(Rng), OffsetDist(Rng));
+            const FVector Axis = FVector(OffsetDist(Rng), OffsetDist(Rng), OffsetDist(Rng)).GetSafeNormal();
+            const float Phase = PhaseDist(Rng);
+            const float Amplitude = AmpDist(Rng);
+            const float Frequency = FreqDist(Rng);
+
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                const float Time = static_cast<float>(Frame) / 30.0f;
+                const float Angle = bStatic ? Amplitude : Amplitude * std::sin(Time * Frequency * 6.2831853f + Phase);
+                Raw.RotKeys[Frame] = FQuat(Axis.X * std::sin(Angle * 0.5f), Axis.Y * std::sin(Angle * 0.5f), Axis.Z * std::sin(Angle * 0.5f), std::cos(Angle * 0.5f));
+                Raw.PosKeys[Frame] = (Bone == 0) ? FVector(Time * 150.0f, 0.0f, 90.0f + 3.0f * std::sin(Time * 12.0f)) : Offset;
+                Raw.ScaleKeys[Frame] = FVector(1.0f, 1.0f, 1.0f);
+            }
+        }
+        return Tracks;
+    }
+}
+
+void FAnimationBenchmark::RunCPUSkinningBenchmark(int32 NumVertices, int32 NumBones, int32 NumFrames)
+{
+    NumVertices = FMath::Max(NumVertices, 1);
+    NumBones = FMath::Max(NumBones, 1);
+    NumFrames = FMath::Max(NumFrames, 1);
+    UE_LOG("[AnimationBenchmark] CPU skinning: %d vertices x %d bones x %d frames", NumVertices, NumBones, NumFrames);
+
+    // 1. 정점마다 서로 다른 본 4개, 합이 1인 가중치
+    std::mt19937 Rng(1234);
+    std::uniform_real_distribution<float> PosDist(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> UnitDist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> WeightDist(0.05f, 1.0f);
+    std::uniform_int_distribution<uint32> BoneDist(0, static_cast<uint32>(NumBones - 1));
+
+    TArray<FSkinnedVertex> Vertices;
+    Vertices.SetNum(NumVertices);
+    for (FSkinnedVertex& Vertex : Vertices)
+    {
+        Vertex.Position = FVector(PosDist(Rng), PosDist(Rng), PosDist(Rng));
+        Vertex.Normal = FVector(UnitDist(Rng), UnitDist(Rng), UnitDist(Rng)).GetSafeNormal();
+        const FVector Tangent = FVector(UnitDist(Rng), UnitDist(Rng), UnitDist(Rng)).GetSafeNormal();
+        Vertex.Tangent = FVector4(Tangent.X, Tangent.Y, Tangent.Z, 1.0f);
+        Vertex.UV = FVector2D(UnitDist(Rng), UnitDist(Rng));
+        Vertex.Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+
+        float WeightSum = 0.0f;
+        for (int32 Idx = 0; Idx < 4; ++Idx)
+        {
+            Vertex.BoneIndices[Idx] = BoneDist(Rng);
+            Vertex.BoneWeights[Idx] = WeightDist(Rng);
+            WeightSum += Vertex.BoneWeights[Idx];
+        }
+        for (float& Weight : Vertex.BoneWeights)
+        {
+            Weight /= WeightSum;
+        }
+    }
+
+    // 2. 프레임마다 다른 포즈 (회전 + 이동 + 약간의 비균등 스케일)
+    TArray<TArray<FMatrix>> FrameSkinMatrices;
+    TArray<TArray<FMatrix>> FrameNormalMatrices;
+    const int32 NumPoses = FMath::Min(NumFrames, 8);
+    FrameSkinMatrices.SetNum(NumPoses);
+    FrameNormalMatrices.SetNum(NumPoses);
+    for (int32 Pose = 0; Pose < NumPoses; ++Pose)
+    {
+        FrameSkinMatrices[Pose].SetNum(NumBones);
+        FrameNormalMatrices[Pose].SetNum(NumBones);
+        for (int32 Bone = 0; Bone < NumBones; ++Bone)
+        {
+            const FQuat Rotation = FQuat::MakeFromEulerZYX(FVector(UnitDist(Rng) * 180.0f, UnitDist(Rng) * 90.0f, UnitDist(Rng) * 180.0f));
+            const FVector Translation(PosDist(Rng), PosDist(Rng), PosDist(Rng));
+            const FVector Scale(1.0f + UnitDist(Rng) * 0.2f, 1.0f + UnitDist(Rng) * 0.2f, 1.0f + UnitDist(Rng) * 0.2f);
+            const FMatrix Skin = FTransform(Translation, Rotation, Scale).ToMatrix();
+            FrameSkinMatrices[Pose][Bone] = Skin;
+            FrameNormalMatrices[Pose][Bone] = Skin.Inverse().Transpose();
+        }
+    }
+
+    // 3. 기존 경로: 중간 배열에 스칼라로 스키닝한 뒤 정점 버퍼 크기만큼 복사 (Map + memcpy 흉내)
+    TArray<FNormalVertex> LegacyVertices;
+    LegacyVertices.SetNum(NumVertices);
+    TArray<FVertexDynamic> LegacyUpload;
+    LegacyUpload.SetNum(NumVertices);
+
+    const uint64 LegacyStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        const TArray<FMatrix>& SkinMatrices = FrameSkinMatrices[Frame % NumPoses];
+        const TArray<FMatrix>& NormalMatrices = FrameNormalMatrices[Frame % NumPoses];
+        for (int32 Idx = 0; Idx < NumVertices; ++Idx)
+        {
+            SkinVertexLegacy(Vertices[Idx], SkinMatrices, NormalMatrices, LegacyVertices[Idx]);
+        }
+        memcpy(LegacyUpload.data(), LegacyVertices.data(), sizeof(FVertexDynamic) * NumVertices);
+    }
+    const double LegacyMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LegacyStart) / NumFrames;
+
+    // 4. SIMD 단일 스레드 / SIMD 병렬 (출력 버퍼에 바로 씀)
+    TArray<FVertexDynamic> SimdOutput;
+    SimdOutput.SetNum(NumVertices);
+
+    const uint64 SingleStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        CPUSkinning::SkinVertexRange(Vertices.data(), SimdOutput.data(), 0, NumVertices,
+            FrameSkinMatrices[Frame % NumPoses].data(), FrameNormalMatrices[Frame % NumPoses].data());
+    }
+    const double SingleMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - SingleStart) / NumFrames;
+
+    const uint64 ParallelStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        CPUSkinning::SkinVertices(Vertices.data(), SimdOutput.data(), NumVertices,
+            FrameSkinMatrices[Frame % NumPoses].data(), FrameNormalMatrices[Frame % NumPoses].data());
+    }
+    const double ParallelMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ParallelStart) / NumFrames;
+
+    // 5. 마지막 프레임 결과 비교 (두 경로 모두 같은 포즈로 끝남)
+    float MaxPositionError = 0.0f;
+    float MaxNormalError = 0.0f;
+    for (int32 Idx = 0; Idx < NumVertices; ++Idx)
+    {
+        MaxPositionError = FMath::Max(MaxPositionError, (SimdOutput[Idx].Position - LegacyVertices[Idx].pos).Size());
+        MaxNormalError = FMath::Max(MaxNormalError, (SimdOutput[Idx].Normal - LegacyVertices[Idx].normal).Size());
+    }
+
+    UE_LOG("[AnimationBenchmark] Legacy scalar   : %.3f ms/frame", LegacyMs);
+    UE_LOG("[AnimationBenchmark] SIMD 1 thread   : %.3f ms/frame (x%.2f)", SingleMs, SingleMs > 0.0 ? LegacyMs / SingleMs : 0.0);
+    UE_LOG("[AnimationBenchmark] SIMD %d threads : %.3f ms/frame (x%.2f)", FJobSystem::GetInstance().GetNumWorkers() + 1,
+        ParallelMs, ParallelMs > 0.0 ? LegacyMs / ParallelMs : 0.0);
+    UE_LOG("[AnimationBenchmark] Max error: position %.5f, normal %.5f", MaxPositionError, MaxNormalError);
+}
+
+void FAnimationBenchmark::RunCompressionBenchmark(int32 NumBones, int32 NumFrames, int32 NumSamples)
+{
+    NumBones = FMath::Max(NumBones, 1);
+    NumFrames = FMath::Max(NumFrames, 2);
+    NumSamples = FMath::Max(NumSamples, 1);
+    UE_LOG("[AnimationBenchmark] Animation compression: %d bones x %d frames, %d random samples", NumBones, NumFrames, NumSamples);
+
+    const TArray<FBoneAnimationTrack> RawTracks = BuildSyntheticClip(NumBones, NumFrames);
+
+    // 임의 (트랙, 시간) 샘플 목록 (두 경로가 같은 순서로 읽는다)
+    std::mt19937 Rng(99);
+    std::uniform_int_distribution<int32> TrackDist(0, NumBones - 1);
+    std::uniform_real_distribution<float> TimeDist(0.0f, static_cast<float>(NumFrames - 1));
+    TArray<std::pair<int32, float>> Samples;
+    Samples.SetNum(NumSamples);
+    for (std::pair<int32, float>& Sample : Samples)
+    {
+        Sample = { TrackDist(Rng), TimeDist(Rng) };
+    }
+
+    // 결과가 최적화로 사라지지 않도록 합산
+    float Checksum = 0.0f;
+
+    const uint64 RawStart = FPlatformTime::Cycles64();
+    for (const std::pair<int32, float>& Sample : Samples)
+    {
+        Checksum += SampleRawTrack(RawTracks[Sample.first].InternalTrack, Sample.second).Translation.X;
+    }
+    const double RawNs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RawStart) * 1.0e6 / NumSamples;
+    const uint64 RawBytes = AnimCompression::GetRawSize(RawTracks);
+    UE_LOG("[AnimationBenchmark] Raw          : %8.1f KB, %.1f ns/bone", RawBytes / 1024.0, RawNs);
+
+    struct FPreset
+    {
+        const char* Name;
+        float PositionTolerance;
+        float RotationTolerance;
+        float ScaleTolerance;
+    };
+    const FPreset Presets[] =
+    {
+        { "Tight  ", 0.0001f, 0.0001f, 0.0001f },
+        { "Default", 0.001f,  0.001f,  0.001f  },
+        { "Loose  ", 0.01f,   0.005f,  0.01f   },
+    };
+
+    for (const FPreset& Preset : Presets)
+    {
+        FAnimCompressionSettings Settings;
+        Settings.PositionTolerance = Preset.PositionTolerance;
+        Settings.RotationTolerance = Preset.RotationTolerance;
+        Settings.ScaleTolerance = Preset.ScaleTolerance;
+
+        FCompressedAnimData Compressed;
+        FAnimCompressionStats Stats;
+        const uint64 CompressStart = FPlatformTime::Cycles64();
+        AnimCompression::CompressTracks(RawTracks, Settings, Compressed, &Stats);
+        const double CompressMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CompressStart);
+
+        const uint64 DecodeStart = FPlatformTime::Cycles64();
+        for (const std::pair<int32, float>& Sample : Samples)
+        {
+            Checksum += Compressed.EvaluateTrack(Sample.first, Sample.second).Translation.X;
+        }
+        const double DecodeNs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - DecodeStart) * 1.0e6 / NumSamples;
+
+        const double KeptPercent = Stats.NumRawKeys > 0 ? 100.0 * Stats.NumKeptKeys / Stats.NumRawKeys : 0.0;
+        UE_LOG("[AnimationBenchmark] %s      : %8.1f KB (x%.1f smaller), keys kept %.1f%%, %.1f ns/bone, compress %.2f ms",
+            Preset.Name, Stats.CompressedBytes / 1024.0, Stats.CompressedBytes > 0 ? static_cast<double>(Stats.RawBytes) / Stats.CompressedBytes : 0.0,
+            KeptPercent, DecodeNs, CompressMs);
+        UE_LOG("[AnimationBenchmark]   channels identity %d / constant %d / quantized %d, max error pos %.5f, rot %.5f rad, scale %.5f",
+            Stats.NumIdentityChannels, Stats.NumConstantChannels, Stats.NumQuantizedChannels,
+            Stats.MaxPositionError, Stats.MaxRotationError, Stats.MaxScaleError);
+    }
+
+    // 실제로 로드된 클립들의 메모리
+    uint64 LoadedRawBytes = 0;
+    uint64 LoadedCompressedBytes = 0;
+    int32 NumCompressedClips = 0;
+    for (UAnimSequence* Sequence : UResourceManager::GetInstance().GetAll<UAnimSequence>())
+    {
+        const UAnimDataModel* Model = Sequence ? Sequence->GetDataModel() : nullptr;
+        if (!Model)
+        {
+            continue;
+        }
+        if (const FCompressedAnimData* CompressedKeys = Model->GetCompressedKeys())
+        {
+            LoadedCompressedBytes += CompressedKeys->GetAllocatedSize();
+            ++NumCompressedClips;
+        }
+        else
+        {
+            LoadedRawBytes += AnimCompression::GetRawSize(Model->GetBoneAnimationTracks());
+        }
+    }
+    UE_LOG("[AnimationBenchmark] Loaded clips: %d compressed (%.1f KB), uncompressed %.1f KB",
+        NumCompressedClips, LoadedCompressedBytes / 1024.0, LoadedRawBytes / 1024.0);
+    UE_LOG("[AnimationBenchmark] (checksum %.3f)", Checksum);
+}
+
+void FAnimationBenchmark::RunPoseBenchmark(int32 NumCharacters, int32 NumBones, int32 NumFrames)
+{
+    NumCharacters = FMath::Max(NumCharacters, 1);
+    NumBones = FMath::Max(NumBones, 1);
+    NumFrames = FMath::Max(NumFrames, 1);
+    UE_LOG("[AnimationBenchmark] Pose blend + skinning matrices: %d characters x %d bones x %d frames", NumCharacters, NumBones, NumFrames);
+
+    std::mt19937 Rng(2024);
+    std::uniform_real_distribution<float> UnitDist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> ScaleDist(0.8f, 1.2f);
+    auto RandomTransform = [&]()
+    {
+        FQuat Rotation(UnitDist(Rng), UnitDist(Rng), UnitDist(Rng), UnitDist(Rng));
+        Rotation.Normalize();
+        return FTransform(FVector(UnitDist(Rng) * 20.0f, UnitDist(Rng) * 20.0f, UnitDist(Rng) * 20.0f), Rotation,
+            FVector(ScaleDist(Rng), ScaleDist(Rng), ScaleDist(Rng)));
+    };
+
+    // 1. 부모가 항상 앞 인덱스인 임의 스켈레톤
+    FSkeleton Skeleton;
+    Skeleton.Bones.SetNum(NumBones);
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        FBone& Bone = Skeleton.Bones[BoneIndex];
+        Bone.Name = "Bone_" + std::to_string(BoneIndex);
+        Bone.ParentIndex = (BoneIndex == 0) ? -1 : static_cast<int32>(Rng() % BoneIndex);
+        Bone.BindPose = RandomTransform().ToMatrix();
+        Bone.InverseBindPose = Bone.BindPose.Inverse();
+    }
+    TArray<FMatrix> InverseBindNormalMatrices;
+    AnimPoseKernels::BuildInverseBindNormalMatrices(Skeleton, InverseBindNormalMatrices);
+
+    // 2. 캐릭터마다 블렌드할 두 포즈
+    TArray<TArray<FTransform>> FromPoses(NumCharacters), ToPoses(NumCharacters), BlendedPoses(NumCharacters);
+    for (int32 Character = 0; Character < NumCharacters; ++Character)
+    {
+        FromPoses[Character].SetNum(NumBones);
+        ToPoses[Character].SetNum(NumBones);
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            FromPoses[Character][BoneIndex] = RandomTransform();
+            ToPoses[Character][BoneIndex] = RandomTransform();
+        }
+        BlendedPoses[Character].SetNum(NumBones);
+    }
+
+    auto AlphaForFrame = [NumFrames](int32 Frame) { return (Frame + 0.5f) / NumFrames; };
+
+    // 3. 블렌드: 스칼라 Slerp / SIMD nlerp
+    const uint64 LegacyBlendStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        for (int32 Character = 0; Character < NumCharacters; ++Character)
+        {
+            BlendPoseLegacy(FromPoses[Character], ToPoses[Character], AlphaForFrame(Frame), BlendedPoses[Character]);
+        }
+    }
+    const double LegacyBlendMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LegacyBlendStart) / NumFrames;
+    TArray<TArray<FTransform>> LegacyBlended = BlendedPoses;
+
+    const uint64 AoSBlendStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        for (int32 Character = 0; Character < NumCharacters; ++Character)
+        {
+            AnimPoseKernels::BlendTransforms(FromPoses[Character].data(), ToPoses[Character].data(), AlphaForFrame(Frame),
+                BlendedPoses[Character].data(), NumBones);
+        }
+    }
+    const double AoSBlendMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - AoSBlendStart) / NumFrames;
+
+    // nlerp와 slerp의 차이 (마지막 프레임 기준 회전 각도)
+    float MaxBlendAngle = 0.0f;
+    for (int32 Character = 0; Character < NumCharacters; ++Character)
+    {
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            MaxBlendAngle = FMath::Max(MaxBlendAngle,
+                AnimCompression::QuatAngle(LegacyBlended[Character][BoneIndex].Rotation, BlendedPoses[Character][BoneIndex].Rotation));
+        }
+    }
+
+    // 4. 컴포넌트 공간 + 스키닝 행렬: 기존 두 패스 / 합친 패스
+    TArray<FTransform> LegacyComponent, FusedComponent;
+    TArray<FMatrix> LegacySkin, LegacyNormal, FusedSkin, FusedNormal;
+    LegacyComponent.SetNum(NumBones);
+    FusedComponent.SetNum(NumBones);
+    LegacySkin.SetNum(NumBones);
+    LegacyNormal.SetNum(NumBones);
+    FusedSkin.SetNum(NumBones);
+    FusedNormal.SetNum(NumBones);
+
+    const uint64 LegacySkinStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        for (int32 Character = 0; Character < NumCharacters; ++Character)
+        {
+            ComputeSkinningLegacy(Skeleton, BlendedPoses[Character], LegacyComponent, LegacySkin, LegacyNormal);
+        }
+    }
+    const double LegacySkinMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - LegacySkinStart) / NumFrames;
+
+    const uint64 FusedSkinStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        for (int32 Character = 0; Character < NumCharacters; ++Character)
+        {
+            AnimPoseKernels::ComputeComponentSpaceAndSkinning(Skeleton, InverseBindNormalMatrices.data(), BlendedPoses[Character].data(),
+                FusedComponent.data(), FusedSkin.data(), FusedNormal.data());
+        }
+    }
+    const double FusedSkinMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FusedSkinStart) / NumFrames;
+
+    // 마지막 캐릭터 결과 비교 (법선 행렬은 3x3만 쓰인다)
+    float MaxSkinError = 0.0f;
+    float MaxNormalError = 0.0f;
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        MaxSkinError = FMath::Max(MaxSkinError, MaxMatrix3x3Difference(LegacySkin[BoneIndex], FusedSkin[BoneIndex]));
+        for (int32 Col = 0; Col < 3; ++Col)
+        {
+            MaxSkinError = FMath::Max(MaxSkinError, std::fabs(FusedSkin[BoneIndex].M[3][Col] - LegacySkin[BoneIndex].M[3][Col]));
+        }
+        MaxNormalError = FMath::Max(MaxNormalError, MaxMatrix3x3Difference(LegacyNormal[BoneIndex], FusedNormal[BoneIndex]));
+    }
+
+    UE_LOG("[AnimationBenchmark] Blend  scalar slerp    : %.3f ms/frame", LegacyBlendMs);
+    UE_LOG("[AnimationBenchmark] Blend  SIMD nlerp AoS  : %.3f ms/frame (x%.2f)", AoSBlendMs, AoSBlendMs > 0.0 ? LegacyBlendMs / AoSBlendMs : 0.0);
+    UE_LOG("[AnimationBenchmark] Matrices two-pass + inverse : %.3f ms/frame", LegacySkinMs);
+    UE_LOG("[AnimationBenchmark] Matrices fused              : %.3f ms/frame (x%.2f)", FusedSkinMs, FusedSkinMs > 0.0 ? LegacySkinMs / FusedSkinMs : 0.0);
+    UE_LOG("[AnimationBenchmark] Max nlerp vs slerp %.5f rad, skin matrix error %.6f, normal matrix error %.6f",
+        MaxBlendAngle, MaxSkinError, MaxNormalError);
+}
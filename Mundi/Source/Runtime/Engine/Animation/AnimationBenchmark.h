@@ -0,0 +1,28 @@
+﻿#pragma once
+
+/**
+ * 애니메이션/스키닝 헤드리스 벤치마크 (콘솔: BENCH SKINNING, BENCH ANIMCOMPRESS, BENCH POSE)
+ * 월드/렌더러 없이 정점과 본 행렬만 만들어 CPU 비용을 잰다
+ */
+class FAnimationBenchmark
+{
+public:
+    /**
+     * 정점마다 본 4개가 섞인 NumVertices개 정점을 NumBones개 임의 행렬로 NumFrames번 스키닝하고
+     * 기존 스칼라 경로(정점당 행렬 3번 변환 + 중간 배열 복사), SIMD 단일 스레드, SIMD 병렬의 프레임당 시간을 로그로 출력
+     */
+    static void RunCPUSkinningBenchmark(int32 NumVertices = 50000, int32 NumBones = 100, int32 NumFrames = 60);
+
+    /**
+     * NumBones개 트랙 x NumFrames 프레임짜리 합성 클립을 허용 오차 프리셋별로 압축해서
+     * 원본 대비 메모리, 남은 키 비율, 최대 오차, 임의 시간 샘플링 비용(본당 ns)을 로그로 출력
+     * 로드된 애니메이션이 있으면 실제 클립들의 압축 메모리도 함께 출력
+     */
+    static void RunCompressionBenchmark(int32 NumBones = 70, int32 NumFrames = 300, int32 NumSamples = 200000);
+
+    /**
+     * NumCharacters개 캐릭터(각 NumBones 본)의 포즈 블렌드와 컴포넌트 공간/스키닝 행렬 계산을 NumFrames번 돌려
+     * 기존 스칼라 경로(Slerp, ToMatrix + 4x4 역행렬)와 SIMD 경로(nlerp, 합친 패스)의 프레임당 시간과 최대 오차를 출력
+     */
+    static void RunPoseBenchmark(int32 NumCharacters = 1000, int32 NumBones = 70, int32 NumFrames = 20);
+};
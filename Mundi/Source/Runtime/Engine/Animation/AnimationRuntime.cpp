@@ -39,4 +39,25 @@ ETypeAdvanceAnim FAnimationRuntime::AdvanceTime(const bool bAllowLooping, const
 	
 	InOutTime = NewTime;
 	return ETAA_Default;
-}
\ No newline at end of file
+}
+
+void FAnimationRuntime::ComputeBoneLeafDepths(const FSkeleton& Skeleton, TArray<uint8>& OutDepths)
+{
+	const int32 NumBones = Skeleton.Bones.Num();
+	OutDepths.SetNum(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		OutDepths[BoneIndex] = 0;
+	}
+
+	// 자식부터 거꾸로 올라가며 부모에 (자식 깊이 + 1)을 누적
+	for (int32 BoneIndex = NumBones - 1; BoneIndex >= 0; --BoneIndex)
+	{
+		const int32 ParentIndex = Skeleton.Bones[BoneIndex].ParentIndex;
+		if (ParentIndex >= 0 && ParentIndex < NumBones)
+		{
+			const uint8 Depth = OutDepths[BoneIndex] < 255 ? static_cast<uint8>(OutDepths[BoneIndex] + 1) : 255;
+			OutDepths[ParentIndex] = FMath::Max(OutDepths[ParentIndex], Depth);
+		}
+	}
+}
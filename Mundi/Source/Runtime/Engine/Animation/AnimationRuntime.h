@@ -7,4 +7,10 @@ public:
 
 	static ETypeAdvanceAnim AdvanceTime(const bool bAllowLooping, const float MoveDelta, float& InOutTime, const float EndTime);
 
+	/**
+	 * 본마다 가장 먼 말단 자손까지의 단계 수 (말단 본 0, 그 부모 1, ...), 255에서 포화
+	 * 본 LOD가 손가락/얼굴처럼 말단 쪽 본부터 평가를 멈출 때 기준으로 쓴다 (부모가 자식보다 앞에 있다고 가정)
+	 */
+	static void ComputeBoneLeafDepths(const FSkeleton& Skeleton, TArray<uint8>& OutDepths);
+
 };
\ No newline at end of file
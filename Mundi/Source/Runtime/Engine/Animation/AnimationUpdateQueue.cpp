@@ -0,0 +1,89 @@
+﻿#include "pch.h"
+#include "AnimationUpdateQueue.h"
+
+#include "JobSystem.h"
+#include "PlatformTime.h"
+#include "SkeletalMeshComponent.h"
+
+void FAnimationUpdateQueue::Enqueue(USkeletalMeshComponent* Component, float DeltaSeconds)
+{
+    if (!Component)
+    {
+        return;
+    }
+
+    FPendingUpdate& Update = PendingUpdates[PendingUpdates.Emplace()];
+    Update.Component = Component;
+    Update.DeltaSeconds = DeltaSeconds;
+}
+
+void FAnimationUpdateQueue::Remove(USkeletalMeshComponent* Component)
+{
+    for (int32 Index = PendingUpdates.Num() - 1; Index >= 0; --Index)
+    {
+        if (PendingUpdates[Index].Component != Component)
+        {
+            continue;
+        }
+
+        if (bFlushing)
+        {
+            // 후처리 루프가 인덱스로 돌고 있으므로 배열은 건드리지 않는다
+            PendingUpdates[Index].Component = nullptr;
+        }
+        else
+        {
+            PendingUpdates.RemoveAt(Index);
+        }
+    }
+}
+
+void FAnimationUpdateQueue::Flush()
+{
+    if (PendingUpdates.IsEmpty() || bFlushing)
+    {
+        return;
+    }
+
+    TIME_PROFILE(Animation_Update)
+    bFlushing = true;
+
+    // 1. 상태머신은 게임 스레드에서 수집 순서대로 (블루프린트 콜백이 인스턴스끼리 공유하는 노드/블렌드 스페이스를 쓴다)
+    //    공유 블렌드 스페이스를 쓰는 컴포넌트는 다음 컴포넌트가 파라미터를 덮기 전에 포즈까지 여기서 평가한다
+    ParallelIndices.Empty();
+    for (int32 Index = 0; Index < PendingUpdates.Num(); ++Index)
+    {
+        const FPendingUpdate& Update = PendingUpdates[Index];
+        if (Update.Component->PreUpdateAnimation(Update.DeltaSeconds))
+        {
+            ParallelIndices.Add(Index);
+        }
+        else
+        {
+            Update.Component->ParallelUpdateAnimation(Update.DeltaSeconds);
+        }
+    }
+
+    // 2. 포즈 추출/블렌딩/스키닝 행렬 (컴포넌트끼리 공유하는 쓰기 상태가 없으므로 컴포넌트 단위로 병렬)
+    FJobSystem::GetInstance().ParallelFor(ParallelIndices.Num(), 1, [this](int32 Begin, int32 End)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            const FPendingUpdate& Update = PendingUpdates[ParallelIndices[i]];
+            Update.Component->ParallelUpdateAnimation(Update.DeltaSeconds);
+        }
+    });
+
+    // 3. 노티파이/물리/소켓은 게임 스레드에서 수집 순서대로 (노티파이 핸들러가 다른 컴포넌트를 지울 수 있음)
+    FPhysScene* PhysScene = World ? World->GetPhysScene() : nullptr;
+    for (int32 Index = 0; Index < PendingUpdates.Num(); ++Index)
+    {
+        if (USkeletalMeshComponent* Component = PendingUpdates[Index].Component)
+        {
+            Component->PostAnimationUpdate(PhysScene);
+        }
+    }
+
+    PendingUpdates.Empty();
+    bFlushing = false;
+}
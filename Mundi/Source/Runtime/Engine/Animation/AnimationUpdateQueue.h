@@ -0,0 +1,43 @@
+﻿#pragma once
+
+class UWorld;
+class USkeletalMeshComponent;
+
+/**
+ * 월드 단위 애니메이션 업데이트 단계
+ * - 액터 Tick 중에는 AnimInstance를 가진 스켈레탈 메시 컴포넌트를 모으기만 한다
+ * - Flush에서 상태머신(전이, OnUpdate)은 게임 스레드에서 차례로 돌리고,
+ *   포즈 평가(추출, 블렌딩, 스키닝 행렬)만 컴포넌트 단위로 워커 스레드에 나눈다
+ * - 공유 블렌드 스페이스를 재생 중인 컴포넌트는 포즈 평가까지 게임 스레드에서 처리한다
+ * - 노티파이 실행, 물리 바디 동기화, 소켓 갱신은 게임 스레드에서 수집된 순서대로 처리하므로 결과가 결정적이다
+ */
+class FAnimationUpdateQueue
+{
+public:
+    explicit FAnimationUpdateQueue(UWorld* InWorld) : World(InWorld) {}
+
+    /** 액터 Tick 중에 호출. 이번 프레임 Flush에서 DeltaSeconds만큼 평가된다 */
+    void Enqueue(USkeletalMeshComponent* Component, float DeltaSeconds);
+
+    /** 등록 해제/파괴되는 컴포넌트를 큐에서 뺀다 (Flush 도중이면 슬롯만 비운다) */
+    void Remove(USkeletalMeshComponent* Component);
+
+    /** 모인 컴포넌트를 병렬 평가한 뒤 게임 스레드 후처리까지 끝내고 큐를 비운다 */
+    void Flush();
+
+    int32 Num() const { return PendingUpdates.Num(); }
+
+private:
+    struct FPendingUpdate
+    {
+        USkeletalMeshComponent* Component = nullptr;
+        float DeltaSeconds = 0.0f;
+    };
+
+    UWorld* World = nullptr;
+    // 프레임마다 다시 쓰는 배열 (용량 유지)
+    TArray<FPendingUpdate> PendingUpdates;
+    // 이번 Flush에서 병렬 평가할 PendingUpdates 인덱스
+    TArray<int32> ParallelIndices;
+    bool bFlushing = false;
+};
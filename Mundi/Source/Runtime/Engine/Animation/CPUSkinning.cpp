@@ -0,0 +1,89 @@
+﻿#include "pch.h"
+#include "CPUSkinning.h"
+#include <immintrin.h>
+#include "JobSystem.h"
+
+namespace
+{
+    // V.x * R0 + V.y * R1 + V.z * R2 (+ R3는 호출 측에서)
+    inline __m128 TransformRows3(float X, float Y, float Z, __m128 R0, __m128 R1, __m128 R2)
+    {
+        __m128 Result = _mm_mul_ps(_mm_set1_ps(X), R0);
+        Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Y), R1));
+        Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Z), R2));
+        return Result;
+    }
+
+    inline FVector ToVector(__m128 V)
+    {
+        alignas(16) float Out[4];
+        _mm_store_ps(Out, V);
+        return FVector(Out[0], Out[1], Out[2]);
+    }
+}
+
+void CPUSkinning::SkinVertexRange(const FSkinnedVertex* Src, FVertexDynamic* Dst, int32 Begin, int32 End,
+    const FMatrix* SkinMatrices, const FMatrix* NormalMatrices)
+{
+    for (int32 Idx = Begin; Idx < End; ++Idx)
+    {
+        const FSkinnedVertex& In = Src[Idx];
+
+        // 1. 영향 본 행렬을 가중치로 섞는다 (행렬 변환은 선형이라 "섞고 변환" == "변환하고 섞기")
+        __m128 R0 = _mm_setzero_ps();
+        __m128 R1 = _mm_setzero_ps();
+        __m128 R2 = _mm_setzero_ps();
+        __m128 R3 = _mm_setzero_ps();
+        __m128 N0 = _mm_setzero_ps();
+        __m128 N1 = _mm_setzero_ps();
+        __m128 N2 = _mm_setzero_ps();
+
+        for (int32 Influence = 0; Influence < 4; ++Influence)
+        {
+            const float Weight = In.BoneWeights[Influence];
+            if (Weight <= 0.f)
+            {
+                continue;
+            }
+
+            const __m128 W = _mm_set1_ps(Weight);
+            const uint32 BoneIndex = In.BoneIndices[Influence];
+            const FMatrix& Skin = SkinMatrices[BoneIndex];
+            const FMatrix& Normal = NormalMatrices[BoneIndex];
+
+            R0 = _mm_add_ps(R0, _mm_mul_ps(Skin.Rows[0], W));
+            R1 = _mm_add_ps(R1, _mm_mul_ps(Skin.Rows[1], W));
+            R2 = _mm_add_ps(R2, _mm_mul_ps(Skin.Rows[2], W));
+            R3 = _mm_add_ps(R3, _mm_mul_ps(Skin.Rows[3], W));
+            N0 = _mm_add_ps(N0, _mm_mul_ps(Normal.Rows[0], W));
+            N1 = _mm_add_ps(N1, _mm_mul_ps(Normal.Rows[1], W));
+            N2 = _mm_add_ps(N2, _mm_mul_ps(Normal.Rows[2], W));
+        }
+
+        // 2. 섞인 행렬 하나로 위치/법선/탄젠트 변환
+        const __m128 Position = _mm_add_ps(TransformRows3(In.Position.X, In.Position.Y, In.Position.Z, R0, R1, R2), R3);
+        const __m128 Normal = TransformRows3(In.Normal.X, In.Normal.Y, In.Normal.Z, N0, N1, N2);
+        const __m128 Tangent = TransformRows3(In.Tangent.X, In.Tangent.Y, In.Tangent.Z, R0, R1, R2);
+
+        const FVector TangentDir = ToVector(Tangent).GetSafeNormal();
+
+        // 3. 스택에서 완성한 뒤 한 번에 쓴다 (Map된 버퍼는 write-combined라 읽기/부분 쓰기를 피한다)
+        FVertexDynamic Out;
+        Out.Position = ToVector(Position);
+        Out.Normal = ToVector(Normal).GetSafeNormal();
+        Out.UV = In.UV;
+        Out.Tangent = FVector4(TangentDir.X, TangentDir.Y, TangentDir.Z, In.Tangent.W);
+        Out.Color = In.Color;
+        Dst[Idx] = Out;
+    }
+}
+
+void CPUSkinning::SkinVertices(const FSkinnedVertex* Src, FVertexDynamic* Dst, int32 NumVertices,
+    const FMatrix* SkinMatrices, const FMatrix* NormalMatrices)
+{
+    FJobSystem::GetInstance().ParallelFor(NumVertices, MinVerticesPerJob,
+        [Src, Dst, SkinMatrices, NormalMatrices](int32 Begin, int32 End)
+        {
+            SkinVertexRange(Src, Dst, Begin, End, SkinMatrices, NormalMatrices);
+        });
+}
@@ -0,0 +1,28 @@
+﻿#pragma once
+
+struct FSkinnedVertex;
+struct FVertexDynamic;
+
+/**
+ * CPU 스키닝 커널
+ * - 정점마다 영향 본(최대 4개)의 행렬 행을 SSE로 한 번만 섞고, 섞인 행렬 하나로 위치/법선/탄젠트를 함께 변환한다
+ * - 결과는 FVertexDynamic 레이아웃으로 바로 쓰므로 Map한 동적 정점 버퍼를 그대로 넘겨도 된다 (정점 단위 순차 쓰기)
+ * - 가중치 0인 정점도 빠짐없이 쓰므로 WRITE_DISCARD 버퍼에 써도 안전하다
+ */
+namespace CPUSkinning
+{
+    /** 워커 하나에 넘기는 최소 정점 수 (이보다 작은 메시는 호출 스레드에서 한 번에 처리) */
+    constexpr int32 MinVerticesPerJob = 4096;
+
+    /**
+     * [Begin, End) 구간 정점을 스키닝해서 Dst에 쓴다
+     * @param SkinMatrices   위치/탄젠트용 본 스키닝 행렬
+     * @param NormalMatrices 법선용 본 스키닝 행렬 (역전치)
+     */
+    void SkinVertexRange(const FSkinnedVertex* Src, FVertexDynamic* Dst, int32 Begin, int32 End,
+        const FMatrix* SkinMatrices, const FMatrix* NormalMatrices);
+
+    /** 정점 구간을 Job System 워커들에 나눠 스키닝한다 (호출 스레드도 첫 구간을 맡고, 끝날 때까지 반환하지 않는다) */
+    void SkinVertices(const FSkinnedVertex* Src, FVertexDynamic* Dst, int32 NumVertices,
+        const FMatrix* SkinMatrices, const FMatrix* NormalMatrices);
+}
@@ -157,14 +157,13 @@ void UTeam2AnimInstance::BuildStateMachine()
 // Update
 // ============================================================
 
-void UTeam2AnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+void UTeam2AnimInstance::NativeUpdateStateMachine(float DeltaSeconds)
 {
     // 파라미터 업데이트 먼저 수행
     UpdateParameters(DeltaSeconds);
 
-    // 부모 클래스의 NativeUpdateAnimation 호출
-    // 이 함수에서 상태머신의 ProcessState와 포즈 계산이 수행됨
-    Super::NativeUpdateAnimation(DeltaSeconds);
+    // 부모 클래스의 NativeUpdateStateMachine 호출 (상태머신의 ProcessState)
+    Super::NativeUpdateStateMachine(DeltaSeconds);
 }
 
 void UTeam2AnimInstance::UpdateParameters(float DeltaSeconds)
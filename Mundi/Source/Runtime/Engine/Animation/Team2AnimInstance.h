@@ -38,12 +38,12 @@ public:
     virtual void Initialize(USkeletalMeshComponent* InComponent) override;
 
     /**
-     * @brief 매 프레임 애니메이션 업데이트
+     * @brief 매 프레임 상태머신 업데이트 (게임 스레드)
      * - UpdateParameters로 파라미터 업데이트
-     * - Super::NativeUpdateAnimation으로 상태머신 처리 및 포즈 계산
+     * - Super::NativeUpdateStateMachine으로 상태머신 처리 (포즈 계산은 NativeEvaluateAnimation)
      * @param DeltaSeconds 프레임 시간
      */
-    virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+    virtual void NativeUpdateStateMachine(float DeltaSeconds) override;
 
 private:
     /**
@@ -3,6 +3,7 @@
 #include "Vector.h"
 #include "Frustum.h"
 #include "CameraComponent.h"
+#include "OBB.h"
 #include <immintrin.h> // For SSE, AVX, FMA instructions
 
 
@@ -221,109 +222,70 @@ bool IsAABBIntersects(const FFrustum& F, const FAABB& B)
 }
 
 
-// 추후에 절두체를 VP 행렬에서 바로 추출하는 방법도 필요하다면 아래를 참고.
 // ---------- VP(=View*Proj)에서 평면 추출 ----------
-// row-vector 규약(p' = p * M)에서 클립 경계는
-// Left:   R3 + R0
-// Right:  R3 - R0
-// Bottom: R3 + R1
-// Top:    R3 - R1
-// Near:   R3 + R2
-// Far:    R3 - R2
+// row-vector 규약(p' = p * M)에서 클립 좌표의 각 성분은 VP의 "열"과의 내적이다.
+// D3D 클립 공간(-w <= x,y <= w, 0 <= z <= w) 경계는
+// Left:   C3 + C0      Right:  C3 - C0
+// Bottom: C3 + C1      Top:    C3 - C1
+// Near:   C2           Far:    C3 - C2
 // 결합 결과 P=(a,b,c,d)에 대해:  a*x + b*y + c*z + d >= 0  (클립 내부)
-// 우리의 평면식 dot(N,X) - D >= 0 과 맞추려면  N=(a,b,c), D=-d  을 사용.
-// 정규화 스케일도 Distance에 나눠 반영해야 함.
-/*
-static inline FPlane MakePlaneFromRowCombo(const FVector4& R3, const FVector4& Ri, int Sign) // +1 or -1
+// 우리의 평면식 dot(N,X) - D >= 0 과 맞추려면  N=(a,b,c)/|N|, D=-d/|N|  을 사용.
+static FPlane MakePlaneFromClipEquation(float A, float B, float C, float D)
 {
-    // P = R3 + Sign * Ri
-    const FVector4 P(R3.X + Sign * Ri.X,
-        R3.Y + Sign * Ri.Y,
-        R3.Z + Sign * Ri.Z,
-        R3.W + Sign * Ri.W);
-
-    // 법선/거리 추출 및 정규화
     FPlane Out;
-    const FVector4 N(P.X, P.Y, P.Z, 0.0f);
-    const float    Len = Length3(N);
-
-    if (Len > 0.0f)
+    const float Len = std::sqrt(A * A + B * B + C * C);
+    if (Len > KINDA_SMALL_NUMBER)
     {
-        Out.Normal = FVector4(N.X / Len, N.Y / Len, N.Z / Len, 0.0f);
-        // dot(N,X) - D >= 0  와  a*x+b*y+c*z+d >= 0  을 맞추기 위해 D = -d/Len
-        Out.Distance = -P.W / Len;
-    }
-    else
-    {
-        Out.Normal = FVector4(0, 1, 0, 0);
-        Out.Distance = 0.0f;
+        const float InvLen = 1.0f / Len;
+        Out.Normal = FVector4(A * InvLen, B * InvLen, C * InvLen, 0.0f);
+        Out.Distance = -D * InvLen;
     }
     return Out;
 }
 
-// 카메라에서 VP를 구할 수 있다면 직접 사용.
-// 주의: row-vector 규약이면 반드시  VP = View * Proj  (이 순서)
-static Frustum CreateFrustumFromVP(const FMatrix& View, const FMatrix& Proj)
-{
-    const FMatrix VP = View * Proj;
-
-    // 행 접근 함수가 있다고 가정 (없다면 직접 구현)
-    const FVector4 R0 = VP.GetRow(0);
-    const FVector4 R1 = VP.GetRow(1);
-    const FVector4 R2 = VP.GetRow(2);
-    const FVector4 R3 = VP.GetRow(3);
-
-    Frustum F;
-    F.LeftFace = MakePlaneFromRowCombo(R3, R0, +1);
-    F.RightFace = MakePlaneFromRowCombo(R3, R0, -1);
-    F.BottomFace = MakePlaneFromRowCombo(R3, R1, +1);
-    F.TopFace = MakePlaneFromRowCombo(R3, R1, -1);
-    F.NearFace = MakePlaneFromRowCombo(R3, R2, +1);
-    F.FarFace = MakePlaneFromRowCombo(R3, R2, -1);
-    return F;
-}
-
-Frustum CreateFrustumFromCamera(const UCameraComponent& Camera, float)  // OverrideAspect
-{
-    // 카메라에서 뷰/프로젝션 행렬을 가져오는 API는 엔진에 맞춰 바꿔줘.
-    // row-vector 규약: p' = p * View * Proj
-    const FMatrix View = Camera.GetViewMatrix();         // 너의 엔진 API
-    const FMatrix Proj = Camera.GetProjectionMatrix();   // 너의 엔진 API
-    return CreateFrustumFromVP(View, Proj);
-}
-
-// ---------- AABB vs 평면 판정(기존 유지, std::abs 권장) ----------
-bool Intersects(const FPlane& P, const FVector4& Center, const FVector4& Extents)
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection)
 {
-    const float Distance = Dot3(P.Normal, Center) - P.Distance;
-
-    // AABB의 법선 방향 투영 반경
-    const float Radius =
-        std::abs(P.Normal.X) * Extents.X +
-        std::abs(P.Normal.Y) * Extents.Y +
-        std::abs(P.Normal.Z) * Extents.Z;
+    // 열 A + Sign * 열 B
+    const float(&M)[4][4] = ViewProjection.M;
+    auto Combine = [&M](int32 A, float Sign, int32 B)
+    {
+        return MakePlaneFromClipEquation(
+            M[0][A] + Sign * M[0][B],
+            M[1][A] + Sign * M[1][B],
+            M[2][A] + Sign * M[2][B],
+            M[3][A] + Sign * M[3][B]);
+    };
 
-    return Distance + Radius >= 0.0f;
+    FFrustum Result;
+    Result.LeftFace = Combine(3, +1.0f, 0);
+    Result.RightFace = Combine(3, -1.0f, 0);
+    Result.BottomFace = Combine(3, +1.0f, 1);
+    Result.TopFace = Combine(3, -1.0f, 1);
+    Result.NearFace = MakePlaneFromClipEquation(M[0][2], M[1][2], M[2][2], M[3][2]);
+    Result.FarFace = Combine(3, -1.0f, 2);
+    return Result;
 }
 
-bool IsAABBVisible(const Frustum& F, const FBound& B)
+bool IsOBBVisible(const FFrustum& Frustum, const FOBB& Bound)
 {
-    const FVector  Center3 = (B.Min + B.Max) * 0.5f;
-    const FVector  Extents3 = (B.Max - B.Min) * 0.5f; // 양수
-
-    const FVector4 Center = FVector4(Center3.X, Center3.Y, Center3.Z, 1.0f); // 점
-    const FVector4 Extents = FVector4(Extents3.X, Extents3.Y, Extents3.Z, 0.0f); // 방향
-
-    return Intersects(F.LeftFace, Center, Extents) &&
-        Intersects(F.RightFace, Center, Extents) &&
-        Intersects(F.TopFace, Center, Extents) &&
-        Intersects(F.BottomFace, Center, Extents) &&
-        Intersects(F.NearFace, Center, Extents) &&
-        Intersects(F.FarFace, Center, Extents);
+    // AABB 판정과 같되, 투영 반경을 OBB 축 기준으로 계산
+    const FPlane* Planes = &Frustum.TopFace;
+    for (int32 i = 0; i < 6; ++i)
+    {
+        const FVector Normal(Planes[i].Normal.X, Planes[i].Normal.Y, Planes[i].Normal.Z);
+        const float Distance = FVector::Dot(Normal, Bound.Center) - Planes[i].Distance;
+        const float Radius =
+            std::abs(FVector::Dot(Normal, Bound.Axes[0])) * Bound.HalfExtent.X +
+            std::abs(FVector::Dot(Normal, Bound.Axes[1])) * Bound.HalfExtent.Y +
+            std::abs(FVector::Dot(Normal, Bound.Axes[2])) * Bound.HalfExtent.Z;
+        if (Distance + Radius < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
-*/
-
 // AVX-optimized culling for 8 AABBs
 uint8_t AreAABBsVisible_8_AVX(const FFrustum& Frustum, const FAABB Bounds[8])
 {
@@ -425,4 +387,61 @@ uint8_t AreAABBsVisible_8_AVX(const FFrustum& Frustum, const FAABB Bounds[8])
     }
 
     return static_cast<uint8_t>(all_visible_mask);
-}
\ No newline at end of file
+}
+
+uint8_t ClassifyAABBs_4_SSE(const FFrustum& Frustum, const FAABB Bounds[4], uint8_t& OutInsideMask)
+{
+    // 1. AoS → SoA (AreAABBsVisible_8_AVX의 박스 0-3 전치와 동일)
+    __m128 r0 = _mm_loadu_ps(&Bounds[0].Min.X); // {m0x, m0y, m0z, M0x}
+    __m128 r1 = _mm_loadu_ps(&Bounds[1].Min.X);
+    __m128 r2 = _mm_loadu_ps(&Bounds[2].Min.X);
+    __m128 r3 = _mm_loadu_ps(&Bounds[3].Min.X);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    const __m128 min_x = r0;
+    const __m128 min_y = r1;
+    const __m128 min_z = r2;
+    const __m128 max_x = r3;
+
+    const __m128 myz01 = _mm_castpd_ps(_mm_unpacklo_pd(_mm_load_sd((double*)&Bounds[0].Max.Y), _mm_load_sd((double*)&Bounds[1].Max.Y)));
+    const __m128 myz23 = _mm_castpd_ps(_mm_unpacklo_pd(_mm_load_sd((double*)&Bounds[2].Max.Y), _mm_load_sd((double*)&Bounds[3].Max.Y)));
+    const __m128 max_y = _mm_shuffle_ps(myz01, myz23, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 max_z = _mm_shuffle_ps(myz01, myz23, _MM_SHUFFLE(3, 1, 3, 1));
+
+    // 2. 중심 / 반길이
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 centers_x = _mm_mul_ps(_mm_add_ps(max_x, min_x), half);
+    const __m128 centers_y = _mm_mul_ps(_mm_add_ps(max_y, min_y), half);
+    const __m128 centers_z = _mm_mul_ps(_mm_add_ps(max_z, min_z), half);
+    const __m128 extents_x = _mm_mul_ps(_mm_sub_ps(max_x, min_x), half);
+    const __m128 extents_y = _mm_mul_ps(_mm_sub_ps(max_y, min_y), half);
+    const __m128 extents_z = _mm_mul_ps(_mm_sub_ps(max_z, min_z), half);
+
+    // 3. 평면마다 Distance ± Radius 부호로 "밖" / "완전 안" 을 동시에 누적
+    const FPlane* planes = &Frustum.TopFace;
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    __m128 inside = visible;
+
+    for (int i = 0; i < 6; ++i)
+    {
+        const FPlane& p = planes[i];
+        const __m128 plane_nx = _mm_set1_ps(p.Normal.X);
+        const __m128 plane_ny = _mm_set1_ps(p.Normal.Y);
+        const __m128 plane_nz = _mm_set1_ps(p.Normal.Z);
+
+        const __m128 dist = _mm_sub_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(centers_x, plane_nx), _mm_mul_ps(centers_y, plane_ny)), _mm_mul_ps(centers_z, plane_nz)),
+            _mm_set1_ps(p.Distance));
+
+        const __m128 radius = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(extents_x, _mm_andnot_ps(sign_mask, plane_nx)), _mm_mul_ps(extents_y, _mm_andnot_ps(sign_mask, plane_ny))),
+            _mm_mul_ps(extents_z, _mm_andnot_ps(sign_mask, plane_nz)));
+
+        visible = _mm_and_ps(visible, _mm_cmpge_ps(_mm_add_ps(dist, radius), zero));
+        inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_sub_ps(dist, radius), zero));
+    }
+
+    OutInsideMask = static_cast<uint8_t>(_mm_movemask_ps(inside));
+    return static_cast<uint8_t>(_mm_movemask_ps(visible));
+}
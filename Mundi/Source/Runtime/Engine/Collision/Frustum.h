@@ -5,6 +5,7 @@
 
 class UCameraComponent;
 struct FAABB;
+struct FOBB;
 
 struct FPlane
 {
@@ -26,12 +27,20 @@ struct FFrustum
 };
 
 FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideAspect = -1.0f);
+// 행벡터 규약 View * Projection 행렬에서 6평면을 뽑는다 (원근/직교, 카메라/라이트 모두 사용 가능)
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection);
 bool IsAABBVisible(const FFrustum& Frustum, const FAABB& Bound);
 bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
+bool IsOBBVisible(const FFrustum& Frustum, const FOBB& Bound);
 
 // AVX-optimized culling for 8 AABBs
 // Processes 8 AABBs against the frustum.
 // Returns an 8-bit mask: bit i is set if box i is visible.
 uint8_t AreAABBsVisible_8_AVX(const FFrustum& Frustum, const FAABB Bounds[8]);
 
+// SSE로 연속된 AABB 4개를 6평면에 대해 한 번에 분류
+// 반환값 하위 4비트: 보이는 박스 (IsAABBVisible과 같은 판정)
+// OutInsideMask 하위 4비트: 6평면 모두의 안쪽에 완전히 들어온 박스
+uint8_t ClassifyAABBs_4_SSE(const FFrustum& Frustum, const FAABB Bounds[4], uint8_t& OutInsideMask);
+
 bool Intersects(const FPlane& P, const FVector4& Center, const FVector4& Extents);
\ No newline at end of file
@@ -0,0 +1,252 @@
+﻿#include "pch.h"
+#include "ShapeOverlapScene.h"
+
+#include "Collision.h"
+#include "JobSystem.h"
+#include "OBB.h"
+#include "PlatformTime.h"
+#include "ShapeComponent.h"
+#include "World.h"
+#include "../Physics/BodyInstance.h"
+
+FAABB FShapeOverlapScene::ComputeShapeBounds(const FShape& Shape, const FTransform& WorldTransform)
+{
+    switch (Shape.Kind)
+    {
+    case EShapeKind::Sphere:
+    {
+        const float Radius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(Collision::AbsVec(WorldTransform.Scale3D));
+        const FVector R(Radius, Radius, Radius);
+        return FAABB(WorldTransform.Translation - R, WorldTransform.Translation + R);
+    }
+    case EShapeKind::Capsule:
+    {
+        FVector P0, P1;
+        float Radius = 0.0f;
+        Collision::BuildCapsule(Shape, WorldTransform, P0, P1, Radius);
+        const FVector R(Radius, Radius, Radius);
+        return FAABB(
+            FVector(FMath::Min(P0.X, P1.X), FMath::Min(P0.Y, P1.Y), FMath::Min(P0.Z, P1.Z)) - R,
+            FVector(FMath::Max(P0.X, P1.X), FMath::Max(P0.Y, P1.Y), FMath::Max(P0.Z, P1.Z)) + R);
+    }
+    case EShapeKind::Box:
+    default:
+    {
+        // OBB의 월드 AABB 반경 = 각 축 방향 HalfExtent 투영의 합
+        FOBB Box;
+        Collision::BuildOBB(Shape, WorldTransform, Box);
+        FVector Extent = FVector::Zero();
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const FVector Scaled = Box.Axes[Axis] * Box.HalfExtent[Axis];
+            Extent.X += FMath::Abs(Scaled.X);
+            Extent.Y += FMath::Abs(Scaled.Y);
+            Extent.Z += FMath::Abs(Scaled.Z);
+        }
+        return FAABB(Box.Center - Extent, Box.Center + Extent);
+    }
+    }
+}
+
+void FShapeOverlapScene::BeginFrame()
+{
+    bResolved = false;
+}
+
+void FShapeOverlapScene::GatherContacts(const UShapeComponent* Shape, TArray<FHitResult>& OutHits, TArray<FHitResult>& OutOverlaps, FVector& OutPushOut)
+{
+    OutPushOut = FVector::Zero();
+
+    if (!bResolved)
+    {
+        Resolve();
+    }
+
+    const int32* Found = ShapeIndices.Find(Shape);
+    if (!Found)
+    {
+        // 이번 프레임 해석 이후에 생긴 컴포넌트는 다음 프레임부터
+        return;
+    }
+
+    const int32 ShapeIndex = *Found;
+    const bool bBlock = Shape->GetBlockComponent();
+    const bool bOverlap = Shape->GetGenerateOverlapEvents();
+    for (int32 i = ContactStart[ShapeIndex]; i < ContactStart[ShapeIndex + 1]; ++i)
+    {
+        const FContact& Contact = Contacts[i];
+        if (bBlock)
+        {
+            OutHits.Add(Contact.Hit);
+        }
+        if (bOverlap)
+        {
+            OutOverlaps.Add(Contact.Hit);
+        }
+        OutPushOut += -Contact.Hit.ImpactNormal * (Contact.Hit.PenetrationDepth * Contact.PushOutScale);
+    }
+}
+
+void FShapeOverlapScene::CollectWorldShapes()
+{
+    WorldShapes.Empty();
+
+    if (!World)
+    {
+        return;
+    }
+
+    for (AActor* Actor : World->GetActors())
+    {
+        if (!Actor || !Actor->IsActorActive())
+        {
+            continue;
+        }
+
+        for (USceneComponent* Comp : Actor->GetSceneComponents())
+        {
+            if (UShapeComponent* ShapeComp = Cast<UShapeComponent>(Comp))
+            {
+                WorldShapes.Add(ShapeComp);
+            }
+        }
+    }
+}
+
+void FShapeOverlapScene::AddShape(UShapeComponent* ShapeComp)
+{
+    FShapeEntry Entry;
+    Entry.Component = ShapeComp;
+    Entry.Owner = ShapeComp->GetOwner();
+    Entry.bParticipates = ShapeComp->GetGenerateOverlapEvents() || ShapeComp->GetBlockComponent();
+
+    // PhysX 바디가 있는 셰이프는 PhysX가 처리하므로 상대 입장에서만 검사된다
+    FBodyInstance* Body = ShapeComp->GetBodyInstance();
+    Entry.bResponds = Entry.bParticipates && !(Body && Body->RigidActor);
+
+    if (!Entry.bParticipates)
+    {
+        return;
+    }
+
+    // 월드 트랜스폼 캐시를 여기서 채워 두면 병렬 내로우 페이즈에서는 읽기만 한다
+    FShape Shape;
+    ShapeComp->GetShape(Shape);
+    Bounds.Add(ComputeShapeBounds(Shape, ShapeComp->GetWorldTransform()));
+
+    ShapeIndices.Add(ShapeComp, Shapes.Num());
+    Shapes.Add(Entry);
+}
+
+void FShapeOverlapScene::Resolve()
+{
+    CollectWorldShapes();
+    ResolveShapes(WorldShapes);
+}
+
+void FShapeOverlapScene::ResolveShapes(const TArray<UShapeComponent*>& InShapes)
+{
+    bResolved = true;
+
+    Shapes.Empty();
+    Bounds.Empty();
+    ShapeIndices.Empty();
+    for (UShapeComponent* ShapeComp : InShapes)
+    {
+        if (ShapeComp)
+        {
+            AddShape(ShapeComp);
+        }
+    }
+
+    const int32 NumShapes = Shapes.Num();
+    ContactStart.SetNum(NumShapes + 1);
+    std::fill(ContactStart.begin(), ContactStart.end(), 0);
+    Contacts.Empty();
+
+    // 1. 브로드 페이즈: 후보 쌍 (대칭 쌍은 한 번만)
+    {
+        TIME_PROFILE(Shape_Broadphase)
+        Broadphase.FindOverlappingPairs(Bounds, CandidatePairs);
+
+        // 같은 액터끼리, 양쪽 다 결과를 처리하지 않는 쌍은 제외
+        int32 Kept = 0;
+        for (const FSweepAndPrune::FPair& Pair : CandidatePairs)
+        {
+            const FShapeEntry& A = Shapes[Pair.A];
+            const FShapeEntry& B = Shapes[Pair.B];
+            if (A.Owner == B.Owner || (!A.bResponds && !B.bResponds))
+            {
+                continue;
+            }
+            CandidatePairs[Kept++] = Pair;
+        }
+        CandidatePairs.SetNum(Kept);
+    }
+
+    // 2. 내로우 페이즈: 후보 쌍을 배치로 나눠 병렬 처리 (셰이프 상태는 읽기만 한다)
+    {
+        TIME_PROFILE(Shape_Narrowphase)
+        PairResults.SetNum(CandidatePairs.Num());
+        FJobSystem::GetInstance().ParallelFor(CandidatePairs.Num(), NarrowphaseBatchSize, [this](int32 Begin, int32 End)
+        {
+            for (int32 i = Begin; i < End; ++i)
+            {
+                const FSweepAndPrune::FPair& Pair = CandidatePairs[i];
+                FHitResult& Result = PairResults[i];
+                Result.Reset();
+                Result.bHit = Collision::ComputePenetration(Shapes[Pair.A].Component, Shapes[Pair.B].Component, Result);
+            }
+        });
+    }
+
+    // 3. 쌍 결과를 양쪽 컴포넌트 기준 접촉으로 나눠 CSR로 정리 (Count → Prefix Sum → Fill)
+    auto ForEachContactSide = [this](int32 PairIndex, auto&& Body)
+    {
+        const FHitResult& Result = PairResults[PairIndex];
+        if (!Result.bHit)
+        {
+            return;
+        }
+
+        const FSweepAndPrune::FPair& Pair = CandidatePairs[PairIndex];
+        const FShapeEntry& A = Shapes[Pair.A];
+        const FShapeEntry& B = Shapes[Pair.B];
+
+        // 예전에는 먼저 Tick한 쪽이 전부 밀려났다. 양쪽 다 반응하면 절반씩 밀어 합이 같게 한다
+        const float PushOutScale = (A.bResponds && B.bResponds) ? 0.5f : 1.0f;
+        if (A.bResponds)
+        {
+            Body(Pair.A, Pair.B, Result.ImpactNormal, PushOutScale);
+        }
+        if (B.bResponds)
+        {
+            Body(Pair.B, Pair.A, -Result.ImpactNormal, PushOutScale);
+        }
+    };
+
+    for (int32 i = 0; i < CandidatePairs.Num(); ++i)
+    {
+        ForEachContactSide(i, [this](int32 Self, int32, const FVector&, float) { ++ContactStart[Self + 1]; });
+    }
+    for (int32 i = 0; i < NumShapes; ++i)
+    {
+        ContactStart[i + 1] += ContactStart[i];
+    }
+
+    Contacts.SetNum(ContactStart[NumShapes]);
+    TArray<int32> Cursor(ContactStart.begin(), ContactStart.end() - 1);
+    for (int32 i = 0; i < CandidatePairs.Num(); ++i)
+    {
+        const FHitResult& Result = PairResults[i];
+        ForEachContactSide(i, [this, &Cursor, &Result](int32 Self, int32 Other, const FVector& Normal, float PushOutScale)
+        {
+            FContact& Contact = Contacts[Cursor[Self]++];
+            Contact.Hit = Result;
+            Contact.Hit.ImpactNormal = Normal;
+            Contact.Hit.HitComponent = Shapes[Other].Component;
+            Contact.Hit.HitActor = Shapes[Other].Owner;
+            Contact.PushOutScale = PushOutScale;
+        });
+    }
+}
@@ -0,0 +1,86 @@
+﻿#pragma once
+#include "AABB.h"
+#include "DamageTypes.h"
+#include "SweepAndPrune.h"
+
+class UWorld;
+class AActor;
+class UShapeComponent;
+struct FShape;
+
+/**
+ * 월드 하나의 셰이프 컴포넌트 겹침 씬 (UWorld 소유)
+ * - 프레임마다 첫 요청에서 모든 셰이프의 월드 AABB로 Sweep and Prune을 돌려 후보 쌍을 한 번 만든다
+ * - 후보 쌍은 (A, B) 한 번씩만 나오므로 예전처럼 양쪽 컴포넌트가 서로를 따로 검사하지 않는다
+ * - 내로우 페이즈(ComputePenetration)는 후보 쌍 배열을 Job System에 배치로 나눠 돌린다
+ * - 결과는 양쪽 컴포넌트 기준 접촉으로 나눠 두고, 각 컴포넌트가 자기 Tick에서 꺼내 간다
+ */
+class FShapeOverlapScene
+{
+public:
+    explicit FShapeOverlapScene(UWorld* InWorld) : World(InWorld) {}
+
+    /** UWorld::Tick 시작 시 호출 (지난 프레임 결과 무효화) */
+    void BeginFrame();
+
+    /**
+     * 이번 프레임에 Shape가 받은 접촉 (첫 호출에서 브로드/내로우 페이즈를 수행)
+     * @param OutHits       Shape가 Block이면 채워짐
+     * @param OutOverlaps   Shape가 Overlap 이벤트를 만들면 채워짐
+     * @param OutPushOut    겹침을 풀기 위해 Shape가 움직여야 하는 월드 오프셋 (상대도 밀리면 절반씩)
+     */
+    void GatherContacts(const UShapeComponent* Shape, TArray<FHitResult>& OutHits, TArray<FHitResult>& OutOverlaps, FVector& OutPushOut);
+
+    /**
+     * 월드를 순회하지 않고 주어진 셰이프들로 이번 프레임을 해석 (콘솔 벤치마크처럼 월드 밖에서 만든 입력용)
+     * 이후 BeginFrame 전까지 GatherContacts는 이 결과를 돌려준다
+     */
+    void ResolveShapes(const TArray<UShapeComponent*>& InShapes);
+
+    /** 마지막 해석의 필터링된 후보 쌍 수 / 브로드 페이즈가 전체 정렬을 했는지 (통계용) */
+    int32 GetNumCandidatePairs() const { return CandidatePairs.Num(); }
+    bool DidFullSortLastResolve() const { return Broadphase.DidFullSortLastCall(); }
+
+    /** FShape + 월드 트랜스폼의 월드 AABB (내로우 페이즈와 같은 스케일 규칙) */
+    static FAABB ComputeShapeBounds(const FShape& Shape, const FTransform& WorldTransform);
+
+    /** 내로우 페이즈 Job 하나가 맡는 최소 후보 쌍 수 */
+    static constexpr int32 NarrowphaseBatchSize = 64;
+
+private:
+    struct FShapeEntry
+    {
+        UShapeComponent* Component = nullptr;
+        AActor* Owner = nullptr;
+        bool bParticipates = false; // 상대 입장에서 검사 대상인가 (Overlap 또는 Block)
+        bool bResponds = false;     // 자기 Tick에서 결과를 처리하는가 (PhysX 바디가 없고 Overlap 또는 Block)
+    };
+
+    struct FContact
+    {
+        FHitResult Hit;             // 이 컴포넌트 기준 (ImpactNormal 반대 방향으로 밀려남)
+        float PushOutScale = 1.0f;
+    };
+
+    void Resolve();
+    void CollectWorldShapes();
+    void AddShape(UShapeComponent* ShapeComp);
+
+    UWorld* World = nullptr;
+    bool bResolved = false;
+
+    // 이번 프레임 입력
+    TArray<UShapeComponent*> WorldShapes;
+    TArray<FShapeEntry> Shapes;
+    TArray<FAABB> Bounds;
+    TMap<const UShapeComponent*, int32> ShapeIndices;
+
+    // 브로드/내로우 페이즈 작업 버퍼 (용량 유지)
+    FSweepAndPrune Broadphase;
+    TArray<FSweepAndPrune::FPair> CandidatePairs;
+    TArray<FHitResult> PairResults;
+
+    // 셰이프 i의 접촉 = Contacts[ContactStart[i] .. ContactStart[i + 1])
+    TArray<int32> ContactStart;
+    TArray<FContact> Contacts;
+};
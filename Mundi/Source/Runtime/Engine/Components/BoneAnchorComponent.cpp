@@ -120,7 +120,7 @@ void UBoneAnchorComponent::OnTransformUpdated()
 
             // 소켓에 붙어있으면 소켓 트랜스폼 가져오기
             FName SocketName = PreviewMesh->GetAttachSocketName();
-            if (!SocketName.ToString().empty())
+            if (!SocketName.IsNone())
             {
                 if (USkeletalMeshComponent* SkelParent = Cast<USkeletalMeshComponent>(Parent))
                 {
@@ -175,8 +175,8 @@ void UBoneAnchorComponent::OnTransformUpdated()
         {
             if (Child && Child->GetAttachSocketName() == SocketName)
             {
-                // OnTransformUpdated는 USceneComponent에서 public
-                Child->OnTransformUpdated();
+                // 소켓 데이터만 바뀌어 포즈 리비전이 그대로이므로 직접 전파
+                Child->PropagateTransformUpdate();
             }
         }
     }
@@ -206,7 +206,7 @@ void UBoneAnchorComponent::OnTransformUpdated()
                         {
                             if (Child && Child->GetAttachSocketName() == SocketName)
                             {
-                                Child->OnTransformUpdated();
+                                Child->PropagateTransformUpdate();
                             }
                         }
                     }
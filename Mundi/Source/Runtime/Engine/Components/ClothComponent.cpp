@@ -421,9 +421,10 @@ void UClothComponent::CheckClothSetting()
 	ApplyClothProperties();
 }
 
-void UClothComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void UClothComponent::PrepareMeshBatches(const FSceneView* View)
 {
-	// ClothComponent는 자체 렌더링 로직을 사용 (Super 호출하지 않음)
+	// 스키닝은 하지 않으므로 USkinnedMeshComponent를 건너뛰고 월드 행렬 캐시만 채운다
+	UPrimitiveComponent::PrepareMeshBatches(View);
 
 	// 1. SkeletalMesh 유효성 검사
 	if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData())
@@ -441,7 +442,7 @@ void UClothComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatch
 	if (!CPUSkinnedVertexBuffer)
 	{
 		SkeletalMesh->CreateCPUSkinnedVertexBuffer(&CPUSkinnedVertexBuffer);
-		UE_LOG("[ClothComponent] Created CPUSkinnedVertexBuffer in CollectMeshBatches");
+		UE_LOG("[ClothComponent] Created CPUSkinnedVertexBuffer in PrepareMeshBatches");
 	}
 
 	// 3. CPU 버퍼 업데이트
@@ -472,6 +473,16 @@ void UClothComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatch
 
 		SkeletalMesh->UpdateVertexBuffer(SkinnedVertices, CPUSkinnedVertexBuffer);
 	}
+}
+
+void UClothComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+{
+	// ClothComponent는 자체 렌더링 로직을 사용 (Super 호출하지 않음)
+	// 버퍼 생성/갱신은 PrepareMeshBatches에서 끝났다 (여기는 워커 스레드에서 호출될 수 있음)
+	if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData() || !CPUSkinnedVertexBuffer)
+	{
+		return;
+	}
 
 	// 4. Material & Shader 결정
 	UMaterialInterface* Material = GetMaterial(0);
@@ -94,6 +94,7 @@ public:
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime) override;
 	virtual void OnCreatePhysicsState() override;
+	virtual void PrepareMeshBatches(const FSceneView* View) override;
 	virtual void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
 	virtual void DuplicateSubObjects() override;
 	virtual FAABB GetWorldAABB() const override;
@@ -17,6 +17,7 @@
 #include "Source/Runtime/Engine/Particle/ParticleEmitterInstance.h"
 #include "Source/Runtime/Engine/Particle/ParticleLODLevel.h"
 #include "Source/Runtime/Engine/Particle/ParticleStats.h"
+#include "Source/Runtime/Engine/Particle/Async/ParticleCollisionScene.h"
 #include "Source/Runtime/Engine/Particle/Modules/ParticleModuleMesh.h"
 #include "Source/Runtime/Engine/Particle/Modules/ParticleModuleLocation.h"
 #include "Source/Runtime/Engine/Particle/Modules/ParticleModuleRibbon.h"
@@ -136,65 +137,17 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
     Context.CameraLocation = Camera ? Camera->GetWorldLocation() : FVector();
     Context.CameraRotation = Camera ? Camera->GetWorldRotation() : FQuat();
 
-    if (GetWorld() && GetWorld()->GetPartitionManager())
+    // 충돌 모듈이 있는 시스템만 월드 공유 콜라이더 Grid를 받아간다 (프레임당 한 번 빌드)
+    if (Template->HasCollisionModule() && GetWorld() && GetWorld()->GetParticleCollisionScene())
     {
-        float SearchRadius = 1000.0f; // 이거 나중에 ParticleSystem Asset에 정보 추가!!!!!!! 
+        const float SearchRadius = Template->CollisionQueryRadius;
         FVector Center = GetWorldLocation();
         
         FAABB QueryBox;
         QueryBox.Min = Center - FVector(SearchRadius, SearchRadius, SearchRadius);
         QueryBox.Max = Center + FVector(SearchRadius, SearchRadius, SearchRadius);
 
-        TArray<UPrimitiveComponent*> Candidates = GetWorld()->GetPartitionManager()->GetBVH()->QueryIntersectedComponents(QueryBox);
-        Context.WorldColliders.Reserve(Candidates.Num());
-
-        for (UPrimitiveComponent* Prim : Candidates)
-        {
-            UShapeComponent* ShapeComponent = Cast<UShapeComponent>(Prim);
-            if (!ShapeComponent) continue;
-
-            const FTransform& TF = ShapeComponent->GetWorldTransform();
-            FVector WorldLoc = TF.Translation;
-            FQuat WorldRot = TF.Rotation;
-            FVector Scale = TF.Scale3D;
-
-            FColliderProxy Proxy;
-            // [BOX]
-            if (UBoxComponent* BoxComp = Cast<UBoxComponent>(ShapeComponent))
-            {
-                Proxy.Type = EShapeKind::Box;
-                FShape Shape; BoxComp->GetShape(Shape);
-                FOBB OBB; Collision::BuildOBB(Shape, TF, OBB);
-                Proxy.Box = OBB;
-            }
-            // [SPHERE]
-            else if (USphereComponent* SphereComp = Cast<USphereComponent>(ShapeComponent))
-            {
-                Proxy.Type = EShapeKind::Sphere;
-                Proxy.Sphere.Center = WorldLoc;
-                // 가장 큰 축의 스케일을 적용
-                float MaxScale = Scale.GetMaxValue();
-                Proxy.Sphere.Radius = SphereComp->SphereRadius * MaxScale;
-            }
-            // [CAPSULE]
-            else if (UCapsuleComponent* CapsuleComp = Cast<UCapsuleComponent>(ShapeComponent))
-            {
-                Proxy.Type = EShapeKind::Capsule;
-                float UnscaledRadius = CapsuleComp->CapsuleRadius;
-                float ScaledRadius = UnscaledRadius * FMath::Max(FMath::Abs(Scale.X), FMath::Abs(Scale.Y));
-                float UnscaledHalfHeight = CapsuleComp->CapsuleHalfHeight;
-                float ScaledHalfHeight = UnscaledHalfHeight * FMath::Abs(Scale.Z);
-
-                float CylHalfHeight = FMath::Max(0.0f, ScaledHalfHeight - ScaledRadius);
-
-                FVector UpAxis = WorldRot.RotateVector(FVector{0, 0, 1});
-                Proxy.Capsule.Radius = ScaledRadius;
-                Proxy.Capsule.PosA = WorldLoc - (UpAxis * CylHalfHeight);
-                Proxy.Capsule.PosB = WorldLoc + (UpAxis * CylHalfHeight);
-            }
-
-            Context.WorldColliders.Add(Proxy);
-        }
+        Context.ColliderGrid = GetWorld()->GetParticleCollisionScene()->AcquireGrid(QueryBox);
     }
     
     if (bUseAsyncSimulation)
@@ -206,7 +159,7 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
                 InitParticles();
             }
             // 워커가 놀고 있으면 누적된 시간만큼 일 시킴
-            AsyncUpdater.KickOff(EmitterInstances, Context);
+            AsyncUpdater.KickOff(EmitterInstances, std::move(Context));
             AccumulatedDeltaTime = 0;
         }
     }
@@ -216,13 +169,20 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
         {
             InitParticles();
         }
-        AsyncUpdater.KickOffSync(EmitterInstances, Context);
+        AsyncUpdater.KickOffSync(EmitterInstances, std::move(Context));
         AccumulatedDeltaTime = 0;
     }
 
     // [Main Thread] 캐싱된 통계 데이터 사용
     const FParticleFrameStats& Stats = AsyncUpdater.LastFrameStats;
     FParticleStatManager::GetInstance().AddParticleCount(Stats.TotalActiveParticles);
+    FParticleStatManager::GetInstance().AddHeapAllocations(Stats.HeapAllocations);
+    // Job이 밀려 같은 결과를 다시 읽는 프레임에 중복 집계하지 않도록 비운다
+    AsyncUpdater.LastFrameStats.HeapAllocations = 0;
+    for (const FParticleEmitterSortStat& SortStat : Stats.SortStats)
+    {
+        FParticleStatManager::GetInstance().AddEmitterSortStat(SortStat);
+    }
 
     // 종료 처리
     if (bIsActive && Stats.bAllEmittersComplete)
@@ -42,7 +42,13 @@ public:
 
     virtual FAABB GetWorldAABB() const { return FAABB(); }
 
+    // CollectMeshBatches 직전에 메인 스레드에서 직렬로 호출됩니다.
+    // D3D 리소스 갱신(스키닝 버퍼 업로드 등)처럼 워커 스레드에서 할 수 없는 일은 여기서 끝내야 합니다.
+    // 기본 구현은 월드 행렬 캐시를 미리 채워 수집 중에는 읽기만 일어나게 합니다.
+    virtual void PrepareMeshBatches(const FSceneView* View) { GetWorldMatrix(); }
+
     // 이 프리미티브를 렌더링하는 데 필요한 FMeshBatchElement를 수집합니다.
+    // 여러 컴포넌트가 워커 스레드에서 동시에 호출할 수 있으므로 컴포넌트 상태를 바꾸지 않아야 합니다.
     virtual void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) {}
 
     virtual UMaterialInterface* GetMaterial(uint32 InElementIndex) const
@@ -147,7 +153,7 @@ protected:
     UPROPERTY(EditAnywhere, Category="Shape")
     bool bBlockComponent;
 
-    FBodyInstance* BodyInstance;
+    FBodyInstance* BodyInstance = nullptr;
 
     // 현재 프레임 감지된 충돌 후보 큐
     TArray<FHitResult> PendingOverlaps;
@@ -10,6 +10,7 @@
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 // USceneComponent.cpp
 TMap<uint32, USceneComponent*> USceneComponent::SceneIdMap;
+std::atomic<uint32> USceneComponent::WorldTransformRecomposeCount{ 0 };
 
 USceneComponent::USceneComponent()
     : RelativeLocation(0, 0, 0)
@@ -53,7 +54,7 @@ void USceneComponent::SetRelativeLocation(const FVector& NewLocation)
 {
     RelativeLocation = NewLocation;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 FVector USceneComponent::GetRelativeLocation() const { return RelativeLocation; }
 
@@ -62,7 +63,7 @@ void USceneComponent::SetRelativeRotation(const FQuat& NewRotation)
     RelativeRotation = NewRotation;
     RelativeRotationEuler = NewRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 FQuat USceneComponent::GetRelativeRotation() const { return RelativeRotation; }
 
@@ -76,7 +77,7 @@ void USceneComponent::SetRelativeRotationEuler(const FVector& EulerDegrees)
 
     // Euler 재계산 하지 않음 - UI에서 입력한 값을 그대로 유지
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 FVector USceneComponent::GetRelativeRotationEuler() const
@@ -89,7 +90,7 @@ void USceneComponent::SetRelativeScale(const FVector& NewScale)
 {
     RelativeScale = NewScale;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 FVector USceneComponent::GetRelativeScale() const { return RelativeScale; }
 
@@ -97,7 +98,7 @@ void USceneComponent::AddRelativeLocation(const FVector& DeltaLocation)
 {
     RelativeLocation = RelativeLocation + DeltaLocation;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::AddRelativeRotation(const FQuat& DeltaRotation)
@@ -105,7 +106,7 @@ void USceneComponent::AddRelativeRotation(const FQuat& DeltaRotation)
     RelativeRotation = DeltaRotation * RelativeRotation;
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
@@ -114,7 +115,7 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
         RelativeScale.Y * DeltaScale.Y,
         RelativeScale.Z * DeltaScale.Z);
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 // ──────────────────────────────
@@ -122,25 +123,58 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
 // ──────────────────────────────
 FTransform USceneComponent::GetWorldTransform() const
 {
-    // Dangling pointer 방지를 위한 체크
-    if (AttachParent && !AttachParent->IsPendingDestroy())
+    // Dangling pointer 방지를 위한 체크 (파괴 중인 부모는 기준으로 쓰지 않는다)
+    if (AttachParent && AttachParent->IsPendingDestroy())
     {
-        // 소켓에 부착된 경우 소켓 위치 기준으로 계산
-        if (!AttachSocketName.ToString().empty())
+        return RelativeTransform;
+    }
+
+    if (IsSocketPoseStale())
+    {
+        // 포즈 변경은 PropagateTransformUpdate를 거치지 않을 수 있으므로 자식 캐시까지 여기서 무효화
+        MarkWorldTransformDirty();
+    }
+
+    if (bIsTransformDirty)
+    {
+        // 부모 쪽도 캐시를 쓰므로 조상 체인 전체를 다시 합성하지 않는다
+        CachedWorldTransform = AttachParent
+            ? GetAttachParentWorldTransform().GetWorldTransform(RelativeTransform)
+            : RelativeTransform;
+        bIsTransformDirty = false;
+        bIsWorldMatrixDirty = true;
+        WorldTransformRecomposeCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    return CachedWorldTransform;
+}
+
+FTransform USceneComponent::GetAttachParentWorldTransform() const
+{
+    // 소켓에 부착된 경우 소켓 위치 기준으로 계산
+    if (!AttachSocketName.IsNone())
+    {
+        // 부모가 SkeletalMeshComponent인지 확인
+        const USkeletalMeshComponent* SkelMeshParent = Cast<USkeletalMeshComponent>(AttachParent);
+        if (SkelMeshParent)
         {
-            // 부모가 SkeletalMeshComponent인지 확인
-            USkeletalMeshComponent* SkelMeshParent = Cast<USkeletalMeshComponent>(AttachParent);
-            if (SkelMeshParent && SkelMeshParent->DoesSocketExist(AttachSocketName))
+            CachedSocketPoseRevision = SkelMeshParent->GetPoseRevision();
+            if (SkelMeshParent->DoesSocketExist(AttachSocketName))
             {
-                FTransform SocketTransform = SkelMeshParent->GetSocketTransform(AttachSocketName);
-                return SocketTransform.GetWorldTransform(RelativeTransform);
+                return SkelMeshParent->GetSocketTransform(AttachSocketName);
             }
         }
-
-        return AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
     }
+    return AttachParent->GetWorldTransform();
+}
 
-    return RelativeTransform;
+bool USceneComponent::IsSocketPoseStale() const
+{
+    if (!AttachParent || AttachSocketName.IsNone())
+    {
+        return false;
+    }
+    const USkeletalMeshComponent* SkelMeshParent = Cast<USkeletalMeshComponent>(AttachParent);
+    return SkelMeshParent && SkelMeshParent->GetPoseRevision() != CachedSocketPoseRevision;
 }
 
 void USceneComponent::SetWorldTransform(const FTransform& W)
@@ -148,7 +182,8 @@ void USceneComponent::SetWorldTransform(const FTransform& W)
     // Dangling pointer 방지를 위한 체크
     if (AttachParent && !AttachParent->IsPendingDestroy())
     {
-        const FTransform ParentWorld = AttachParent->GetWorldTransform();
+        // 소켓에 붙어 있으면 소켓 기준 상대 트랜스폼
+        const FTransform ParentWorld = GetAttachParentWorldTransform();
         RelativeTransform = ParentWorld.GetRelativeTransform(W);
     }
     else
@@ -160,7 +195,7 @@ void USceneComponent::SetWorldTransform(const FTransform& W)
     RelativeRotation = RelativeTransform.Rotation;
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     RelativeScale = RelativeTransform.Scale3D;
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
  
 void USceneComponent::SetWorldLocation(const FVector& L)
@@ -262,7 +297,7 @@ void USceneComponent::AddLocalOffset(const FVector& Delta)
     const FVector parentDelta = RelativeRotation.RotateVector(Delta);
     RelativeLocation = RelativeLocation + parentDelta;
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::AddLocalRotation(const FQuat& DeltaRot)
@@ -270,7 +305,7 @@ void USceneComponent::AddLocalRotation(const FQuat& DeltaRot)
     RelativeRotation = (RelativeRotation * DeltaRot).GetNormalized(); // 로컬: 우측곱
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat& R)
@@ -279,22 +314,18 @@ void USceneComponent::SetLocalLocationAndRotation(const FVector& L, const FQuat&
     RelativeRotation = R.GetNormalized();
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); // Euler 동기화
     UpdateRelativeTransform();
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 
 FMatrix USceneComponent::GetWorldMatrix() const
 {
-    // 소켓에 부착된 경우 본 애니메이션으로 소켓이 계속 움직이므로 캐시 사용 불가
-    bool bAttachedToSocket = AttachParent && !AttachSocketName.ToString().empty();
-
-    if (bIsTransformDirty || bAttachedToSocket)
+    // 소켓에 붙은 경우도 부모 포즈 리비전으로 무효화되므로 항상 캐시를 쓴다
+    const FTransform World = GetWorldTransform();
+    if (bIsWorldMatrixDirty)
     {
-        CachedWorldMatrix = GetWorldTransform().ToMatrix();
-        if (!bAttachedToSocket)
-        {
-            bIsTransformDirty = false;
-        }
+        CachedWorldMatrix = World.ToMatrix();
+        bIsWorldMatrixDirty = false;
     }
     return CachedWorldMatrix;
 }
@@ -338,6 +369,7 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, EAttachmentRule
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
     AttachSocketName = FName(); // 소켓 없이 부착
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::SetupAttachment(USceneComponent* InParent, const FName& InSocketName, EAttachmentRule Rule)
@@ -362,17 +394,8 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, const FName& In
         if (Rule == EAttachmentRule::KeepWorld)
         {
             // 소켓이 있으면 소켓 트랜스폼 기준으로 RelativeTransform 계산
-            USkeletalMeshComponent* SkelMeshParent = Cast<USkeletalMeshComponent>(AttachParent);
-            if (SkelMeshParent && !InSocketName.ToString().empty() && SkelMeshParent->DoesSocketExist(InSocketName))
-            {
-                FTransform SocketWorld = SkelMeshParent->GetSocketTransform(InSocketName);
-                RelativeTransform = SocketWorld.GetRelativeTransform(OldWorld);
-            }
-            else
-            {
-                const FTransform ParentWorld = AttachParent->GetWorldTransform();
-                RelativeTransform = ParentWorld.GetRelativeTransform(OldWorld);
-            }
+            const FTransform ParentWorld = GetAttachParentWorldTransform();
+            RelativeTransform = ParentWorld.GetRelativeTransform(OldWorld);
         }
         // KeepRelative: 기존 RelativeTransform 유지
     }
@@ -385,6 +408,7 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, const FName& In
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::DetachFromParent(bool bKeepWorld)
@@ -406,7 +430,7 @@ void USceneComponent::DetachFromParent(bool bKeepWorld)
     RelativeScale = RelativeTransform.Scale3D;
 
     // Notify transform update so shapes can refresh overlaps
-    OnTransformUpdated();
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::DuplicateSubObjects()
@@ -416,6 +440,7 @@ void USceneComponent::DuplicateSubObjects()
     AttachParent = nullptr; // 부모 컴포넌트가 이 객체의 SetupAttachment를 호출할 경우, 불필요한 로직(기존 부모에서 제거) 수행 방지
     SpriteComponent = nullptr;
     AttachChildren.clear(); // Actor에서 할당해줌
+    MarkWorldTransformDirty(); // 원본의 월드 캐시를 물려받지 않는다
 }
 
 // ──────────────────────────────
@@ -448,7 +473,7 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
         // 해당 객체의 Transform을 위에서 읽은 값을 기반으로 변경 후, 자식에게 전파
         UpdateRelativeTransform();
-        OnTransformUpdated();
+        PropagateTransformUpdate();
 	}
 	else
 	{
@@ -482,18 +507,43 @@ void USceneComponent::OnRegister(UWorld* InWorld)
     }
 
     // Notify transform update so shapes can refresh overlaps
+    PropagateTransformUpdate();
+}
+
+void USceneComponent::PropagateTransformUpdate()
+{
+    bIsTransformDirty = true;
     OnTransformUpdated();
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->PropagateTransformUpdate();
+        }
+    }
 }
 
 void USceneComponent::OnTransformUpdated()
+{
+}
+
+void USceneComponent::MarkWorldTransformDirty() const
 {
     bIsTransformDirty = true;
-    for (USceneComponent* Child : GetAttachChildren())
+    for (USceneComponent* Child : AttachChildren)
     {
-        Child->OnTransformUpdated();
+        if (Child)
+        {
+            Child->MarkWorldTransformDirty();
+        }
     }
 }
 
+uint32 USceneComponent::ConsumeWorldTransformRecomposeCount()
+{
+    return WorldTransformRecomposeCount.exchange(0, std::memory_order_relaxed);
+}
+
 UWorld* USceneComponent::GetWorld()
 {
     return Owner ? Owner->GetWorld() : nullptr;
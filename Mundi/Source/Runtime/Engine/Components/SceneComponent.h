@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include <atomic>
 #include "Vector.h"
 #include "ActorComponent.h"
 #include "USceneComponent.generated.h"
@@ -48,6 +49,7 @@ public:
     // ──────────────────────────────
     // World Transform API
     // ──────────────────────────────
+    // 캐시된 월드 트랜스폼 (자신/조상이 바뀌었거나 소켓 부모의 포즈가 바뀐 경우에만 다시 합성)
     FTransform GetWorldTransform() const;
     void SetWorldTransform(const FTransform& W);
 
@@ -93,14 +95,25 @@ public:
     void SetParent(USceneComponent* InParent)
     {
         AttachParent = InParent;
+        MarkWorldTransformDirty();
     }
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
     void OnRegister(UWorld* InWorld) override;
 
+    /**
+     * @brief 자신과 모든 자식의 월드 트랜스폼 캐시를 무효화하고 각 컴포넌트의 OnTransformUpdated를 호출.
+     * @note 트랜스폼을 바꾼 쪽은 OnTransformUpdated 대신 이 함수를 호출해야 한다 (오버라이드가 Super를 빼먹어도 캐시는 무효화됨)
+     */
+    void PropagateTransformUpdate();
+
+    /** 월드 트랜스폼 변경 알림 훅 (자식 전파와 캐시 무효화는 PropagateTransformUpdate가 담당) */
     virtual void OnTransformUpdated();
 
+    /** 지난 호출 이후 월드 트랜스폼을 다시 합성한 횟수를 돌려주고 0으로 되돌린다 (프레임 통계용) */
+    static uint32 ConsumeWorldTransformRecomposeCount();
+
     // SceneId
     uint32 GetSceneId() const { return SceneId; }
     void SetSceneId(uint32 InId) { SceneId = InId; }
@@ -123,15 +136,8 @@ public:
         return SceneIdMap;
     }
 protected:
-    /** @brief OnTransformUpdated() 내부에서 클래스 별 특수 로직을 처리하기 위한 가상함수 */
-    //virtual void OnTransformUpdatedChildImpl();
-    
-    /**
-     * @brief Transform 갱신시 자식 컴포넌트의 OnTransformUpdated를 강제 호출.
-     * @note 부모 컴포넌트의 트랜스폼 변화로 인해 월드 관점에서 생길 영향을 처리하기 위한 메소드로,
-     * 자식 컴포넌트들의 로컬 트랜스폼을 직접 변경시키지 않습니다. 
-     */
-   // void PropagateTransformUpdate();
+    /** 알림 훅 없이 자신과 모든 자식의 월드 트랜스폼 캐시만 무효화 (부착 변경, 소켓 포즈 변경 감지 시) */
+    void MarkWorldTransformDirty() const;
 
     //Component 위치 나타내기 위함
     UBillboardComponent* SpriteComponent = nullptr;
@@ -154,8 +160,13 @@ protected:
     UPROPERTY(EditAnywhere, Category="Transform")
     FVector RelativeRotationEuler{ 0,0,0 };
 
+    // 월드 트랜스폼/행렬 캐시 (bIsTransformDirty면 다음 Get에서 부모 캐시 위에 다시 합성)
+    mutable FTransform CachedWorldTransform;
     mutable FMatrix CachedWorldMatrix = FMatrix::Identity();
     mutable bool bIsTransformDirty = true;
+    mutable bool bIsWorldMatrixDirty = true;
+    // 소켓 부착 시 캐시를 만든 시점의 부모 스켈레탈 메시 포즈 리비전
+    mutable uint32 CachedSocketPoseRevision = 0;
     
     // Hierarchy
     USceneComponent* AttachParent = nullptr;
@@ -170,4 +181,14 @@ protected:
     uint32 SceneId; // Scene파일에서 불러온 Id. 컴포넌트끼리 자식부모관계 연결하기 위해 저장. Scene에 저장할 때는 UUID를 저장
     uint32 ParentId;
     static TMap<uint32, USceneComponent*> SceneIdMap; // 부모를 찾기 위한 Map
+
+private:
+    /** 부착 기준의 월드 트랜스폼 (소켓이 있으면 소켓, 없으면 부모 컴포넌트) */
+    FTransform GetAttachParentWorldTransform() const;
+
+    /** 소켓에 붙어 있고 부모 포즈가 캐시 이후 바뀌었는지 */
+    bool IsSocketPoseStale() const;
+
+    // 월드 트랜스폼 재합성 횟수 (워커 스레드에서도 조회될 수 있어 atomic)
+    static std::atomic<uint32> WorldTransformRecomposeCount;
 };
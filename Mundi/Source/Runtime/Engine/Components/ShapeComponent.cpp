@@ -6,6 +6,7 @@
 #include "BVHierarchy.h"
 #include "GameObject.h"
 #include "Collision.h"
+#include "ShapeOverlapScene.h"
 #include "../Physics/BodyInstance.h"
 #include "../Physics/PhysicsTypes.h"
 #include <PxPhysicsAPI.h>
@@ -31,7 +32,7 @@ void UShapeComponent::OnRegister(UWorld* InWorld)
 
     // 부착 정보 로그
     FString ParentName = AttachParent ? AttachParent->ObjectName.ToString() : "None";
-    FString SocketName = AttachSocketName.ToString().empty() ? "None" : AttachSocketName.ToString();
+    FString SocketName = AttachSocketName.IsNone() ? "None" : AttachSocketName.ToString();
     FTransform WorldTM = GetWorldTransform();
     UE_LOG("[ShapeComponent] %s OnRegister - Parent: %s, Socket: %s, WorldPos: (%.2f, %.2f, %.2f)",
         ObjectName.ToString().c_str(), ParentName.c_str(), SocketName.c_str(),
@@ -104,70 +105,19 @@ void UShapeComponent::TickComponent(float DeltaSeconds)
     // }
 
     UWorld* World = GetWorld();
-    if (!World)
+    if (!World || !World->GetShapeOverlapScene())
     {
         return;
     }
-    
-    for (AActor* Actor : World->GetActors())
-    {
-        if (!Actor || !Actor->IsActorActive())
-        {
-            continue;
-        }
 
-        for (USceneComponent* Comp : Actor->GetSceneComponents())
-        {
-            UShapeComponent* Other = Cast<UShapeComponent>(Comp);
-
-            if (!Other || Other == this)
-            {
-                continue;
-            }
-
-            if (Other->GetOwner() == this->GetOwner())
-            {
-                continue;
-            }
-
-            if (!Other->bGenerateOverlapEvents && !Other->bBlockComponent)
-            {
-                continue;
-            }
-            
-            if (this->bBlockComponent/* && Other->bBlockComponent*/)
-            {
-                FHitResult HitResult;
-                if (Collision::ComputePenetration(this, Other, HitResult))
-                {
-                    // ImpactPoint, ImpactNormal, bHit, PenetrationDepth는 ComputePenetration에서 채워줌
-                    HitResult.HitComponent = Other;
-                    HitResult.HitActor = Other->GetOwner();                    
-                    
-                    // 부모의 Hit 큐에 등록
-                    PendingHits.Add(HitResult);
-                
-                    // *물리 반작용(Resolve)*: 
-                    // 만약 네가 여기서 바로 밀어내기(Position correction)를 하고 싶다면:
-                    AddWorldOffset(-HitResult.ImpactNormal * HitResult.PenetrationDepth);
-                }
-            }
-            
-            if (this->bGenerateOverlapEvents /*&& Other->bGenerateOverlapEvents*/)
-            {
-                FHitResult HitResult;
-                if (/*Collision::CheckOverlap(this, Other)*/Collision::ComputePenetration(this, Other, HitResult))
-                {
-                    HitResult.HitComponent = Other;
-                    HitResult.HitActor = Other->GetOwner();
-                    // HitResult.bBlockingHit = false;
-                    // HitResult.ImpactPoint = this->GetWorldLocation();
-                    // HitResult.ImpactNormal = FVector::Zero();
-                    PendingOverlaps.Add(HitResult);
-                    AddWorldOffset(-HitResult.ImpactNormal * HitResult.PenetrationDepth);
-                }
-            }
-        }
+    // 월드 셰이프 씬이 프레임당 한 번 브로드/내로우 페이즈를 돌려 둔 결과에서 내 접촉만 꺼낸다
+    FVector PushOut;
+    World->GetShapeOverlapScene()->GatherContacts(this, PendingHits, PendingOverlaps, PushOut);
+
+    // *물리 반작용(Resolve)*: 겹친 만큼 밀어내기 (상대도 반응하면 절반씩)
+    if (!PushOut.IsZero())
+    {
+        AddWorldOffset(PushOut);
     }
 
     // 충돌 감지 후 부모 Tick 호출해야지 감지된 충돌 이벤트가 현재 프레임에 발생된다
@@ -1,13 +1,17 @@
 ﻿
 #include "pch.h"
 #include "SkeletalMeshComponent.h"
+#include <atomic>
 #include "Source/Runtime/Engine/Animation/AnimDateModel.h"
 #include "Source/Runtime/Engine/Animation/AnimSequence.h"
 #include "Source/Runtime/Engine/Animation/AnimInstance.h"
 #include "Source/Runtime/Engine/Animation/AnimationStateMachine.h"
 #include "Source/Runtime/Engine/Animation/AnimSingleNodeInstance.h"
 #include "Source/Runtime/Engine/Animation/AnimTypes.h"
+#include "Source/Runtime/Engine/Animation/AnimPoseKernels.h"
+#include "Source/Runtime/Engine/Animation/AnimationUpdateQueue.h"
 #include "Source/Runtime/Engine/Animation/AnimationAsset.h"
+#include "Source/Runtime/Engine/Animation/AnimationRuntime.h"
 #include "Source/Runtime/Engine/Animation/AnimNotify_PlaySound.h"
 #include "Source/Runtime/Engine/Animation/Team2AnimInstance.h"
 #include "Source/Runtime/Core/Misc/PathUtils.h"
@@ -18,6 +22,7 @@
 #include "Source/Runtime/AssetManagement/ResourceManager.h"
 
 #include "PlatformTime.h"
+#include "SkinningStats.h"
 #include "USlateManager.h"
 #include "BlueprintGraph/AnimBlueprintCompiler.h"
 
@@ -179,6 +184,12 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
 
     if (!SkeletalMesh) { return; }
 
+    // 지난 프레임 컬링 결과로 이번 프레임 평가 여부 결정 (물리 구동 중에는 항상 Full)
+    AnimUpdateRate.Tick(DeltaTime,
+        bEnableUpdateRateOptimizations && PhysicsState == EPhysicsAnimationState::AnimationDriven, UUID);
+    // 뷰포트 수와 무관하게 컴포넌트당 프레임당 한 번 집계
+    FSkinningStatManager::GetInstance().AddAnimUpdateRate(AnimUpdateRate);
+
     // Team2AnimInstance 테스트를 위한 키 입력 처리
     if (AnimInstance)
     {
@@ -248,21 +259,31 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
         // 1. 상태머신 업데이트 (있다면)
         // 2. 시간 갱신 및 루핑 처리
         // 3. 포즈 평가 및 SetAnimationPose() 호출
-        // 4. 노티파이 트리거
+        // 4. 노티파이 수집 (실행은 PostAnimationUpdate에서)
         // 5. 커브 업데이트
 
         // Sync physics bodies to match animation
         UWorld* World = GetWorld();
         FPhysScene* PhysScene = World ? World->GetPhysScene() : nullptr;
+        FAnimationUpdateQueue* AnimationQueue = World ? World->GetAnimationUpdateQueue() : nullptr;
         switch (PhysicsState)
         {
             case EPhysicsAnimationState::AnimationDriven:
-                AnimInstance->NativeUpdateAnimation(DeltaTime);
-                if (PhysScene)
+                if (AnimationQueue)
                 {
-                    SyncBodiesFromAnimation(*PhysScene);
+                    // 액터 Tick이 끝난 뒤 월드가 모든 컴포넌트를 한꺼번에 병렬 평가한다
+                    // (노티파이, 바디 동기화, 소켓 갱신도 그때 게임 스레드에서 처리)
+                    AnimationQueue->Enqueue(this, DeltaTime);
                 }
-                break;
+                else
+                {
+                    PreUpdateAnimation(DeltaTime);
+                    ParallelUpdateAnimation(DeltaTime);
+                    PostAnimationUpdate(PhysScene);
+                }
+                // 소켓 갱신은 PostAnimationUpdate가 담당
+                PrevAnimationTime = CurrentAnimationTime;
+                return;
 
             case EPhysicsAnimationState::PhysicsDriven:
                 SyncAnimationFromBodies();
@@ -290,14 +311,14 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
         else if (PhysicsState == EPhysicsAnimationState::AnimationDriven && PhysScene)
         {
             // 레거시 경로: AnimInstance 없이 직접 애니메이션 업데이트
-            TickAnimation(DeltaTime);
+            EvaluateAnimation(DeltaTime);
             SyncBodiesFromAnimation(*PhysScene);
         }
         else
         {
             // 레거시 경로: AnimInstance 없이 직접 애니메이션 업데이트
             // (호환성 유지를 위해 남겨둠, 추후 제거 예정)
-            TickAnimation(DeltaTime);
+            EvaluateAnimation(DeltaTime);
         }
     }
 
@@ -307,8 +328,115 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime)
     PrevAnimationTime = CurrentAnimationTime;
 }
 
+bool USkeletalMeshComponent::PreUpdateAnimation(float DeltaTime)
+{
+    if (!AnimInstance || !AnimUpdateRate.ShouldEvaluate())
+    {
+        return true;
+    }
+
+    // EvaluateAnimation의 포즈 단계와 같은 누적 시간으로 상태머신을 진행
+    AnimInstance->NativeUpdateStateMachine(AnimUpdateRate.GetEvaluationDeltaTime());
+    return AnimInstance->CanEvaluateInParallel();
+}
+
+void USkeletalMeshComponent::ParallelUpdateAnimation(float DeltaTime)
+{
+    EvaluateAnimation(DeltaTime);
+}
+
+void USkeletalMeshComponent::EvaluateAnimation(float DeltaTime)
+{
+    const bool bInterpolate = AnimUpdateRate.ShouldInterpolate();
+
+    if (AnimUpdateRate.ShouldEvaluate())
+    {
+        // 1. 평가 (건너뛴 프레임 시간까지 누적해서 한 번에 진행)
+        if (bInterpolate)
+        {
+            InterpolationFromPose = CurrentLocalSpacePose;
+            bDeferPoseRecompute = true;
+        }
+
+        const float EvaluationDeltaTime = AnimUpdateRate.GetEvaluationDeltaTime();
+        if (AnimInstance)
+        {
+            AnimInstance->SetBoneLODStripDepth(AnimUpdateRate.GetBoneLODStripDepth());
+            // 상태머신은 PreUpdateAnimation에서 게임 스레드로 이미 진행했다
+            AnimInstance->NativeEvaluateAnimation(EvaluationDeltaTime);
+        }
+        else
+        {
+            TickAnimation(EvaluationDeltaTime);
+        }
+        bDeferPoseRecompute = false;
+
+        // 2. 보간 대상 보관 (표시는 From에서 시작해 간격의 마지막 프레임에 Target에 도달)
+        bHasInterpolationTarget = bInterpolate;
+        if (bInterpolate)
+        {
+            InterpolationTargetPose = CurrentLocalSpacePose;
+        }
+        else
+        {
+            return;
+        }
+    }
+
+    // 3. 보간 (평가 프레임 포함, 보이지 않거나 간격이 1이면 마지막 포즈 유지)
+    if (!bInterpolate || !bHasInterpolationTarget)
+    {
+        return;
+    }
+
+    const int32 NumBones = CurrentLocalSpacePose.Num();
+    if (InterpolationFromPose.Num() != NumBones || InterpolationTargetPose.Num() != NumBones)
+    {
+        return;
+    }
+
+    AnimPoseKernels::BlendTransforms(InterpolationFromPose.data(), InterpolationTargetPose.data(),
+        AnimUpdateRate.GetInterpolationAlpha(), CurrentLocalSpacePose.data(), NumBones);
+    ForceRecomputePose();
+}
+
+void USkeletalMeshComponent::PostAnimationUpdate(FPhysScene* PhysScene)
+{
+    DispatchAnimNotifies();
+
+    if (PhysScene && PhysicsState == EPhysicsAnimationState::AnimationDriven)
+    {
+        SyncBodiesFromAnimation(*PhysScene);
+    }
+
+    // 소켓에 붙은 자식 컴포넌트들의 PhysX body 위치 업데이트
+    UpdateSocketAttachedComponents();
+}
+
+void USkeletalMeshComponent::OnUnregister()
+{
+    // 큐에 남아 있으면 Flush가 해제된 컴포넌트를 건드리게 된다
+    if (UWorld* World = GetWorld())
+    {
+        if (FAnimationUpdateQueue* AnimationQueue = World->GetAnimationUpdateQueue())
+        {
+            AnimationQueue->Remove(this);
+        }
+    }
+
+    Super::OnUnregister();
+}
+
 void USkeletalMeshComponent::EndPlay()
 {
+    if (UWorld* World = GetWorld())
+    {
+        if (FAnimationUpdateQueue* AnimationQueue = World->GetAnimationUpdateQueue())
+        {
+            AnimationQueue->Remove(this);
+        }
+    }
+
     if (UWorld* World = GetWorld())
     {
         if (FPhysScene* PhysScene = World->GetPhysScene())
@@ -357,6 +485,13 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
         CurrentComponentSpacePose.SetNum(NumBones);
         TempFinalSkinningMatrices.SetNum(NumBones);
         TempFinalSkinningNormalMatrices.SetNum(NumBones);
+        AnimPoseKernels::BuildInverseBindNormalMatrices(Skeleton, InverseBindNormalMatrices);
+        FAnimationRuntime::ComputeBoneLeafDepths(Skeleton, BoneLeafDepths);
+
+        // 이전 메시 기준의 보간 포즈는 버린다
+        InterpolationFromPose.Empty();
+        InterpolationTargetPose.Empty();
+        bHasInterpolationTarget = false;
 
         for (int32 i = 0; i < NumBones; ++i)
         {
@@ -386,6 +521,12 @@ void USkeletalMeshComponent::SetSkeletalMesh(const FString& PathFileName)
         CurrentComponentSpacePose.Empty();
         TempFinalSkinningMatrices.Empty();
         TempFinalSkinningNormalMatrices.Empty();
+        InverseBindNormalMatrices.Empty();
+        BoneLeafDepths.Empty();
+        InterpolationFromPose.Empty();
+        InterpolationTargetPose.Empty();
+        bHasInterpolationTarget = false;
+        ++PoseRevision;
     }
 }
 
@@ -638,49 +779,24 @@ void USkeletalMeshComponent::ForceRecomputePose()
 {
     if (!SkeletalMesh) { return; } 
 
-    // LocalSpace -> ComponentSpace 계산
-    UpdateComponentSpaceTransforms();
-    // ComponentSpace -> Final Skinning Matrices 계산
-    UpdateFinalSkinningMatrices();
+    // LocalSpace -> ComponentSpace -> Final Skinning Matrices를 본 순서대로 한 번에 계산
+    UpdateComponentSpaceAndSkinningMatrices();
+    ++PoseRevision;
+    // 정점 스키닝은 그려질 때 CollectMeshBatches에서 (더티 플래그 기준)
     UpdateSkinningMatrices(TempFinalSkinningMatrices, TempFinalSkinningNormalMatrices);
-    PerformSkinning();    
 }
 
-void USkeletalMeshComponent::UpdateComponentSpaceTransforms()
+void USkeletalMeshComponent::UpdateComponentSpaceAndSkinningMatrices()
 {
     const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
-    const int32 NumBones = Skeleton.Bones.Num();
-
-    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    if (InverseBindNormalMatrices.Num() != Skeleton.Bones.Num())
     {
-        const FTransform& LocalTransform = CurrentLocalSpacePose[BoneIndex];
-        const int32 ParentIndex = Skeleton.Bones[BoneIndex].ParentIndex;
-
-        if (ParentIndex == -1) // 루트 본
-        {
-            CurrentComponentSpacePose[BoneIndex] = LocalTransform;
-        }
-        else // 자식 본
-        {
-            const FTransform& ParentComponentTransform = CurrentComponentSpacePose[ParentIndex];
-            CurrentComponentSpacePose[BoneIndex] = ParentComponentTransform.GetWorldTransform(LocalTransform);
-        }
+        AnimPoseKernels::BuildInverseBindNormalMatrices(Skeleton, InverseBindNormalMatrices);
     }
-}
-
-void USkeletalMeshComponent::UpdateFinalSkinningMatrices()
-{
-    const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
-    const int32 NumBones = Skeleton.Bones.Num();
 
-    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
-    {
-        const FMatrix& InvBindPose = Skeleton.Bones[BoneIndex].InverseBindPose;
-        const FMatrix ComponentPoseMatrix = CurrentComponentSpacePose[BoneIndex].ToMatrix();
-
-        TempFinalSkinningMatrices[BoneIndex] = InvBindPose * ComponentPoseMatrix;
-        TempFinalSkinningNormalMatrices[BoneIndex] = TempFinalSkinningMatrices[BoneIndex].Inverse().Transpose();
-    }
+    AnimPoseKernels::ComputeComponentSpaceAndSkinning(Skeleton, InverseBindNormalMatrices.data(),
+        CurrentLocalSpacePose.data(), CurrentComponentSpacePose.data(),
+        TempFinalSkinningMatrices.data(), TempFinalSkinningNormalMatrices.data());
 }
 
 void USkeletalMeshComponent::InstantiatePhysicsAssetBodies(FPhysScene& PhysScene)
@@ -1100,7 +1216,14 @@ void USkeletalMeshComponent::GetAllSocketNames(TArray<FName>& OutSocketNames) co
 
 void USkeletalMeshComponent::UpdateSocketAttachedComponents()
 {
-    // 소켓에 붙은 자식 컴포넌트들의 OnTransformUpdated 호출
+    // 포즈가 그대로면 (업데이트 빈도 최적화로 건너뛴 프레임 등) 소켓 자식의 캐시도 그대로 유효
+    if (LastNotifiedPoseRevision == PoseRevision)
+    {
+        return;
+    }
+    LastNotifiedPoseRevision = PoseRevision;
+
+    // 소켓에 붙은 자식 컴포넌트들의 캐시 무효화 + OnTransformUpdated 호출
     for (USceneComponent* Child : GetAttachChildren())
     {
         if (!Child)
@@ -1109,9 +1232,9 @@ void USkeletalMeshComponent::UpdateSocketAttachedComponents()
         }
 
         // 소켓에 붙어있는 자식만 업데이트
-        if (!Child->GetAttachSocketName().ToString().empty())
+        if (!Child->GetAttachSocketName().IsNone())
         {
-            Child->OnTransformUpdated();
+            Child->PropagateTransformUpdate();
         }
     }
 }
@@ -1203,24 +1326,10 @@ void USkeletalMeshComponent::SetAnimationTime(float InTime)
         if (DataModel && SkeletalMesh)
         {
             const FSkeleton& Skeleton = SkeletalMesh->GetSkeletalMeshData()->Skeleton;
-            int32 NumBones = DataModel->GetNumBoneTracks();
 
+            // 캐시된 트랙→본 리맵으로 CurrentLocalSpacePose에 바로 추출 (트랙이 없는 본은 그대로)
             FAnimExtractContext ExtractContext(CurrentAnimationTime, bIsLooping);
-            FPoseContext PoseContext(NumBones);
-            CurrentAnimation->GetAnimationPose(PoseContext, ExtractContext);
-
-            // 추출된 포즈를 CurrentLocalSpacePose에 적용
-            const TArray<FBoneAnimationTrack>& BoneTracks = DataModel->GetBoneAnimationTracks();
-            for (int32 TrackIdx = 0; TrackIdx < BoneTracks.Num(); ++TrackIdx)
-            {
-                const FBoneAnimationTrack& Track = BoneTracks[TrackIdx];
-                int32 BoneIndex = Skeleton.FindBoneIndex(Track.Name);
-
-                if (BoneIndex != INDEX_NONE && BoneIndex < CurrentLocalSpacePose.Num())
-                {
-                    CurrentLocalSpacePose[BoneIndex] = PoseContext.Pose[TrackIdx];
-                }
-            }
+            CurrentAnimation->GetSkeletonPose(Skeleton, ExtractContext, CurrentLocalSpacePose);
 
             // 포즈 변경 사항을 스키닝에 반영
             ForceRecomputePose();
@@ -1264,57 +1373,69 @@ void USkeletalMeshComponent::GatherNotifiesFromRange(float PrevTime, float CurTi
     CurrentAnimation->GetAnimNotify(PrevTime, DeltaMove, PendingNotifies);
 }
 
+void USkeletalMeshComponent::QueueAnimNotifies(const TArray<FPendingAnimNotify>& Notifies, UAnimSequenceBase* Animation)
+{
+    for (const FPendingAnimNotify& Pending : Notifies)
+    {
+        FPendingAnimNotify& Queued = PendingNotifies[PendingNotifies.Emplace(Pending)];
+        Queued.SourceAnimation = Animation;
+    }
+}
+
 void USkeletalMeshComponent::DispatchAnimNotifies()
 {
-    for (const FPendingAnimNotify& Pending : PendingNotifies)
+    // 핸들러가 다시 노티파이를 쌓아도 안전하도록 인덱스로 순회
+    for (int32 NotifyIndex = 0; NotifyIndex < PendingNotifies.Num(); ++NotifyIndex)
     {
+        const FPendingAnimNotify Pending = PendingNotifies[NotifyIndex];
         const FAnimNotifyEvent& Event = *Pending.Event;
+        UAnimSequenceBase* Animation = Pending.SourceAnimation ? Pending.SourceAnimation : CurrentAnimation;
 
         switch (Pending.Type)
         {
         case EPendingNotifyType::Trigger:
             if (Event.Notify)
             {
-                Event.Notify->Notify(this, CurrentAnimation); 
+                Event.Notify->Notify(this, Animation); 
             }
             break;
             
         case EPendingNotifyType::StateBegin:
             if (Event.NotifyState)
             {
-                Event.NotifyState->NotifyBegin(this, CurrentAnimation, Event.Duration);
+                Event.NotifyState->NotifyBegin(this, Animation, Event.Duration);
             }
             break;
 
         case EPendingNotifyType::StateTick:
             if(Event.NotifyState)
             {
-                Event.NotifyState->NotifyTick(this, CurrentAnimation, Event.Duration);
+                Event.NotifyState->NotifyTick(this, Animation, Event.Duration);
             }
             break;
         case EPendingNotifyType::StateEnd:
             if (Event.NotifyState)
             {
-                Event.NotifyState->NotifyEnd(this, CurrentAnimation, Event.Duration);
+                Event.NotifyState->NotifyEnd(this, Animation, Event.Duration);
             }
             break;
 
         default:
             break;
         }
-         
     }
+    PendingNotifies.Empty();
 }
 
 void USkeletalMeshComponent::TickAnimation(float DeltaTime)
 {
     if (!ShouldTickAnimation())
     {
-        static bool bLoggedOnce = false;
-        if (!bLoggedOnce)
+        // 애니메이션 업데이트 단계에서 여러 스레드가 동시에 올 수 있으므로 로그 1회 플래그는 원자적으로
+        static std::atomic<bool> bLoggedOnce{ false };
+        if (!bLoggedOnce.exchange(true, std::memory_order_relaxed))
         {
             UE_LOG("TickAnimation skipped - CurrentAnimation: %p, bIsPlaying: %d", CurrentAnimation, bIsPlaying);
-            bLoggedOnce = true;
         }
         return;
     }
@@ -1344,8 +1465,8 @@ void USkeletalMeshComponent::TickAnimInstances(float DeltaTime)
 
     float PlayLength = CurrentAnimation->GetPlayLength();
 
-    static int FrameCount = 0;
-    if (FrameCount++ % 60 == 0) // 매 60프레임마다 로그
+    static std::atomic<int32> FrameCount{ 0 };
+    if (FrameCount.fetch_add(1, std::memory_order_relaxed) % 60 == 0) // 매 60프레임마다 로그
     {
         UE_LOG("Animation Playing - Time: %.2f / %.2f, Looping: %d", CurrentAnimationTime, PlayLength, bIsLooping);
     }
@@ -1391,8 +1512,15 @@ void USkeletalMeshComponent::TickAnimInstances(float DeltaTime)
     // 5. 추출된 포즈를 CurrentLocalSpacePose에 적용
     const TArray<FBoneAnimationTrack>& BoneTracks = DataModel->GetBoneAnimationTracks();
 
-    static bool bLoggedBoneMatching = false;
-    static bool bLoggedAnimData = false;
+    const FAnimTrackRemap& Remap = DataModel->GetTrackRemap(Skeleton);
+    const TArray<int32>& TrackToBone = Remap.TrackToBone;
+    const int32 StripDepth = AnimUpdateRate.GetBoneLODStripDepth();
+
+    // 워커 스레드에서도 호출되므로 1회 로그 플래그는 원자적으로 (본 매칭 로그는 먼저 가져간 스레드만 출력)
+    static std::atomic<bool> bLoggedBoneMatching{ false };
+    static std::atomic<bool> bLoggedAnimData{ false };
+    const bool bLogBoneMatching = !bLoggedBoneMatching.exchange(true, std::memory_order_relaxed);
+    const bool bLogAnimData = !bLoggedAnimData.load(std::memory_order_relaxed);
     int32 MatchedBones = 0;
     int32 TotalBones = BoneTracks.Num();
 
@@ -1400,8 +1528,14 @@ void USkeletalMeshComponent::TickAnimInstances(float DeltaTime)
     {
         const FBoneAnimationTrack& Track = BoneTracks[TrackIdx];
 
-        // 스켈레톤에서 본 인덱스 찾기
-        int32 BoneIndex = Skeleton.FindBoneIndex(Track.Name);
+        // 스켈레톤 본 인덱스 (리맵 테이블)
+        int32 BoneIndex = TrackToBone[TrackIdx];
+
+        // 본 LOD: 말단 본은 마지막 포즈로 멈춰 둔다
+        if (StripDepth > 0 && BoneIndex != INDEX_NONE && Remap.TrackLeafDepth[TrackIdx] < StripDepth)
+        {
+            continue;
+        }
 
         if (BoneIndex != INDEX_NONE && BoneIndex < CurrentLocalSpacePose.Num())
         {
@@ -1410,7 +1544,7 @@ void USkeletalMeshComponent::TickAnimInstances(float DeltaTime)
             MatchedBones++;
 
             // 첫 5개 본의 애니메이션 데이터 로그
-            if (!bLoggedAnimData && BoneIndex < 5)
+            if (bLogAnimData && BoneIndex < 5)
             {
                 const FTransform& AnimTransform = PoseContext.Pose[TrackIdx];
                 UE_LOG("[AnimData] Bone[%d] %s: T(%.3f,%.3f,%.3f) R(%.3f,%.3f,%.3f,%.3f) S(%.3f,%.3f,%.3f)",
@@ -1420,18 +1554,18 @@ void USkeletalMeshComponent::TickAnimInstances(float DeltaTime)
                     AnimTransform.Scale3D.X, AnimTransform.Scale3D.Y, AnimTransform.Scale3D.Z);
             }
         }
-        else if (!bLoggedBoneMatching)
+        else if (bLogBoneMatching)
         {
             UE_LOG("Bone not found in skeleton: %s (TrackIdx: %d)", Track.Name.ToString().c_str(), TrackIdx);
         }
     }
 
-    if (!bLoggedAnimData && MatchedBones > 0)
+    if (bLogAnimData && MatchedBones > 0)
     {
-        bLoggedAnimData = true;
+        bLoggedAnimData.store(true, std::memory_order_relaxed);
     }
 
-    if (!bLoggedBoneMatching)
+    if (bLogBoneMatching)
     {
         UE_LOG("Bone matching: %d / %d bones matched", MatchedBones, TotalBones);
         UE_LOG("Skeleton has %d bones, Animation has %d tracks", Skeleton.Bones.Num(), TotalBones);
@@ -1448,12 +1582,13 @@ void USkeletalMeshComponent::TickAnimInstances(float DeltaTime)
         {
             UE_LOG("  [%d] %s", i, BoneTracks[i].Name.ToString().c_str());
         }
-
-        bLoggedBoneMatching = true;
     }
 
-    // 6. 포즈 변경 사항을 스키닝에 반영
-    ForceRecomputePose();
+    // 6. 포즈 변경 사항을 스키닝에 반영 (보간할 프레임이면 보간 후에 한 번만)
+    if (!bDeferPoseRecompute)
+    {
+        ForceRecomputePose();
+    }
 }
 
 // ============================================================
@@ -1477,18 +1612,29 @@ void USkeletalMeshComponent::SetAnimationPose(const TArray<FTransform>& InPose)
         return;
     }
 
+    if (BoneLeafDepths.Num() != NumBones)
+    {
+        FAnimationRuntime::ComputeBoneLeafDepths(Skeleton, BoneLeafDepths);
+    }
+
     // AnimInstance가 계산한 포즈를 CurrentLocalSpacePose에 복사
     // 주의: AnimInstance의 포즈는 본 트랙 순서이므로 스켈레톤 본 순서와 매칭해야 함
+    // 본 LOD로 추출을 건너뛴 말단 본은 마지막 포즈로 멈춰 둔다
+    const int32 StripDepth = AnimUpdateRate.GetBoneLODStripDepth();
     for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
     {
-        if (BoneIndex < InPose.Num())
+        if (StripDepth > 0 && BoneLeafDepths[BoneIndex] < StripDepth)
         {
-            CurrentLocalSpacePose[BoneIndex] = InPose[BoneIndex];
+            continue;
         }
+        CurrentLocalSpacePose[BoneIndex] = InPose[BoneIndex];
     }
 
-    // 포즈 변경 사항을 스키닝에 반영
-    ForceRecomputePose();
+    // 포즈 변경 사항을 스키닝에 반영 (보간할 프레임이면 보간 후에 한 번만)
+    if (!bDeferPoseRecompute)
+    {
+        ForceRecomputePose();
+    }
 }
 
 void USkeletalMeshComponent::SetAnimInstance(UAnimInstance* InAnimInstance)
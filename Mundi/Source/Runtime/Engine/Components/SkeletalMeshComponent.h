@@ -3,6 +3,7 @@
 
 // Include for FPendingAnimNotify and FAnimNotifyEvent types
 #include "Source/Runtime/Engine/Animation/AnimTypes.h"
+#include "Source/Runtime/Engine/Animation/AnimUpdateRate.h"
 #include "USkeletalMeshComponent.generated.h"
 
 class UAnimationGraph;
@@ -34,6 +35,7 @@ public:
     void BeginPlay() override;
     void TickComponent(float DeltaTime) override;
     void EndPlay() override;
+    void OnUnregister() override;
 
     // Serialize to persist AnimGraphPath and reuse base behavior
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
@@ -137,8 +139,46 @@ public:
     void GatherNotifies(float DeltaTime);
     void GatherNotifiesFromRange(float PrevTime, float CurTime);
 
+    /** 큐에 쌓인 노티파이를 실행하고 비운다 (게임 스레드 전용) */
     void DispatchAnimNotifies();
 
+    /**
+     * @brief AnimInstance가 수집한 노티파이를 큐 끝에 추가 (워커 스레드에서 호출될 수 있음)
+     * @param Notifies 이번 프레임 구간에서 수집한 노티파이
+     * @param Animation 노티파이를 발생시킨 애니메이션
+     */
+    void QueueAnimNotifies(const TArray<FPendingAnimNotify>& Notifies, UAnimSequenceBase* Animation);
+
+    /**
+     * @brief 애니메이션 업데이트 단계의 게임 스레드 선행 구간: AnimInstance 상태머신 (전이 + OnUpdate)
+     * @return 포즈 단계를 ParallelUpdateAnimation으로 병렬 처리해도 되면 true.
+     *         false면 공유 블렌드 스페이스를 쓰는 중이라 호출자가 게임 스레드에서 바로 이어서 평가해야 한다
+     */
+    bool PreUpdateAnimation(float DeltaTime);
+
+    /**
+     * @brief 애니메이션 업데이트 단계의 병렬 구간: 포즈 추출/블렌딩 + 스키닝 행렬 계산
+     * @note PreUpdateAnimation 이후에 호출. 이 컴포넌트의 상태만 건드린다. 노티파이는 큐에만 쌓인다.
+     */
+    void ParallelUpdateAnimation(float DeltaTime);
+
+    /**
+     * @brief 애니메이션 업데이트 단계의 게임 스레드 구간: 노티파이 실행, 물리 바디 동기화, 소켓 갱신
+     */
+    void PostAnimationUpdate(FPhysScene* PhysScene);
+
+    /**
+     * @brief 렌더러가 이 컴포넌트를 그렸음을 알림 (다음 Tick의 업데이트 빈도 결정에 쓰임)
+     * @param ScreenSize 바운딩 구 지름 / 화면 높이
+     */
+    void MarkRenderedForAnimation(float ScreenSize) { AnimUpdateRate.MarkRendered(ScreenSize); }
+
+    /** 이번 프레임의 업데이트 빈도 상태 (통계용) */
+    const FAnimUpdateRateParams& GetAnimUpdateRate() const { return AnimUpdateRate; }
+
+    /** 화면 크기/가시성에 따른 업데이트 빈도 최적화 사용 여부 */
+    void SetUpdateRateOptimizationsEnabled(bool bEnabled) { bEnableUpdateRateOptimizations = bEnabled; }
+
     /**
      * @brief AnimInstance에서 계산한 포즈를 컴포넌트에 적용
      * @param InPose 적용할 포즈 (본별 로컬 트랜스폼)
@@ -186,6 +226,12 @@ protected:
      */
     void TickAnimInstances(float DeltaTime);
 
+    /**
+     * @brief 업데이트 빈도에 따라 이번 프레임 애니메이션을 평가하거나 건너뜀
+     * 건너뛴 프레임에는 (보이는 경우) 직전 표시 포즈에서 최신 평가 포즈 쪽으로 보간만 한다
+     */
+    void EvaluateAnimation(float DeltaTime);
+
 protected:
     /** 현재 재생 중인 애니메이션 */
     UPROPERTY()
@@ -247,14 +293,10 @@ protected:
     void ForceRecomputePose();
 
     /**
-     * @brief CurrentLocalSpacePose를 기반으로 CurrentComponentSpacePose 채우기
+     * @brief CurrentLocalSpacePose를 기반으로 CurrentComponentSpacePose와 TempFinalSkinning(Normal)Matrices 채우기
+     * 본마다 컴포넌트 트랜스폼을 합성한 자리에서 바로 스키닝 행렬까지 만든다 (법선 행렬은 회전/스케일에서 유도)
      */
-    void UpdateComponentSpaceTransforms();
-
-    /**
-     * @brief CurrentComponentSpacePose를 기반으로 TempFinalSkinningMatrices 채우기
-     */
-    void UpdateFinalSkinningMatrices();
+    void UpdateComponentSpaceAndSkinningMatrices();
 
 protected:
     /**
@@ -275,6 +317,33 @@ protected:
      * @brief CPU 스키닝에 전달할 최종 노말 스키닝 행렬
      */
     TArray<FMatrix> TempFinalSkinningNormalMatrices;
+    /**
+     * @brief 본별 InverseBindPose의 역전치 (메시가 바뀔 때 한 번 계산, 법선 행렬 유도용)
+     */
+    TArray<FMatrix> InverseBindNormalMatrices;
+    /**
+     * @brief 본별 말단 깊이 (본 LOD에서 멈출 본 판별용, 메시가 바뀔 때 한 번 계산)
+     */
+    TArray<uint8> BoneLeafDepths;
+
+    /////////////////////////////////////////////////////////////
+    // Update Rate Optimization
+    /////////////////////////////////////////////////////////////
+    FAnimUpdateRateParams AnimUpdateRate;
+    bool bEnableUpdateRateOptimizations = true;
+
+    /** 건너뛴 프레임 보간: 평가 직전에 표시하던 포즈 → 최신 평가 포즈 */
+    TArray<FTransform> InterpolationFromPose;
+    TArray<FTransform> InterpolationTargetPose;
+    bool bHasInterpolationTarget = false;
+
+    /** 보간할 평가 프레임에는 스키닝 행렬 계산을 보간 후 한 번만 한다 */
+    bool bDeferPoseRecompute = false;
+
+    /** 포즈 리비전 (ForceRecomputePose마다 증가, 컴포넌트 자신을 평가하는 스레드만 쓴다) */
+    uint32 PoseRevision = 1;
+    /** 소켓 자식들에게 마지막으로 알린 포즈 리비전 */
+    uint32 LastNotifiedPoseRevision = 0;
 
     /**
     * @brief Notifies들을 한 번에 처리하기 위한 행렬
@@ -326,10 +395,13 @@ public:
     void GetAllSocketNames(TArray<FName>& OutSocketNames) const;
 
     /**
-     * @brief 소켓에 붙은 자식 컴포넌트들의 transform 업데이트
+     * @brief 소켓에 붙은 자식 컴포넌트들의 transform 업데이트 (지난 알림 이후 포즈가 바뀐 경우에만)
      */
     void UpdateSocketAttachedComponents();
 
+    /** 컴포넌트 공간 포즈가 다시 계산될 때마다 증가 (소켓 자식의 월드 트랜스폼 캐시 무효화용) */
+    uint32 GetPoseRevision() const { return PoseRevision; }
+
 private:
     UPhysicsAsset*   PhysicsAsset = nullptr;   // 이 메쉬에 쓸 물리 에셋 (콜라이더/조인트 정의)
     UPhysicsAsset*   PhysicsAssetOverride = nullptr; // Instance-level override asset (if any)
@@ -5,6 +5,7 @@
 #include "MeshBatchElement.h"
 #include "PlatformTime.h"
 #include "SceneView.h"
+#include "Source/Runtime/Engine/Animation/CPUSkinning.h"
 
 USkinnedMeshComponent::USkinnedMeshComponent() : SkeletalMesh(nullptr)
 {
@@ -138,18 +139,18 @@ void USkinnedMeshComponent::DuplicateSubObjects()
 //    Renderer->EndLineBatch(FMatrix::Identity());
 // }
 
-void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+void USkinnedMeshComponent::PrepareMeshBatches(const FSceneView* View)
 {
+   Super::PrepareMeshBatches(View);
+
    if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
 
    bForceGPUSkinning = GWorld->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_GPUSkinning);         
 
+   // 포즈가 바뀐 뒤 처음 그려질 때만 스키닝 (컬링된 컴포넌트는 스키닝 비용을 내지 않는다)
    if (bSkinningMatricesDirty && !bForceGPUSkinning)
    {
-      TIME_PROFILE(VertexBuffer)
-      bSkinningMatricesDirty = false;
-      SkeletalMesh->UpdateVertexBuffer(SkinnedVertices, CPUSkinnedVertexBuffer);
-      TIME_PROFILE_END(VertexBuffer)
+      PerformSkinning();
    }
 
    if (bForceGPUSkinning &&
@@ -169,6 +170,12 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
                                         FinalSkinningNormalMatrices.Num());
       TIME_PROFILE_END(StructuredBuffer)
    }
+}
+
+void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
+{
+   // 스키닝/버퍼 업로드는 PrepareMeshBatches에서 끝났으므로 여기서는 읽기만 한다 (워커 스레드에서 호출됨)
+   if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData()) { return; }
 
    const TArray<FGroupInfo>& MeshGroupInfos = SkeletalMesh->GetMeshGroupInfo();
    auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
@@ -396,7 +403,6 @@ void USkinnedMeshComponent::SetSkeletalMesh(const FString& PathFileName)
       
       const TArray<FMatrix> IdentityMatrices(SkeletalMesh->GetBoneCount(), FMatrix::Identity());
       UpdateSkinningMatrices(IdentityMatrices, IdentityMatrices);
-      PerformSkinning();
       
       const TArray<FGroupInfo>& GroupInfos = SkeletalMesh->GetMeshGroupInfo();
        MaterialSlots.resize(GroupInfos.size());
@@ -412,36 +418,39 @@ void USkinnedMeshComponent::SetSkeletalMesh(const FString& PathFileName)
    {
       SkeletalMesh = nullptr;
       UpdateSkinningMatrices(TArray<FMatrix>(), TArray<FMatrix>());
-      PerformSkinning();
    }
 }
 
 void USkinnedMeshComponent::PerformSkinning()
 {
-   if (!SkeletalMesh || FinalSkinningMatrices.IsEmpty()) { return; }
-   if (!bSkinningMatricesDirty) { return; }
+   if (!SkeletalMesh || !SkeletalMesh->GetSkeletalMeshData() || !CPUSkinnedVertexBuffer) { return; }
+   if (!bSkinningMatricesDirty || bForceGPUSkinning) { return; }
 
-   if (bForceGPUSkinning)
-   {      
+   const TArray<FSkinnedVertex>& SrcVertices = SkeletalMesh->GetSkeletalMeshData()->Vertices;
+   const int32 NumVertices = SrcVertices.Num();
+   // 행렬이 본 개수보다 적으면 (메시 교체 직후 등) 본 인덱스가 범위를 벗어날 수 있다
+   if (NumVertices == 0 ||
+      FinalSkinningMatrices.Num() < static_cast<int32>(SkeletalMesh->GetBoneCount()) ||
+      FinalSkinningNormalMatrices.Num() != FinalSkinningMatrices.Num())
+   {
       return;
    }
 
    TIME_PROFILE(CPUSkinning)
-   const TArray<FSkinnedVertex>& SrcVertices = SkeletalMesh->GetSkeletalMeshData()->Vertices;
-   const int32 NumVertices = SrcVertices.Num();
-   SkinnedVertices.SetNum(NumVertices);
-
-   for (int32 Idx = 0; Idx < NumVertices; ++Idx)
+   // 중간 배열 없이 Map한 동적 버퍼에 바로 쓴다 (WRITE_DISCARD라 모든 정점을 다시 써야 함)
+   ID3D11DeviceContext* DeviceContext = GEngine.GetRHIDevice()->GetDeviceContext();
+   D3D11_MAPPED_SUBRESOURCE Mapped = {};
+   if (FAILED(DeviceContext->Map(CPUSkinnedVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
    {
-      const FSkinnedVertex& SrcVert = SrcVertices[Idx];
-      FNormalVertex& DstVert = SkinnedVertices[Idx];
-
-      DstVert.pos = SkinVertexPosition(SrcVert); 
-      DstVert.normal = SkinVertexNormal(SrcVert);
-      DstVert.Tangent = SkinVertexTangent(SrcVert);
-      DstVert.tex = SrcVert.UV;
+      return;
    }
-   TIME_PROFILE_END(CPUSkinning)   
+
+   CPUSkinning::SkinVertices(SrcVertices.data(), static_cast<FVertexDynamic*>(Mapped.pData), NumVertices,
+      FinalSkinningMatrices.data(), FinalSkinningNormalMatrices.data());
+
+   DeviceContext->Unmap(CPUSkinnedVertexBuffer, 0);
+   bSkinningMatricesDirty = false;
+   TIME_PROFILE_END(CPUSkinning)
 }
 
 void USkinnedMeshComponent::UpdateSkinningMatrices(const TArray<FMatrix>& InSkinningMatrices, const TArray<FMatrix>& InSkinningNormalMatrices)
@@ -451,67 +460,3 @@ void USkinnedMeshComponent::UpdateSkinningMatrices(const TArray<FMatrix>& InSkin
    bSkinningMatricesDirty = true;   
 
 }
-
-FVector USkinnedMeshComponent::SkinVertexPosition(const FSkinnedVertex& InVertex) const
-{
-   FVector BlendedPosition(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
-   {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         const FMatrix& SkinMatrix = FinalSkinningMatrices[BoneIndex];
-         FVector TransformedPosition = SkinMatrix.TransformPosition(InVertex.Position);
-         BlendedPosition += TransformedPosition * Weight;
-      }
-   }
-
-   return BlendedPosition;
-}
-
-FVector USkinnedMeshComponent::SkinVertexNormal(const FSkinnedVertex& InVertex) const
-{
-   FVector BlendedNormal(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
-   {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         const FMatrix& SkinMatrix = FinalSkinningNormalMatrices[BoneIndex];
-         FVector TransformedNormal = SkinMatrix.TransformVector(InVertex.Normal);
-         BlendedNormal += TransformedNormal * Weight;
-      }
-   }
-
-   return BlendedNormal.GetSafeNormal();
-}
-
-FVector4 USkinnedMeshComponent::SkinVertexTangent(const FSkinnedVertex& InVertex) const
-{
-   const FVector OriginalTangentDir(InVertex.Tangent.X, InVertex.Tangent.Y, InVertex.Tangent.Z);
-   const float OriginalSignW = InVertex.Tangent.W;
-
-   FVector BlendedTangentDir(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
-   {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         const FMatrix& SkinMatrix = FinalSkinningMatrices[BoneIndex];
-         FVector TransformedTangentDir = SkinMatrix.TransformVector(OriginalTangentDir);
-         BlendedTangentDir += TransformedTangentDir * Weight;
-      }
-   }
-
-   const FVector FinalTangentDir = BlendedTangentDir.GetSafeNormal();
-   return { FinalTangentDir.X, FinalTangentDir.Y, FinalTangentDir.Z, OriginalSignW };
-}
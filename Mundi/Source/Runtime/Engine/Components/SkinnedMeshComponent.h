@@ -22,6 +22,7 @@ public:
     
 // Mesh Component Section
 public:
+    void PrepareMeshBatches(const FSceneView* View) override;
     void CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) override;
     
     FAABB GetWorldAABB() const override;
@@ -42,6 +43,10 @@ public:
     USkeletalMesh* GetSkeletalMesh() const { return SkeletalMesh; }
 
 protected:
+    /**
+     * @brief 스키닝 행렬이 바뀌었으면 CPU 스키닝 결과를 CPUSkinnedVertexBuffer에 바로 씀
+     * 정점 구간을 워커 스레드에 나눠 SIMD로 처리하며, 그려질 때(PrepareMeshBatches)만 호출된다
+     */
     void PerformSkinning();
     /**
      * @brief 자식에게서 원본 메시를 받아 CPU 스키닝을 수행
@@ -55,17 +60,13 @@ protected:
     bool bForceGPUSkinning = false;
 
     /**
-     * @brief CPU 스키닝 최종 결과물. 렌더러가 이 데이터를 사용합니다.
+     * @brief CPU에서 만든 정점 결과물 (Cloth 시뮬레이션용). 일반 CPU 스키닝은 정점 버퍼에 바로 쓰므로 사용하지 않습니다.
      */
     TArray<FNormalVertex> SkinnedVertices;
     /**
      * @brief CPU 스키닝 최종 결과물. 렌더러가 이 데이터를 사용합니다.
      */
     TArray<FNormalVertex> NormalSkinnedVertices;
-     
-    FVector SkinVertexPosition(const FSkinnedVertex& InVertex) const;
-    FVector SkinVertexNormal(const FSkinnedVertex& InVertex) const;
-    FVector4 SkinVertexTangent(const FSkinnedVertex& InVertex) const;
 
     /**
      * @brief 자식이 계산해 준, 현재 프레임의 최종 스키닝 행렬
@@ -244,6 +244,13 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 			BatchElement.VertexShader = ShaderVariant->VertexShader;
 			BatchElement.PixelShader = ShaderVariant->PixelShader;
 			BatchElement.InputLayout = ShaderVariant->InputLayout;
+
+			// 같은 메시/머티리얼끼리 렌더러가 인스턴스드 드로우로 합칠 수 있도록
+			if (ShaderToUse->SupportsInstancing())
+			{
+				BatchElement.InstancingShader = ShaderToUse;
+				BatchElement.ShaderVariant = ShaderVariant;
+			}
 		}
 
 		// UMaterialInterface를 UMaterial로 캐스팅해야 할 수 있음. 렌더러가 UMaterial을 기대한다면.
@@ -15,6 +15,7 @@
 #include "Source/Runtime/Engine/Physics/Cloth/ClothManager.h"
 #include "Source/Runtime/Debug/CrashHandler.h"
 #include "Source/Game/UI/GameUIManager.h"
+#include "JobSystem.h"
 
 float UEditorEngine::ClientWidth = 1024.0f;
 float UEditorEngine::ClientHeight = 1024.0f;
@@ -187,6 +188,9 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
 
+    // 워커 스레드 (에셋 프리로드부터 Job을 쓰므로 가장 먼저)
+    FJobSystem::GetInstance().Initialize();
+
     if (!CreateMainWindow(hInstance))
         return false;
 
@@ -395,6 +399,9 @@ void UEditorEngine::Shutdown()
     FObjManager::Clear();
 
     FClothManager::GetInstance().Shutdown();
+
+    // 컴포넌트가 모두 삭제되어 남은 Job이 없으므로 워커 스레드 정리
+    FJobSystem::GetInstance().Shutdown();
      
     // IMPORTANT: Explicitly release Renderer before RHIDevice destructor runs
     // Renderer may hold references to D3D resources
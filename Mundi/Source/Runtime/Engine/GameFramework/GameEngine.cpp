@@ -13,6 +13,7 @@
 
 #ifdef _GAME
 #include "Source/Game/UI/GameUIManager.h"
+#include "JobSystem.h"
 #include "Source/Game/AngryCoachGameMode.h"
 #endif
 
@@ -209,6 +210,9 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
 
     LoadIniFile();
 
+    // 워커 스레드 (에셋 프리로드부터 Job을 쓰므로 가장 먼저)
+    FJobSystem::GetInstance().Initialize();
+
     if (!CreateMainWindow(hInstance))
         return false;
 
@@ -426,6 +430,9 @@ void UGameEngine::Shutdown()
     // before the global GEngine variable's destructor runs
     FObjManager::Clear();
 
+    // 컴포넌트가 모두 삭제되어 남은 Job이 없으므로 워커 스레드 정리
+    FJobSystem::GetInstance().Shutdown();
+
     // IMPORTANT: Explicitly release Renderer before RHIDevice destructor runs
     // Renderer may hold references to D3D resources
     Renderer.reset();
@@ -28,6 +28,9 @@
 #include "Level.h"
 #include "LightManager.h"
 #include "LuaManager.h"
+#include "Source/Runtime/Engine/Particle/Async/ParticleCollisionScene.h"
+#include "ShapeOverlapScene.h"
+#include "Source/Runtime/Engine/Animation/AnimationUpdateQueue.h"
 #include "Source/Game/UI/GameUIManager.h"
 #include "ShapeComponent.h"
 #include "PlayerCameraManager.h"
@@ -43,6 +46,9 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 	LightManager = std::make_unique<FLightManager>();
 	LightManager->SetOwningWorld(this);  // Set owning world for optimization decisions
 	LuaManager = std::make_unique<FLuaManager>();
+	ParticleCollisionScene = std::make_unique<FParticleCollisionScene>(this);
+	ShapeOverlapScene = std::make_unique<FShapeOverlapScene>(this);
+	AnimationUpdateQueue = std::make_unique<FAnimationUpdateQueue>(this);
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -273,6 +279,18 @@ void UWorld::Tick(float DeltaSeconds)
 	// 중복충돌 방지 pair clear
     FrameOverlapPairs.clear();
 
+	// 파티클 콜라이더 Grid는 이번 프레임 첫 요청 때 다시 빌드
+	if (ParticleCollisionScene)
+	{
+		ParticleCollisionScene->BeginFrame();
+	}
+
+	// 셰이프 겹침은 이번 프레임 첫 셰이프 Tick에서 한 번 해석
+	if (ShapeOverlapScene)
+	{
+		ShapeOverlapScene->BeginFrame();
+	}
+
     // Skip partition update for preview worlds (no spatial partitioning needed)
     if (Partition)
     {
@@ -310,6 +328,13 @@ void UWorld::Tick(float DeltaSeconds)
 		}
     }
 
+	// 애니메이션 업데이트 단계: 액터 Tick 중에 모인 스켈레탈 메시 포즈를 병렬 평가하고
+	// 노티파이/물리 바디/소켓은 게임 스레드에서 순서대로 반영 (Lua, 물리 시작 전에 끝나야 함)
+	if (AnimationUpdateQueue)
+	{
+		AnimationUpdateQueue->Flush();
+	}
+
 	// Lua 코루틴 전용 Tick
 	if (LuaManager && bPie)
 	{
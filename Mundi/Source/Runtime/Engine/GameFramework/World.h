@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Object.h"
+#include "WeakObjectPtr.h"
 #include "Enums.h"
 #include "RenderSettings.h"
 #include "Level.h"
@@ -28,6 +29,9 @@ class BVHierachy;
 class UStaticMesh;
 class FOcclusionCullingManagerCPU;
 class APlayerCameraManager;
+class FParticleCollisionScene;
+class FShapeOverlapScene;
+class FAnimationUpdateQueue;
 class AGameModeBase;
 
 struct FTransform;
@@ -98,6 +102,9 @@ public:
     ULevel* GetLevel() const { return Level.get(); }
     FLightManager* GetLightManager() const { return LightManager.get(); }
     FLuaManager* GetLuaManager() const { return LuaManager.get(); }
+    FParticleCollisionScene* GetParticleCollisionScene() const { return ParticleCollisionScene.get(); }
+    FShapeOverlapScene* GetShapeOverlapScene() const { return ShapeOverlapScene.get(); }
+    FAnimationUpdateQueue* GetAnimationUpdateQueue() const { return AnimationUpdateQueue.get(); }
     FPhysScene* GetPhysScene() { return PhysScene.get(); }
 
     /** 뷰어 등 별도의 물리 시뮬레이션이 필요한 월드에서 호출 */
@@ -122,7 +129,7 @@ public:
 
     /** === 타임 / 틱 === */
     virtual void Tick(float DeltaSeconds);
-    // Overlap pair de-duplication (per-frame)
+    // Overlap pair de-duplication (per-frame, 액터 쌍당 Begin/End 이벤트를 한 번만 방송)
     bool TryMarkOverlapPair(const AActor* A, const AActor* B);
 
     TMap<TWeakObjectPtr<AActor>, FActorTimeState> ActorTimingMap;
@@ -169,6 +176,15 @@ private:
     /** === 루아 매니저 ===*/
     std::unique_ptr<FLuaManager> LuaManager;
 
+    /** === 파티클 충돌 씬 (프레임당 한 번 빌드하는 콜라이더 Grid) ===*/
+    std::unique_ptr<FParticleCollisionScene> ParticleCollisionScene;
+
+    /** === 셰이프 겹침 씬 (프레임당 한 번 돌리는 셰이프 컴포넌트 브로드/내로우 페이즈) ===*/
+    std::unique_ptr<FShapeOverlapScene> ShapeOverlapScene;
+
+    /** === 애니메이션 업데이트 단계 (액터 Tick 중에 모은 스켈레탈 메시를 병렬 평가) ===*/
+    std::unique_ptr<FAnimationUpdateQueue> AnimationUpdateQueue;
+
     /** === 물리 씬 ===*/
     std::unique_ptr<FPhysScene> PhysScene;
     
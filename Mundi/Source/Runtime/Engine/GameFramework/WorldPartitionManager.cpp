@@ -19,7 +19,8 @@ UWorldPartitionManager::UWorldPartitionManager()
 	SceneOctree = new FOctree(WorldBounds, 0, 8, 10);
 	// BVH도 동일 월드 바운드로 초기화 (더 깊고 작은 리프 설정)
 	//BVH = new FBVHierachy(FBound(), 0, 5, 1); 
-	BVH = new FBVHierarchy(FAABB(), 0, 8, 1); 
+	// 리프 하나에 최대 8개: 리프 판정이 SSE 4개 묶음 두 번으로 끝나도록
+	BVH = new FBVHierarchy(FAABB(), 0, 8, 8); 
 	//BVH = new FBVHierachy(FBound(), 0, 10, 3);
 }
 
@@ -2,76 +2,166 @@
 #include "ParticleAsyncUpdater.h"
 
 #include "PlatformTime.h"
+#include "Source/Runtime/Engine/Particle/ParticleLODLevel.h"
+#include "Source/Runtime/Engine/Particle/Modules/ParticleModuleEventReceiverSpawn.h"
 
-FParticleAsyncUpdater::~FParticleAsyncUpdater()
+namespace
 {
-    if (TaskHandle.valid())
-    {
-        // 1. 작업이 끝날 때까지 기다림
-        TaskHandle.wait();
+    // 모든 파티클 컴포넌트의 Job이 묶이는 프레임 펜스
+    FJobFence GParticleJobFence;
 
-        // 2. ★ 중요 ★ 결과물을 꺼내야 함!
-        // 이걸 안 하면 future 안에 들어있던 포인터 뭉치가 그냥 증발(Leak)함
-        FAsyncSimulationResult PendingResult = TaskHandle.get();
+    bool HasEventReceiver(const FParticleEmitterInstance* Inst)
+    {
+        if (!Inst || !Inst->CurrentLODLevel) { return false; }
 
-        // 3. 꺼낸 데이터(막 생성된 따끈따끈한 릭 유발자들)를 수동으로 삭제
-        for (FDynamicEmitterDataBase* Data : PendingResult.RenderData)
+        for (UParticleModule* Module : Inst->CurrentLODLevel->UpdateModules)
         {
-            if (Data) delete Data;
+            if (Module && Module->bEnabled && Cast<UParticleModuleEventReceiverSpawn>(Module))
+            {
+                return true;
+            }
         }
-        PendingResult.RenderData.Empty();
+        return false;
     }
+}
 
-    // 4. 기존에 멤버변수로 들고 있던 데이터 삭제
+FParticleAsyncUpdater::~FParticleAsyncUpdater()
+{
+    // 1. 작업이 끝날 때까지 기다림 (Job들이 this를 참조하고 있음)
+    EnsureCompletion();
+
+    // 2. RenderData/PendingRenderData는 풀에서 빌려온 포인터라 비우기만 한다
+    PendingRenderData.Empty();
+    bHasPendingResult = false;
     InternalClearRenderData();
+
+    // 3. 실제 페이로드는 풀이 소유
+    FreeRenderDataPool();
 }
 
-void FParticleAsyncUpdater::KickOff(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context)
+void FParticleAsyncUpdater::KickOff(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext&& Context)
 {
     if (IsBusy()) { return; }
-    
-    if (TaskHandle.valid())
+
+    // 이전 작업 결과 교체 (Swap)
+    ConsumePendingResult();
+
+    PendingInstances = Instances;
+
+    // EventData는 용량을 유지한 채 다시 쓴다 (새 Context의 배열로 덮으면 매 프레임 다시 할당된다)
+    TArray<FParticleEventData> EventStorage;
+    EventStorage.swap(PendingContext.EventData);
+    EventStorage.Empty();
+    EventStorage.Append(Context.EventData);
+    PendingContext = std::move(Context);
+    PendingContext.EventData.swap(EventStorage);
+    PendingContext.EventDataLock = EventDataLock.get();
+    PendingRenderData.Empty();
+    PendingRenderData.SetNum(PendingInstances.Num(), nullptr);
+    if (RenderDataPool.Num() < PendingInstances.Num())
     {
-        FAsyncSimulationResult Result = TaskHandle.get();
-        
-        // 데이터 교체 (Swap)
-        InternalClearRenderData();
-        RenderData = std::move(Result.RenderData);
-        LastFrameStats = Result.Stats;
+        RenderDataPool.SetNum(PendingInstances.Num());
     }
-    
-    TaskHandle = std::async(std::launch::async, [Instances, Context]() 
+
+    FJobSystem& JobSystem = FJobSystem::GetInstance();
+
+    // 이벤트를 받는 이미터는 같은 프레임에 다른 이미터가 만든 이벤트를 봐야 하므로 나중에 돌린다
+    TArray<FJobHandle>& EmitterJobs = EmitterJobHandles;
+    EmitterJobs.Empty();
+    ReceiverIndices.Empty();
+    EmitterJobs.Reserve(PendingInstances.Num());
+
+    for (int32 Idx = 0; Idx < PendingInstances.Num(); ++Idx)
     {
-        return DoSimulationWork(Instances, Context);
-    });
+        if (!PendingInstances[Idx]) continue;
+
+        if (HasEventReceiver(PendingInstances[Idx]))
+        {
+            ReceiverIndices.Add(Idx);
+            continue;
+        }
+
+        EmitterJobs.Add(JobSystem.Submit([this, Idx]()
+        {
+            PendingRenderData[Idx] = SimulateEmitter(PendingInstances[Idx], Idx, PendingContext);
+        }, &GParticleJobFence, JobPool.get()));
+    }
+
+    if (!ReceiverIndices.IsEmpty())
+    {
+        // 수신 이미터는 EventData를 순회하므로 한 Job에서 순서대로 처리
+        FJobHandle ReceiverJob = JobSystem.Submit([this]()
+        {
+            for (int32 Idx : ReceiverIndices)
+            {
+                PendingRenderData[Idx] = SimulateEmitter(PendingInstances[Idx], Idx, PendingContext);
+            }
+        }, EmitterJobs, &GParticleJobFence, JobPool.get());
+        EmitterJobs.Add(ReceiverJob);
+    }
+
+    // 모든 이미터가 끝나면 통계 집계 + 빈 슬롯 정리
+    CompletionHandle = JobSystem.Submit([this]()
+    {
+        // 배열 용량을 유지하려고 PendingStats에 바로 쓴다
+        FParticleFrameStats& Stats = PendingStats;
+        Stats.TotalActiveParticles = 0;
+        Stats.bHasActiveParticles = false;
+        Stats.bAllEmittersComplete = true;
+        Stats.SortStats.Empty();
+        // 이 Job까지 이번 작업의 Job은 모두 풀에서 꺼냈으므로 여기서 풀 미스를 가져온다
+        Stats.HeapAllocations = JobPool->ConsumeAllocationCount();
+
+        for (FParticleEmitterInstance* Inst : PendingInstances)
+        {
+            if (!Inst) continue;
+
+            const int32 Count = Inst->ActiveParticles;
+            Stats.TotalActiveParticles += Count;
+            if (Count > 0)
+            {
+                Stats.bHasActiveParticles = true;
+            }
+            if (!Inst->IsComplete())
+            {
+                Stats.bAllEmittersComplete = false;
+            }
+            GatherEmitterStats(Inst, Stats);
+        }
+
+        PendingRenderData.RemoveAll(nullptr);
+    }, EmitterJobs, &GParticleJobFence, JobPool.get());
+    bHasPendingResult = true;
 }
 
-void FParticleAsyncUpdater::KickOffSync(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context)
+void FParticleAsyncUpdater::KickOffSync(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext&& Context)
 {
-    Sync();
+    EnsureCompletion();
+    ConsumePendingResult();
     if (!RenderData.IsEmpty())
     {
         InternalClearRenderData();
     }
-    FAsyncSimulationResult Result = DoSimulationWork(Instances, Context);
-    // 새 데이터로 교체
-    RenderData = std::move(Result.RenderData);
+    if (RenderDataPool.Num() < Instances.Num())
+    {
+        RenderDataPool.SetNum(Instances.Num());
+    }
 
-    // 통계 갱신
-    LastFrameStats = Result.Stats;
+    // 새 데이터로 교체 + 통계 갱신
+    LastFrameStats = DoSimulationWork(Instances, Context, RenderData);
 }
 
 void FParticleAsyncUpdater::EnsureCompletion()
 {
-    if (TaskHandle.valid())
+    if (CompletionHandle.IsValid())
     {
-        TaskHandle.wait();
+        FJobSystem::GetInstance().Wait(CompletionHandle);
     }
 }
 
 void FParticleAsyncUpdater::ResetStats()
 {
-    LastFrameStats.bAllEmittersComplete = false; 
+    LastFrameStats.bAllEmittersComplete = false;
     LastFrameStats.bHasActiveParticles = false;
     LastFrameStats.TotalActiveParticles = 0;
 }
@@ -82,21 +172,13 @@ void FParticleAsyncUpdater::Sync()
 
 bool FParticleAsyncUpdater::TrySync()
 {
-    if (!TaskHandle.valid()) return false;
+    if (!CompletionHandle.IsValid()) return false;
 
     // 즉시 상태 확인
-    auto Status = TaskHandle.wait_for(std::chrono::seconds(0));
-    if (Status == std::future_status::ready)
+    if (CompletionHandle.IsComplete())
     {
-        // 작업 완료
-        FAsyncSimulationResult Result = TaskHandle.get();
-
-        // 데이터 교체
-        InternalClearRenderData();
-        RenderData = std::move(Result.RenderData);
-        LastFrameStats = Result.Stats;
-            
-        return true;
+        // 작업 완료 -> 데이터 교체
+        return ConsumePendingResult();
     }
 
     return false; // 아직 일하는 중 (기존 데이터 유지)
@@ -104,74 +186,143 @@ bool FParticleAsyncUpdater::TrySync()
 
 bool FParticleAsyncUpdater::IsBusy() const
 {
-    return TaskHandle.valid() && TaskHandle.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+    return CompletionHandle.IsValid() && !CompletionHandle.IsComplete();
 }
 
-FAsyncSimulationResult FParticleAsyncUpdater::DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext Context)
+void FParticleAsyncUpdater::WaitForAllParticleJobs()
 {
-    TIME_PROFILE(Particle_Simulation)
-    FAsyncSimulationResult Result;
-        
-    // 통계 초기화
-    Result.Stats.bAllEmittersComplete = true;
-    Result.Stats.TotalActiveParticles = 0;
-    Result.Stats.bHasActiveParticles = false;
+    TIME_PROFILE(Particle_WaitJobs)
+    FJobSystem::GetInstance().Wait(GParticleJobFence);
+}
 
-    const FVector ViewOrigin = Context.CameraLocation; // 혹은 Context.CameraLocation (별도 추가 권장)
-    const FVector ViewDir = Context.CameraRotation.ToEulerZYXDeg(); // 혹은 Context.CameraForward
+FParticleFrameStats FParticleAsyncUpdater::DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context, TArray<FDynamicEmitterDataBase*>& OutRenderData)
+{
+    FParticleFrameStats Stats;
+
+    // 통계 초기화
+    Stats.bAllEmittersComplete = true;
+    Stats.TotalActiveParticles = 0;
+    Stats.bHasActiveParticles = false;
 
     for (int32 Idx = 0; Idx < Instances.Num(); ++Idx)
     {
         FParticleEmitterInstance* Inst = Instances[Idx];
         if (!Inst) continue;
 
-        // 시뮬레이션 수행
-        Inst->Tick(Context);
+        FDynamicEmitterDataBase* EmitterData = SimulateEmitter(Inst, Idx, Context);
 
         // 통계 집계
         int32 Count = Inst->ActiveParticles;
-        Result.Stats.TotalActiveParticles += Count;
-            
-        if (Count > 0) 
+        Stats.TotalActiveParticles += Count;
+
+        if (Count > 0)
         {
-            Result.Stats.bHasActiveParticles = true;
+            Stats.bHasActiveParticles = true;
         }
-            
+
         if (!Inst->IsComplete())
         {
-            Result.Stats.bAllEmittersComplete = false;
+            Stats.bAllEmittersComplete = false;
         }
+        GatherEmitterStats(Inst, Stats);
 
-        // 렌더 데이터 생성
-        FDynamicEmitterDataBase* EmitterData = Inst->CreateDynamicData();
         if (EmitterData)
         {
-            EmitterData->EmitterIndex = Idx;
-            if (EmitterData->EmitterType == EParticleType::Sprite)
-            {
-                auto* SpriteData = static_cast<FDynamicSpriteEmitterData*>(EmitterData);
-                SpriteData->SortParticles(ViewOrigin, ViewDir, Context.ComponentWorldMatrix, SpriteData->AsyncSortedIndices);
-            }
-            else if (EmitterData->EmitterType == EParticleType::Mesh)
-            {
-                auto* MeshData = static_cast<FDynamicMeshEmitterData*>(EmitterData);
-                MeshData->SortParticles(ViewOrigin, ViewDir, Context.ComponentWorldMatrix, MeshData->AsyncSortedIndices);
-            }
-            Result.RenderData.Add(EmitterData);
+            OutRenderData.Add(EmitterData);
         }
     }
 
-    return Result;
+    return Stats;
+}
+
+void FParticleAsyncUpdater::GatherEmitterStats(FParticleEmitterInstance* Inst, FParticleFrameStats& OutStats)
+{
+    OutStats.HeapAllocations += Inst->RenderAllocationCount;
+    Inst->RenderAllocationCount = 0;
+
+    if (Inst->LastSortAlgorithm == EParticleSortAlgorithm::None) { return; }
+
+    FParticleEmitterSortStat& Stat = OutStats.SortStats[OutStats.SortStats.Emplace()];
+    Stat.Emitter = Inst->Template;
+    Stat.NumParticles = static_cast<uint32>(Inst->LastSortedIndices.Num());
+    Stat.SortTimeMs = Inst->LastSortTimeMs;
+    Stat.Algorithm = Inst->LastSortAlgorithm;
+}
+
+FDynamicEmitterDataBase* FParticleAsyncUpdater::SimulateEmitter(FParticleEmitterInstance* Inst, int32 EmitterIndex, FParticleSimulationContext& Context)
+{
+    TIME_PROFILE(Particle_Simulation)
+
+    // 시뮬레이션 수행
+    Inst->Tick(Context);
+
+    // 렌더 데이터 생성 (이 이미터의 링에서 다음 슬롯을 재사용)
+    FEmitterRenderDataRing& Ring = RenderDataPool[EmitterIndex];
+    FDynamicEmitterDataBase* EmitterData = Inst->CreateDynamicData(Ring.Slots[Ring.Cursor]);
+    if (!EmitterData)
+    {
+        return nullptr;
+    }
+    Ring.Cursor = (Ring.Cursor + 1) % FEmitterRenderDataRing::NumSlots;
+
+    const FVector ViewOrigin = Context.CameraLocation; // 혹은 Context.CameraLocation (별도 추가 권장)
+    const FVector ViewDir = Context.CameraRotation.ToEulerZYXDeg(); // 혹은 Context.CameraForward
+
+    EmitterData->EmitterIndex = EmitterIndex;
+    Inst->LastSortAlgorithm = EParticleSortAlgorithm::None;
+    Inst->LastSortTimeMs = 0.0;
+    if (EmitterData->EmitterType == EParticleType::Sprite || EmitterData->EmitterType == EParticleType::Mesh)
+    {
+        auto* TranslucentData = static_cast<FDynamicTranslucentEmitterDataBase*>(EmitterData);
+
+        const uint64 SortStart = FPlatformTime::Cycles64();
+        TranslucentData->SortParticles(ViewOrigin, ViewDir, Context.ComponentWorldMatrix,
+            Inst->LastSortedIndices, TranslucentData->AsyncSortedIndices);
+        const uint64 SortEnd = FPlatformTime::Cycles64();
+
+        // 다음 프레임 삽입 정렬의 시작 순서로 보관
+        Inst->LastSortedIndices = TranslucentData->AsyncSortedIndices;
+        Inst->LastSortAlgorithm = TranslucentData->SortAlgorithm;
+        Inst->LastSortTimeMs = FPlatformTime::ToMilliseconds(SortEnd - SortStart);
+    }
+    else
+    {
+        Inst->LastSortedIndices.Empty();
+    }
+
+    return EmitterData;
+}
+
+bool FParticleAsyncUpdater::ConsumePendingResult()
+{
+    if (!bHasPendingResult || IsBusy())
+    {
+        return false;
+    }
+
+    // 데이터 교체 (Swap, 두 배열 모두 용량을 유지)
+    InternalClearRenderData();
+    RenderData.swap(PendingRenderData);
+    LastFrameStats = PendingStats;
+    bHasPendingResult = false;
+    return true;
 }
 
 void FParticleAsyncUpdater::InternalClearRenderData()
 {
-    for (FDynamicEmitterDataBase* Data : RenderData)
+    // 페이로드는 RenderDataPool 소유 (다음 프레임에 재사용)
+    RenderData.Empty();
+}
+
+void FParticleAsyncUpdater::FreeRenderDataPool()
+{
+    for (FEmitterRenderDataRing& Ring : RenderDataPool)
     {
-        if (Data)
+        for (FDynamicEmitterDataBase*& Slot : Ring.Slots)
         {
-            delete Data;
+            delete Slot;
+            Slot = nullptr;
         }
     }
-    RenderData.Empty();
+    RenderDataPool.Empty();
 }
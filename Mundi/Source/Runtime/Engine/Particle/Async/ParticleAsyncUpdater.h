@@ -1,29 +1,36 @@
 ﻿#pragma once
-#include <future>
+#include <mutex>
 
+#include "JobSystem.h"
 #include "Source/Runtime/Engine/Particle/DynamicEmitterDataBase.h"
+#include "Source/Runtime/Engine/Particle/ParticleStats.h"
 
 struct FParticleFrameStats
 {
     uint32 TotalActiveParticles = 0;
     bool bAllEmittersComplete = false;
     bool bHasActiveParticles = false;
+    // 이번 작업에서 정렬한 이미터들
+    TArray<FParticleEmitterSortStat> SortStats;
+    // 이번 작업에서 힙에서 새로 할당한 횟수: 렌더 페이로드/DataContainer + Job 풀 미스 (정상 상태면 0)
+    uint32 HeapAllocations = 0;
 };
 
-struct FAsyncSimulationResult
-{
-    // 렌더링 데이터
-    TArray<FDynamicEmitterDataBase*> RenderData;
-    // 통계 데이터
-    FParticleFrameStats Stats;
-};
-
+/**
+ * 컴포넌트 하나의 파티클 시뮬레이션을 Job System에 맡기는 관리자
+ * - 이미터 인스턴스 하나당 Job 하나 (이벤트 수신 이미터는 송신 이미터들이 끝난 뒤 실행)
+ * - 모든 이미터 Job이 끝나면 Gather Job이 통계를 모으고 결과를 완성한다
+ * - 모든 컴포넌트의 Job은 전역 파티클 펜스에 묶여 있어 렌더러가 프레임 단위로 기다릴 수 있다 (WaitForAllParticleJobs)
+ * - 기본 렌더 경로는 기다리지 않는다: 완료 핸들이 끝난 결과만 RenderData로 교체되고, 진행 중인 Job은 다른 링 슬롯에 쓴다
+ * - 렌더 페이로드는 이미터별 링 풀에서, Job 객체와 의존성 배열은 컴포넌트별 Job 풀에서 돌려 쓴다
+ *   정상 상태 프레임에는 힙 할당이 없으며, 풀 미스는 모두 HeapAllocations에 잡힌다
+ */
 class FParticleAsyncUpdater
 {
 public:
     FParticleAsyncUpdater() = default;
 
-    // TaskHandle(std::future)은 복사할 수 없으므로, 그냥 빈 상태로 초기화
+    // Job은 this를 참조하므로 복사본은 빈 상태로 시작
     FParticleAsyncUpdater(const FParticleAsyncUpdater& Other)
     {
         LastFrameStats = FParticleFrameStats();
@@ -33,25 +40,26 @@ public:
     {
         if (this != &Other)
         {
-            if (TaskHandle.valid()) TaskHandle.wait();
+            EnsureCompletion();
             InternalClearRenderData();
+            PendingRenderData.Empty();
+            bHasPendingResult = false;
+            FreeRenderDataPool();
             LastFrameStats = FParticleFrameStats();
         }
         return *this;
     }
 
-    FParticleAsyncUpdater(FParticleAsyncUpdater&&) = default;
-    FParticleAsyncUpdater& operator=(FParticleAsyncUpdater&&) = default;
     ~FParticleAsyncUpdater();
-    
+
     // [Main Thread 읽기 전용] 이전 프레임의 통계 캐시
     FParticleFrameStats LastFrameStats;
-    // [Main Thread 읽기 전용] 렌더링 데이터
+    // [Main Thread 읽기 전용] 렌더링 데이터 (RenderDataPool 소유, 여기서는 빌려 쓰기만 한다)
     TArray<FDynamicEmitterDataBase*> RenderData;
 
-    // 작업 시작
-    void KickOff(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context);
-    void KickOffSync(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context);
+    // 작업 시작 (Context는 Job들이 끝날 때까지 이 객체가 소유)
+    void KickOff(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext&& Context);
+    void KickOffSync(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext&& Context);
     void EnsureCompletion();
     void ResetStats();
 
@@ -62,9 +70,49 @@ public:
     // 현재 작업 중인지 확인
     bool IsBusy() const;
 
+    /** 지금까지 제출된 모든 컴포넌트의 파티클 Job이 끝날 때까지 대기 (렌더러 프레임 펜스) */
+    static void WaitForAllParticleJobs();
+
 private:
-    static FAsyncSimulationResult DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext Context);
+    /**
+     * 이미터 하나의 렌더 페이로드 링
+     * - 동시에 쓰이는 건 최대 2개 (렌더 중인 RenderData + Job이 채우는 PendingRenderData), 1개는 여유
+     * - 이미터 Job 하나만 자기 링을 건드리므로 락이 필요 없다
+     */
+    struct FEmitterRenderDataRing
+    {
+        static constexpr int32 NumSlots = 3;
+        FDynamicEmitterDataBase* Slots[NumSlots] = {};
+        int32 Cursor = 0;
+    };
+
+    FParticleFrameStats DoSimulationWork(const TArray<FParticleEmitterInstance*>& Instances, FParticleSimulationContext& Context, TArray<FDynamicEmitterDataBase*>& OutRenderData);
+    static void GatherEmitterStats(FParticleEmitterInstance* Inst, FParticleFrameStats& OutStats);
+    FDynamicEmitterDataBase* SimulateEmitter(FParticleEmitterInstance* Inst, int32 EmitterIndex, FParticleSimulationContext& Context);
+    bool ConsumePendingResult();
     void InternalClearRenderData();
-    // 비동기 작업 핸들
-    std::future<FAsyncSimulationResult> TaskHandle;
-};
\ No newline at end of file
+    void FreeRenderDataPool();
+
+    // 이미터 인덱스별 렌더 페이로드 풀 (메인 스레드에서만 크기를 늘린다)
+    TArray<FEmitterRenderDataRing> RenderDataPool;
+
+    // Job이 참조하는 이번 작업의 입력/출력 (Job 완료 전까지 건드리지 않는다)
+    TArray<FParticleEmitterInstance*> PendingInstances;
+    FParticleSimulationContext PendingContext;
+    TArray<FDynamicEmitterDataBase*> PendingRenderData;
+    FParticleFrameStats PendingStats;
+    bool bHasPendingResult = false;
+
+    // KickOff에서 매 프레임 다시 쓰는 임시 배열 (용량 유지)
+    TArray<FJobHandle> EmitterJobHandles;
+    TArray<int32> ReceiverIndices;
+
+    // 이미터 Job들이 동시에 쓰는 EventData 보호용
+    std::unique_ptr<std::mutex> EventDataLock = std::make_unique<std::mutex>();
+
+    // 이 컴포넌트의 Job을 돌려 쓰는 풀 (복사본은 자기 풀을 새로 만든다)
+    FJobPool::FPtr JobPool = FJobPool::Create();
+
+    // 모든 이미터 Job 이후에 실행되는 Gather Job
+    FJobHandle CompletionHandle;
+};
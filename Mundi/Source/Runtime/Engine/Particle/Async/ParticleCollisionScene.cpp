@@ -0,0 +1,260 @@
+#include "pch.h"
+#include "ParticleCollisionScene.h"
+
+#include "BoxComponent.h"
+#include "BVHierarchy.h"
+#include "CapsuleComponent.h"
+#include "Collision.h"
+#include "PlatformTime.h"
+#include "SphereComponent.h"
+#include "World.h"
+#include "WorldPartitionManager.h"
+
+void FParticleColliderGrid::Build(TArray<FColliderProxy>&& InColliders, const FAABB& InBounds, float InCellSize)
+{
+    Colliders = std::move(InColliders);
+    Bounds = InBounds;
+    CellSize = FMath::Max(InCellSize, 1.0f);
+    InvCellSize = 1.0f / CellSize;
+    LooseMargin = CellSize * 0.5f;
+
+    BucketStart.Empty();
+    BucketItems.Empty();
+    OversizedColliders.Empty();
+    BucketMask = 0;
+
+    const int32 NumColliders = Colliders.Num();
+    if (NumColliders == 0) { return; }
+
+    // 1) 콜라이더별 셀 범위 (LooseMargin만큼 부풀린 AABB)
+    struct FCellRange { int32 Min[3]; int32 Max[3]; };
+    TArray<FCellRange> Ranges;
+    Ranges.SetNum(NumColliders);
+
+    const FVector Margin(LooseMargin, LooseMargin, LooseMargin);
+    int64 TotalRefs = 0;
+    for (int32 i = 0; i < NumColliders; ++i)
+    {
+        const FAABB ProxyBounds = ComputeProxyBounds(Colliders[i]);
+        const FVector Min = ProxyBounds.Min - Margin;
+        const FVector Max = ProxyBounds.Max + Margin;
+
+        FCellRange& Range = Ranges[i];
+        Range.Min[0] = ToCell(Min.X); Range.Min[1] = ToCell(Min.Y); Range.Min[2] = ToCell(Min.Z);
+        Range.Max[0] = ToCell(Max.X); Range.Max[1] = ToCell(Max.Y); Range.Max[2] = ToCell(Max.Z);
+
+        const int64 NumCells = static_cast<int64>(Range.Max[0] - Range.Min[0] + 1)
+            * (Range.Max[1] - Range.Min[1] + 1)
+            * (Range.Max[2] - Range.Min[2] + 1);
+        if (NumCells > MaxCellsPerCollider)
+        {
+            OversizedColliders.Add(i);
+            Range.Max[0] = Range.Min[0] - 1; // 빈 범위로 표시
+            continue;
+        }
+        TotalRefs += NumCells;
+    }
+
+    if (TotalRefs == 0) { return; }
+
+    // 2) 버킷 수 = 등록 수의 2배 이상인 2의 거듭제곱
+    uint32 NumBuckets = 16;
+    while (NumBuckets < static_cast<uint64>(TotalRefs) * 2)
+    {
+        NumBuckets <<= 1;
+    }
+    BucketMask = NumBuckets - 1;
+
+    // 3) Counting sort 형태로 CSR 구성 (Count → Prefix Sum → Fill)
+    BucketStart.SetNum(NumBuckets + 1);
+    std::fill(BucketStart.begin(), BucketStart.end(), 0u);
+
+    auto ForEachCell = [this, &Ranges](int32 ColliderIndex, auto&& Body)
+    {
+        const FCellRange& Range = Ranges[ColliderIndex];
+        for (int32 Z = Range.Min[2]; Z <= Range.Max[2]; ++Z)
+        for (int32 Y = Range.Min[1]; Y <= Range.Max[1]; ++Y)
+        for (int32 X = Range.Min[0]; X <= Range.Max[0]; ++X)
+        {
+            Body(HashCell(X, Y, Z));
+        }
+    };
+
+    for (int32 i = 0; i < NumColliders; ++i)
+    {
+        ForEachCell(i, [this](uint32 Bucket) { ++BucketStart[Bucket + 1]; });
+    }
+    for (uint32 b = 0; b < NumBuckets; ++b)
+    {
+        BucketStart[b + 1] += BucketStart[b];
+    }
+
+    BucketItems.SetNum(static_cast<int32>(TotalRefs));
+    TArray<uint32> Cursor(BucketStart.begin(), BucketStart.end() - 1);
+    for (int32 i = 0; i < NumColliders; ++i)
+    {
+        ForEachCell(i, [this, &Cursor, i](uint32 Bucket) { BucketItems[Cursor[Bucket]++] = i; });
+    }
+}
+
+FParticleColliderGrid::FCandidateScratch& FParticleColliderGrid::GetCandidateScratch()
+{
+    thread_local FCandidateScratch Scratch;
+    return Scratch;
+}
+
+uint32 FParticleColliderGrid::BeginCandidateQuery(FCandidateScratch& Scratch, int32 NumColliders)
+{
+    if (Scratch.Stamps.Num() < NumColliders)
+    {
+        Scratch.Stamps.SetNum(NumColliders, 0u);
+    }
+
+    // 번호가 한 바퀴 돌면 예전 스탬프와 겹치지 않게 한 번 지운다
+    if (++Scratch.Stamp == 0)
+    {
+        std::fill(Scratch.Stamps.begin(), Scratch.Stamps.end(), 0u);
+        Scratch.Stamp = 1;
+    }
+    return Scratch.Stamp;
+}
+
+FAABB FParticleColliderGrid::ComputeProxyBounds(const FColliderProxy& Proxy)
+{
+    switch (Proxy.Type)
+    {
+    case EShapeKind::Sphere:
+    {
+        const FVector R(Proxy.Sphere.Radius, Proxy.Sphere.Radius, Proxy.Sphere.Radius);
+        return FAABB(Proxy.Sphere.Center - R, Proxy.Sphere.Center + R);
+    }
+    case EShapeKind::Capsule:
+    {
+        const FVector R(Proxy.Capsule.Radius, Proxy.Capsule.Radius, Proxy.Capsule.Radius);
+        const FVector& A = Proxy.Capsule.PosA;
+        const FVector& B = Proxy.Capsule.PosB;
+        return FAABB(
+            FVector(FMath::Min(A.X, B.X), FMath::Min(A.Y, B.Y), FMath::Min(A.Z, B.Z)) - R,
+            FVector(FMath::Max(A.X, B.X), FMath::Max(A.Y, B.Y), FMath::Max(A.Z, B.Z)) + R);
+    }
+    case EShapeKind::Box:
+    default:
+    {
+        // OBB의 월드 AABB 반경 = 각 축 방향 HalfExtent 투영의 합
+        const FOBB& Box = Proxy.Box;
+        FVector Extent = FVector::Zero();
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const FVector Scaled = Box.Axes[Axis] * Box.HalfExtent[Axis];
+            Extent.X += FMath::Abs(Scaled.X);
+            Extent.Y += FMath::Abs(Scaled.Y);
+            Extent.Z += FMath::Abs(Scaled.Z);
+        }
+        return FAABB(Box.Center - Extent, Box.Center + Extent);
+    }
+    }
+}
+
+void FParticleCollisionScene::BeginFrame()
+{
+    // 지난 프레임에 요청된 영역은 이번 프레임 첫 빌드에 미리 포함시킨다 (컴포넌트마다 다시 빌드하지 않도록)
+    PreviousFrameRequests = CurrentFrameRequests;
+    bHasPreviousFrameRequests = bHasCurrentFrameRequests;
+    bHasCurrentFrameRequests = false;
+
+    CurrentGrid.reset();
+}
+
+std::shared_ptr<const FParticleColliderGrid> FParticleCollisionScene::AcquireGrid(const FAABB& QueryBounds)
+{
+    CurrentFrameRequests = bHasCurrentFrameRequests ? FAABB::Union(CurrentFrameRequests, QueryBounds) : QueryBounds;
+    bHasCurrentFrameRequests = true;
+
+    if (CurrentGrid && CurrentGrid->Bounds.Contains(QueryBounds))
+    {
+        return CurrentGrid->IsEmpty() ? nullptr : CurrentGrid;
+    }
+
+    TIME_PROFILE(Particle_BuildColliderGrid)
+
+    FAABB BuildBounds = CurrentFrameRequests;
+    if (bHasPreviousFrameRequests)
+    {
+        BuildBounds = FAABB::Union(BuildBounds, PreviousFrameRequests);
+    }
+
+    // 여유를 두고 넓혀서 같은 프레임의 나중 요청과 다음 프레임의 이동이 대부분 재빌드 없이 들어오게 한다
+    const FVector Extent = BuildBounds.Max - BuildBounds.Min;
+    const float MinSlack = CellSize * 2.0f;
+    const FVector Slack(
+        FMath::Max(Extent.X * BoundsSlack, MinSlack),
+        FMath::Max(Extent.Y * BoundsSlack, MinSlack),
+        FMath::Max(Extent.Z * BoundsSlack, MinSlack));
+    BuildBounds = FAABB(BuildBounds.Min - Slack, BuildBounds.Max + Slack);
+
+    TArray<FColliderProxy> Colliders;
+    CollectColliders(BuildBounds, Colliders);
+
+    auto Grid = std::make_shared<FParticleColliderGrid>();
+    Grid->Build(std::move(Colliders), BuildBounds, CellSize);
+
+    // 콜라이더가 하나도 없으면 nullptr로 (모듈이 바로 빠져나가도록), 빈 그리드는 영역 정보 때문에 보관
+    CurrentGrid = Grid;
+    return Grid->IsEmpty() ? nullptr : CurrentGrid;
+}
+
+void FParticleCollisionScene::CollectColliders(const FAABB& InBounds, TArray<FColliderProxy>& OutColliders) const
+{
+    if (!World || !World->GetPartitionManager()) { return; }
+
+    TArray<UPrimitiveComponent*> Candidates = World->GetPartitionManager()->GetBVH()->QueryIntersectedComponents(InBounds);
+    OutColliders.Reserve(Candidates.Num());
+
+    for (UPrimitiveComponent* Prim : Candidates)
+    {
+        UShapeComponent* ShapeComponent = Cast<UShapeComponent>(Prim);
+        if (!ShapeComponent) continue;
+
+        const FTransform& TF = ShapeComponent->GetWorldTransform();
+        FVector WorldLoc = TF.Translation;
+        FQuat WorldRot = TF.Rotation;
+        FVector Scale = TF.Scale3D;
+
+        FColliderProxy Proxy;
+        // [BOX]
+        if (UBoxComponent* BoxComp = Cast<UBoxComponent>(ShapeComponent))
+        {
+            Proxy.Type = EShapeKind::Box;
+            FShape Shape; BoxComp->GetShape(Shape);
+            FOBB OBB; Collision::BuildOBB(Shape, TF, OBB);
+            Proxy.Box = OBB;
+        }
+        // [SPHERE]
+        else if (USphereComponent* SphereComp = Cast<USphereComponent>(ShapeComponent))
+        {
+            Proxy.Type = EShapeKind::Sphere;
+            Proxy.Sphere.Center = WorldLoc;
+            // 가장 큰 축의 스케일을 적용
+            float MaxScale = Scale.GetMaxValue();
+            Proxy.Sphere.Radius = SphereComp->SphereRadius * MaxScale;
+        }
+        // [CAPSULE]
+        else if (UCapsuleComponent* CapsuleComp = Cast<UCapsuleComponent>(ShapeComponent))
+        {
+            Proxy.Type = EShapeKind::Capsule;
+            float UnscaledRadius = CapsuleComp->CapsuleRadius;
+            float ScaledRadius = UnscaledRadius * FMath::Max(FMath::Abs(Scale.X), FMath::Abs(Scale.Y));
+            float UnscaledHalfHeight = CapsuleComp->CapsuleHalfHeight;
+            float ScaledHalfHeight = UnscaledHalfHeight * FMath::Abs(Scale.Z);
+
+            float CylHalfHeight = FMath::Max(0.0f, ScaledHalfHeight - ScaledRadius);
+
+            FVector UpAxis = WorldRot.RotateVector(FVector{0, 0, 1});
+            Proxy.Capsule.Radius = ScaledRadius;
+            Proxy.Capsule.PosA = WorldLoc - (UpAxis * CylHalfHeight);
+            Proxy.Capsule.PosB = WorldLoc + (UpAxis * CylHalfHeight);
+        }
+
+        OutColliders.Add(Proxy);
+    }
+}
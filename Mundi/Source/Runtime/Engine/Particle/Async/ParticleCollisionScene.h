@@ -0,0 +1,143 @@
+﻿#pragma once
+#include <memory>
+#include "AABB.h"
+#include "ParticleSimulationContext.h"
+
+class UWorld;
+
+/**
+ * 파티클 충돌용 콜라이더 Spatial Hash (Loose Uniform Grid)
+ * - 콜라이더 AABB를 LooseMargin만큼 부풀려 겹치는 셀 모두에 등록한다
+ * - 반지름이 LooseMargin 이하인 파티클은 자기 위치의 셀 하나만 보면 된다 (대부분의 파티클)
+ * - 셀 → 버킷은 해시로 접기 때문에 다른 셀의 콜라이더가 섞일 수 있지만 후보가 늘 뿐 결과는 같다
+ * - 빌드 후에는 읽기 전용이라 여러 이미터 Job이 동시에 조회해도 된다
+ */
+struct FParticleColliderGrid
+{
+    /** 이보다 많은 셀에 걸치는 큰 콜라이더(바닥 등)는 셀에 넣지 않고 항상 검사 */
+    static constexpr int32 MaxCellsPerCollider = 512;
+
+    /** 이 그리드를 만들 때 BVH에서 콜라이더를 모은 영역 */
+    FAABB Bounds;
+    float CellSize = 200.0f;
+    float InvCellSize = 1.0f / 200.0f;
+    float LooseMargin = 100.0f;
+
+    TArray<FColliderProxy> Colliders;
+    /** 버킷 b의 콜라이더 = BucketItems[BucketStart[b] .. BucketStart[b + 1]) */
+    TArray<uint32> BucketStart;
+    TArray<int32> BucketItems;
+    uint32 BucketMask = 0;
+    TArray<int32> OversizedColliders;
+
+    void Build(TArray<FColliderProxy>&& InColliders, const FAABB& InBounds, float InCellSize);
+
+    bool IsEmpty() const { return Colliders.IsEmpty(); }
+
+    /** Position 반경 Radius 안에 있을 수 있는 콜라이더마다 Func(const FColliderProxy&) 호출 */
+    template<typename Func>
+    void ForEachCandidate(const FVector& Position, float Radius, Func&& InFunc) const;
+
+    static FAABB ComputeProxyBounds(const FColliderProxy& Proxy);
+
+private:
+    /**
+     * 큰 파티클 조회의 중복 제거용 스레드별 스탬프 배열 (콜라이더 인덱스 → 마지막으로 본 조회 번호)
+     * 조회마다 번호만 올리므로 지우거나 할당하지 않는다 (콜라이더 수가 늘 때만 커진다)
+     */
+    struct FCandidateScratch
+    {
+        TArray<uint32> Stamps;
+        uint32 Stamp = 0;
+    };
+    static FCandidateScratch& GetCandidateScratch();
+    /** 이번 조회의 스탬프 번호 (필요하면 Stamps를 NumColliders까지 늘림) */
+    static uint32 BeginCandidateQuery(FCandidateScratch& Scratch, int32 NumColliders);
+
+    int32 ToCell(float Value) const { return static_cast<int32>(std::floor(Value * InvCellSize)); }
+    uint32 HashCell(int32 X, int32 Y, int32 Z) const
+    {
+        return ((static_cast<uint32>(X) * 73856093u) ^ (static_cast<uint32>(Y) * 19349663u) ^ (static_cast<uint32>(Z) * 83492791u)) & BucketMask;
+    }
+};
+
+template<typename Func>
+void FParticleColliderGrid::ForEachCandidate(const FVector& Position, float Radius, Func&& InFunc) const
+{
+    for (int32 Index : OversizedColliders)
+    {
+        InFunc(Colliders[Index]);
+    }
+
+    if (BucketStart.IsEmpty()) { return; }
+
+    if (Radius <= LooseMargin)
+    {
+        const uint32 Bucket = HashCell(ToCell(Position.X), ToCell(Position.Y), ToCell(Position.Z));
+        for (uint32 i = BucketStart[Bucket]; i < BucketStart[Bucket + 1]; ++i)
+        {
+            InFunc(Colliders[BucketItems[i]]);
+        }
+        return;
+    }
+
+    // 큰 파티클: 겹치는 셀을 모두 보고, 여러 셀에 등록된 콜라이더는 한 번만 넘긴다
+    FCandidateScratch& Scratch = GetCandidateScratch();
+    const uint32 Stamp = BeginCandidateQuery(Scratch, Colliders.Num());
+    uint32* Stamps = Scratch.Stamps.GetData();
+    const int32 MinX = ToCell(Position.X - Radius), MaxX = ToCell(Position.X + Radius);
+    const int32 MinY = ToCell(Position.Y - Radius), MaxY = ToCell(Position.Y + Radius);
+    const int32 MinZ = ToCell(Position.Z - Radius), MaxZ = ToCell(Position.Z + Radius);
+    for (int32 Z = MinZ; Z <= MaxZ; ++Z)
+    for (int32 Y = MinY; Y <= MaxY; ++Y)
+    for (int32 X = MinX; X <= MaxX; ++X)
+    {
+        const uint32 Bucket = HashCell(X, Y, Z);
+        for (uint32 i = BucketStart[Bucket]; i < BucketStart[Bucket + 1]; ++i)
+        {
+            const int32 Index = BucketItems[i];
+            if (Stamps[Index] != Stamp)
+            {
+                Stamps[Index] = Stamp;
+                InFunc(Colliders[Index]);
+            }
+        }
+    }
+}
+
+/**
+ * 월드 하나의 파티클 충돌 씬 (UWorld 소유)
+ * - 프레임마다 첫 요청에서 콜라이더 Proxy + Grid를 한 번 만들고 같은 월드의 모든 파티클 컴포넌트가 공유
+ * - 빌드 영역은 이번 프레임 요청 박스 + 지난 프레임 요청 박스들의 합집합에 여유(BoundsSlack)를 더한 것
+ *   (움직이는 이미터가 조금씩 벗어날 때마다 다시 빌드하지 않도록, 여유까지 벗어나면 그때만 다시 빌드)
+ * - Grid는 shared_ptr라 다음 프레임에 교체돼도 아직 돌고 있는 Job은 이전 Grid를 계속 본다
+ */
+class FParticleCollisionScene
+{
+public:
+    explicit FParticleCollisionScene(UWorld* InWorld) : World(InWorld) {}
+
+    /** UWorld::Tick 시작 시 호출 */
+    void BeginFrame();
+
+    /** QueryBounds를 덮는 이번 프레임 그리드 (충돌체가 없으면 nullptr) */
+    std::shared_ptr<const FParticleColliderGrid> AcquireGrid(const FAABB& QueryBounds);
+
+    /** 셀 크기 (파티클 크기보다 충분히 크고 콜라이더 간격보다 작을 때 효율이 좋다) */
+    float CellSize = 200.0f;
+    /** 빌드 영역을 각 축 크기의 이 비율만큼 (최소 셀 2개) 넓힌다 */
+    float BoundsSlack = 0.25f;
+
+private:
+    void CollectColliders(const FAABB& InBounds, TArray<FColliderProxy>& OutColliders) const;
+
+    UWorld* World = nullptr;
+
+    /** 이번 프레임에 마지막으로 빌드한 그리드 (콜라이더가 없어도 영역 확인용으로 보관) */
+    std::shared_ptr<const FParticleColliderGrid> CurrentGrid;
+
+    FAABB CurrentFrameRequests;
+    bool bHasCurrentFrameRequests = false;
+    FAABB PreviousFrameRequests;
+    bool bHasPreviousFrameRequests = false;
+};
@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include <memory>
+#include <mutex>
 #include "DamageTypes.h"
 #include "OBB.h"
 #include "ShapeComponent.h"
@@ -32,6 +34,8 @@ struct FColliderProxy
     }
 };
 
+struct FParticleColliderGrid;
+
 struct FParticleEventData
 {
     FName EventName;
@@ -60,6 +64,22 @@ struct FParticleSimulationContext
     int32 CurrentLODIndex;
 
     // 충돌 정보
-    TArray<FColliderProxy> WorldColliders; // 이번 프레임 월드에 있는 충돌체 정보
+    std::shared_ptr<const FParticleColliderGrid> ColliderGrid; // 이번 프레임 월드 충돌체 Grid (월드의 모든 파티클 컴포넌트가 공유)
     TArray<FParticleEventData> EventData; // 이번 프레임 발생한 이벤트 정보들
+
+    // 이미터 Job들이 동시에 이벤트를 쓰므로 EventData 추가는 이 락을 거친다 (FParticleAsyncUpdater 소유)
+    std::mutex* EventDataLock = nullptr;
+
+    void AddEventData(const FParticleEventData& InEventData)
+    {
+        if (EventDataLock)
+        {
+            std::lock_guard<std::mutex> Guard(*EventDataLock);
+            EventData.Add(InEventData);
+        }
+        else
+        {
+            EventData.Add(InEventData);
+        }
+    }
 };
@@ -3,6 +3,7 @@
 #include "ParticleDataContainer.h"
 #include "ParticleHelper.h"
 #include "Modules/ParticleModuleRequired.h"
+#include "ParticleSort.h"
 
 struct FDynamicEmitterReplayDataBase
 {
@@ -129,12 +130,19 @@ struct FDynamicTranslucentEmitterDataBase : public FDynamicEmitterDataBase
     }
     
     TArray<float> CachedSortKeys;
+    /** 마지막 SortParticles에서 사용한 알고리즘 */
+    EParticleSortAlgorithm SortAlgorithm = EParticleSortAlgorithm::None;
 
     virtual const FDynamicEmitterReplayDataBase* GetSource() const = 0;
 
-    void SortParticles(const FVector& ViewOrigin, const FVector& ViewDir, const FMatrix& WorldMatrix, TArray<int32>& OutIndices)
+    /**
+     * @param PreviousOrder 지난 프레임 정렬 결과 (이전 순서와 비슷하면 삽입 정렬로 빠르게 끝난다)
+     */
+    void SortParticles(const FVector& ViewOrigin, const FVector& ViewDir, const FMatrix& WorldMatrix,
+        const TArray<int32>& PreviousOrder, TArray<int32>& OutIndices)
     {
-        
+        SortAlgorithm = EParticleSortAlgorithm::None;
+
         const FDynamicEmitterReplayDataBase* Source = GetSource();
         if (!Source)
         {
@@ -149,12 +157,6 @@ struct FDynamicTranslucentEmitterDataBase : public FDynamicEmitterDataBase
             return;
         }
 
-        OutIndices.SetNum(NumParticles);
-        for (int32 Index = 0; Index < NumParticles; ++Index)
-        {
-            OutIndices[Index] = Index;
-        }
-
         if (CachedSortKeys.Num() < NumParticles)
         {
             CachedSortKeys.SetNum(NumParticles);
@@ -199,11 +201,8 @@ struct FDynamicTranslucentEmitterDataBase : public FDynamicEmitterDataBase
             }
         }
 
-        // 5) Back-to-front (큰 키가 먼저)
-        OutIndices.Sort([this](int32 A, int32 B)
-            {
-                return CachedSortKeys[A] > CachedSortKeys[B];
-            });
+        // 5) Back-to-front (큰 키가 먼저). 개수/이전 순서에 따라 삽입 정렬 또는 Radix Sort
+        SortAlgorithm = ParticleSort::SortDescending(CachedSortKeys.GetData(), NumParticles, PreviousOrder, OutIndices);
     }
 };
 
@@ -4,6 +4,7 @@
 // Forward declarations
 struct FParticleEmitterInstance;
 struct FBaseParticle;
+struct FParticleSoAData;
 
 // Distribution 타입들 - 파티클 파라미터의 랜덤/커브 값을 표현
 template<typename T>
@@ -96,6 +97,9 @@ public:
         Update(Owner, Offset, Context.DeltaTime);
     }
 
+    // SoA 레이아웃 이미터용 업데이트. SIMD 커널을 가진 모듈만 오버라이딩하고 true를 반환
+    // false를 반환하면 이미터가 AoS로 동기화한 뒤 UpdateAsync를 대신 호출한다
+    virtual bool UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& SoA, FParticleSimulationContext& Context) { return false; }
     
 
 public:
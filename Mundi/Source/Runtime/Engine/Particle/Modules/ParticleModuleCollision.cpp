@@ -3,6 +3,7 @@
 
 #include "Source/Runtime/Engine/Particle/ParticleEmitterInstance.h"
 #include "Source/Runtime/Engine/Particle/ParticleHelper.h"
+#include "Source/Runtime/Engine/Particle/Async/ParticleCollisionScene.h"
 
 IMPLEMENT_CLASS(UParticleModuleCollision)
 
@@ -16,9 +17,9 @@ UParticleModuleCollision::UParticleModuleCollision()
 
 void UParticleModuleCollision::UpdateAsync(FParticleEmitterInstance* Owner, int32 Offset, FParticleSimulationContext& Context)
 {
-    if (!bEnabled || !Owner || Context.WorldColliders.IsEmpty()) { return; }
+    if (!bEnabled || !Owner || !Context.ColliderGrid) { return; }
 
-    const TArray<FColliderProxy>& Colliders = Context.WorldColliders;
+    const FParticleColliderGrid& Grid = *Context.ColliderGrid;
 
     BEGIN_UPDATE_LOOP
     {
@@ -27,7 +28,8 @@ void UParticleModuleCollision::UpdateAsync(FParticleEmitterInstance* Owner, int3
 
         FHitResult BestHit;
         BestHit.PenetrationDepth = -1.0f;
-        for (const FColliderProxy& Proxy : Colliders)
+        // 파티클이 있는 셀의 콜라이더만 검사
+        Grid.ForEachCandidate(Particle.Location, ParticleRadius, [&](const FColliderProxy& Proxy)
         {
             FHitResult TempHit;
             if (Collision::ComputeSphereToShapePenetration(Particle.Location, ParticleRadius, Proxy, TempHit))
@@ -37,7 +39,7 @@ void UParticleModuleCollision::UpdateAsync(FParticleEmitterInstance* Owner, int3
                     BestHit = TempHit;
                 }
             }
-        }
+        });
 
         // 충돌 반응
         if (BestHit.bHit)
@@ -87,7 +89,7 @@ void UParticleModuleCollision::UpdateAsync(FParticleEmitterInstance* Owner, int3
                 FParticleEventData NewEventData;
                 NewEventData.EventName = EventName;
                 NewEventData.HitResult = BestHit;
-                Context.EventData.Add(NewEventData);
+                Context.AddEventData(NewEventData);
             }
         }
     }
@@ -2,6 +2,7 @@
 #include "ParticleModuleColorOverLife.h"
 #include "../ParticleEmitter.h"
 #include "../ParticleHelper.h"
+#include "../ParticleSoA.h"
 
 IMPLEMENT_CLASS(UParticleModuleColorOverLife)
 
@@ -69,3 +70,23 @@ void UParticleModuleColorOverLife::Update(FParticleEmitterInstance* Owner, int32
     }
     END_UPDATE_LOOP;
 }
+
+bool UParticleModuleColorOverLife::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& SoA, FParticleSimulationContext& Context)
+{
+    const int32 Num = Owner->ActiveParticles;
+    if (Num <= 0)
+    {
+        return true;
+    }
+
+    if (bUseColorOverLife)
+    {
+        ParticleSoAKernels::ColorOverLife(SoA, Num, ColorOverLife.MinValue, ColorOverLife.MaxValue, ColorOverLife.bUseRange);
+    }
+
+    if (bUseAlphaOverLife)
+    {
+        ParticleSoAKernels::AlphaOverLife(SoA, Num, AlphaPoint1Time, AlphaPoint1Value, AlphaPoint2Time, AlphaPoint2Value);
+    }
+    return true;
+}
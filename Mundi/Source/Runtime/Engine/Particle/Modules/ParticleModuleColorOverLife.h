@@ -32,6 +32,7 @@ public:
 
     // Update에서 RelativeTime(0~1)에 따라 Color와 Alpha 재계산
     virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+    bool UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& SoA, FParticleSimulationContext& Context) override;
 
 private:
     // Alpha 커브 평가 (0~1 범위)
@@ -41,7 +41,7 @@ void UParticleModuleLifetime::Update(FParticleEmitterInstance* Owner, int32 Offs
     // RelativeTime 업데이트와 파티클 제거는 ParticleEmitter::Tick()의
     // 메인 루프에서 자동으로 처리됨:
     //   - Particle->RelativeTime += Particle->OneOverMaxLifetime * DeltaTime;
-    //   - if (Particle->RelativeTime >= 1.0f) KillParticle(i);
+    //   - if (Particle->RelativeTime >= 1.0f) MarkParticleDead(i);  → 루프 후 CompactDeadParticles()
     //
     // 따라서 이 함수는 비어있어도 정상 동작함
 }
@@ -32,6 +32,10 @@ public:
     // ---- 공간 규칙 ----
     bool bUseLocalSpace    = false;
 
+    // ---- 시뮬레이션 레이아웃 ----
+    // true면 위치/속도/크기/색/수명을 SoA 스트림에서 SIMD로 갱신 (Sprite/Mesh 전용)
+    bool bUseSoALayout     = false;
+
     // ---- 렌더 기본 ----
     UMaterialInterface* Material = nullptr;  // UMaterial 또는 UMaterialInstanceDynamic
 
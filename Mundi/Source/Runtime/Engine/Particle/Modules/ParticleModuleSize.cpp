@@ -2,6 +2,7 @@
 #include "ParticleModuleSize.h"
 #include "../ParticleEmitter.h"
 #include "../ParticleHelper.h"
+#include "../ParticleSoA.h"
 #include "Source/Runtime/Engine/Particle/ParticleEmitterInstance.h"
 
 IMPLEMENT_CLASS(UParticleModuleSize)
@@ -53,3 +54,13 @@ void UParticleModuleSize::Update(FParticleEmitterInstance* Owner, int32 Offset,
     }
     END_UPDATE_LOOP;
 }
+
+bool UParticleModuleSize::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& SoA, FParticleSimulationContext& Context)
+{
+    if (bUseSizeOverLife && Owner->ActiveParticles > 0)
+    {
+        ParticleSoAKernels::SizeOverLife(SoA, Owner->ActiveParticles, SizeOverLife.MinValue, SizeOverLife.MaxValue,
+            SizeOverLife.bUseRange, bUniformSize);
+    }
+    return true;
+}
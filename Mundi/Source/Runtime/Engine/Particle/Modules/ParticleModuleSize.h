@@ -25,4 +25,5 @@ public:
 
     virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
     virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+    bool UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& SoA, FParticleSimulationContext& Context) override;
 };
@@ -2,6 +2,7 @@
 #include "ParticleModuleSizeMultiplyLife.h"
 #include "../ParticleEmitter.h"
 #include "../ParticleHelper.h"
+#include "../ParticleSoA.h"
 
 IMPLEMENT_CLASS(UParticleModuleSizeMultiplyLife)
 
@@ -65,3 +66,14 @@ void UParticleModuleSizeMultiplyLife::Update(FParticleEmitterInstance* Owner, in
     }
     END_UPDATE_LOOP;
 }
+
+bool UParticleModuleSizeMultiplyLife::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& SoA, FParticleSimulationContext& Context)
+{
+    const int32 Num = Owner->ActiveParticles;
+    if (Num > 0)
+    {
+        ParticleSoAKernels::SizeMultiplyLife(SoA, Num, Point1Time, Point1Value, Point2Time, Point2Value,
+            bMultiplyX, bMultiplyY, bMultiplyZ);
+    }
+    return true;
+}
@@ -30,6 +30,7 @@ public:
 
     // Update에서 BaseSize에 Curve(t)를 곱해서 Size 애니메이션
     virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+    bool UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& SoA, FParticleSimulationContext& Context) override;
 
 private:
     // t (0~1)에 따라 3개 키프레임 사이를 선형 보간
@@ -3,6 +3,7 @@
 #include "ParticleModuleRequired.h"
 #include "../ParticleEmitter.h"
 #include "../ParticleHelper.h"
+#include "../ParticleSoA.h"
 #include "Source/Runtime/Engine/Particle/ParticleEmitterInstance.h"
 
 IMPLEMENT_CLASS(UParticleModuleVelocity)
@@ -62,3 +63,12 @@ void UParticleModuleVelocity::Update(FParticleEmitterInstance* Owner, int32 Offs
     }
     END_UPDATE_LOOP;
 }
+
+bool UParticleModuleVelocity::UpdateSoA(FParticleEmitterInstance* Owner, FParticleSoAData& SoA, FParticleSimulationContext& Context)
+{
+    if (Owner->ActiveParticles > 0)
+    {
+        ParticleSoAKernels::ApplyVelocity(SoA, Owner->ActiveParticles, Gravity, Damping, Context.DeltaTime);
+    }
+    return true;
+}
@@ -0,0 +1,86 @@
+﻿#include "pch.h"
+#include "ParticleBenchmark.h"
+#include "ParticleEmitter.h"
+#include "ParticleEmitterInstance.h"
+#include "ParticleHelper.h"
+#include "ParticleLODLevel.h"
+#include "PlatformTime.h"
+#include "Modules/ParticleModuleRequired.h"
+#include "Modules/ParticleModuleSpawn.h"
+#include "Modules/ParticleModuleLifetime.h"
+#include "Modules/ParticleModuleColorOverLife.h"
+#include "Modules/ParticleModuleSizeMultiplyLife.h"
+
+void FParticleBenchmark::RunLayoutBenchmark(int32 NumParticles, int32 NumFrames)
+{
+    UE_LOG("[ParticleBenchmark] %d particles x %d frames", NumParticles, NumFrames);
+
+    const double AoSNs = MeasureLayout(false, NumParticles, NumFrames);
+    const double SoANs = MeasureLayout(true, NumParticles, NumFrames);
+
+    UE_LOG("[ParticleBenchmark] AoS : %.2f ns/particle", AoSNs);
+    UE_LOG("[ParticleBenchmark] SoA : %.2f ns/particle (x%.2f)", SoANs, SoANs > 0.0 ? AoSNs / SoANs : 0.0);
+}
+
+double FParticleBenchmark::MeasureLayout(bool bUseSoALayout, int32 NumParticles, int32 NumFrames)
+{
+    // 기본 LOD(Required, Spawn, Lifetime, Size, Velocity)에 수명 기반 업데이트 모듈 추가
+    UParticleEmitter* Emitter = NewObject<UParticleEmitter>();
+    UParticleLODLevel* LOD = Emitter->LODLevels[0];
+    LOD->AddModule(UParticleModuleColorOverLife::StaticClass());
+    LOD->AddModule(UParticleModuleSizeMultiplyLife::StaticClass());
+
+    LOD->RequiredModule->MaxParticles = NumParticles;
+    LOD->RequiredModule->bUseSoALayout = bUseSoALayout;
+    LOD->SpawnModule->SpawnRate = FRawDistributionFloat(0.0f); // 스폰은 아래에서 직접 채운다
+    for (UParticleModule* Module : LOD->SpawnModules)
+    {
+        if (auto* Lifetime = Cast<UParticleModuleLifetime>(Module))
+        {
+            // 매 프레임 일부가 죽도록 짧은 수명 범위 사용 (Kill 경로도 측정에 포함)
+            Lifetime->Lifetime = FRawDistributionFloat(0.5f, 2.0f);
+        }
+    }
+    Emitter->CacheEmitterModuleInfo();
+
+    FParticleEmitterInstance Instance;
+    Instance.Init(Emitter, nullptr);
+    Instance.InitRandom(1234);
+
+    FParticleSimulationContext Context{};
+    Context.DeltaTime = 1.0f / 60.0f;
+    Context.ComponentLocation = FVector::Zero();
+    Context.ComponentRotation = FQuat::Identity();
+    Context.ComponentScale = FVector::One();
+    Context.ComponentWorldMatrix = FMatrix::Identity();
+    Context.bIsActive = true;
+    Context.bSuppressSpawning = true;
+
+    uint64 TotalCycles = 0;
+    uint64 TotalParticleUpdates = 0;
+
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        // 죽은 만큼 다시 채워서 항상 NumParticles개를 갱신
+        const int32 Missing = Instance.MaxActiveParticles - Instance.ActiveParticles;
+        if (Missing > 0)
+        {
+            Instance.SpawnParticles(Missing, 0.0f, 0.0f, FVector::Zero(), FVector::Zero(), Context);
+        }
+
+        TotalParticleUpdates += Instance.ActiveParticles;
+        const uint64 Start = FPlatformTime::Cycles64();
+        Instance.Tick(Context);
+        TotalCycles += FPlatformTime::Cycles64() - Start;
+    }
+
+    Instance.FreeParticleMemory();
+    ObjectFactory::DeleteObject(Emitter);
+
+    if (TotalParticleUpdates == 0)
+    {
+        return 0.0;
+    }
+    const double TotalNs = FPlatformTime::ToMilliseconds(TotalCycles) * 1000000.0;
+    return TotalNs / static_cast<double>(TotalParticleUpdates);
+}
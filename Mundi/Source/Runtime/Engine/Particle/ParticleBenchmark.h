@@ -0,0 +1,19 @@
+﻿#pragma once
+
+/**
+ * 파티클 시뮬레이션 헤드리스 벤치마크 (콘솔: BENCH PARTICLE)
+ * 렌더링/컴포넌트 없이 이미터 인스턴스만 만들어 Tick 비용을 잰다
+ */
+class FParticleBenchmark
+{
+public:
+    /**
+     * 코어 모듈(Lifetime, Size, Velocity, ColorOverLife, SizeMultiplyLife)만 가진 이미터로
+     * NumParticles개를 NumFrames 동안 Tick하고 AoS/SoA 레이아웃별 ns/particle을 로그로 출력
+     */
+    static void RunLayoutBenchmark(int32 NumParticles = 100000, int32 NumFrames = 120);
+
+private:
+    /** @return 파티클 하나를 한 프레임 갱신하는 데 걸린 평균 시간 (ns) */
+    static double MeasureLayout(bool bUseSoALayout, int32 NumParticles, int32 NumFrames);
+};
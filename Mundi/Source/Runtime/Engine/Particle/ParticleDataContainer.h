@@ -5,6 +5,7 @@ FORCEINLINE uint32 AlignUp(uint32 Value, uint32 Alignment)
 }
 
 // 렌더 스레드에서만 쓰는 단일 메모리 블록
+// 렌더 페이로드가 풀에서 재사용되므로 블록은 커지기만 하고 매 프레임 다시 할당하지 않는다
 struct FParticleDataContainer
 {
     int32 MemBlockSize = 0;
@@ -15,22 +16,34 @@ struct FParticleDataContainer
     uint8* ParticleData = nullptr; // 힙에 할당한 메모리 블록을 가리킨다.
     uint16* ParticleIndices = nullptr; // not allocated, this is at the end of the memory block
 
-    void Allocate(int32 InParticleBytes, int32 InIndexCount)
+    /**
+     * 필요한 크기만큼 블록을 확보 (기존 블록이 충분하면 재사용)
+     * @return 새로 힙 할당을 했으면 true
+     */
+    bool Allocate(int32 InParticleBytes, int32 InIndexCount)
     {
-        Free();
-
         constexpr uint32 Alignment = 16;
         const uint32 ParticleSection = AlignUp(InParticleBytes, Alignment);
         const uint32 IndexSection = AlignUp(InIndexCount * sizeof(uint16), Alignment);
+        const int32 RequiredSize = static_cast<int32>(ParticleSection + IndexSection);
+
+        bool bAllocated = false;
+        if (!RawBlock || MemBlockSize < RequiredSize)
+        {
+            Free();
 
-        MemBlockSize = ParticleSection + IndexSection;
+            // 파티클 수가 조금씩 늘 때마다 재할당하지 않도록 여유를 둔다
+            MemBlockSize = static_cast<int32>(AlignUp(static_cast<uint32>(RequiredSize + RequiredSize / 2), Alignment));
+            RawBlock = static_cast<uint8*>(FMemoryManager::Allocate(MemBlockSize, Alignment));
+            bAllocated = true;
+        }
 
-        RawBlock = static_cast<uint8*>(FMemoryManager::Allocate(MemBlockSize, Alignment));
         ParticleDataNumBytes = InParticleBytes;
         ParticleIndicesNumShorts = static_cast<int32>(InIndexCount);
 
         ParticleData = RawBlock; // 앞부분
         ParticleIndices = reinterpret_cast<uint16*>(RawBlock + ParticleSection);
+        return bAllocated;
     }
 
     void Free()
@@ -10,6 +10,7 @@
 #include "Modules/ParticleModuleMesh.h"
 #include "Modules/ParticleModuleBeam.h"
 #include "Modules/ParticleModuleRibbon.h"
+#include <bit>
 
 void FParticleEmitterInstance::Init(UParticleEmitter* InTemplate, UParticleSystemComponent* InComponent)
 {
@@ -103,6 +104,19 @@ void FParticleEmitterInstance::InitializeParticleMemory()
         InstanceData = static_cast<uint8*>(FMemoryManager::Allocate(InstancePayloadSize, Alignment));
     }
 
+    // SoA 스트림 (Beam/Ribbon은 Payload와 링크를 AoS에서 직접 다루므로 제외)
+    const EParticleType Type = Template ? Template->RenderType : EParticleType::Sprite;
+    bUseSoALayout = CachedRequiredModule && CachedRequiredModule->bUseSoALayout
+        && (Type == EParticleType::Sprite || Type == EParticleType::Mesh);
+    if (bUseSoALayout)
+    {
+        SoAData.Allocate(MaxActiveParticles);
+    }
+
+    // 일괄 Kill용 비트마스크 (항상 전부 0인 상태를 유지, 압축이 끝나면 다시 비운다)
+    DeadMask.Empty();
+    DeadMask.SetNum((MaxActiveParticles + 63) >> 6);
+
     ActiveParticles = 0;
     ParticleCounter = 0;
 }
@@ -129,6 +143,10 @@ void FParticleEmitterInstance::FreeParticleMemory()
         InstanceData = nullptr;
     }
 
+    SoAData.Free();
+    DeadMask.Empty();
+    CompactionRemap.Empty();
+
     ActiveParticles = 0;
     MaxActiveParticles = 0;  // ← 여기서 리셋됨!
 }
@@ -145,6 +163,7 @@ void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, floa
         return;
     }
 
+    const int32 FirstSpawnedIndex = ActiveParticles;
     UParticleModuleRequired* Required = CurrentLODLevel->RequiredModule;
     for (int32 NowSpawnIdx = 0; NowSpawnIdx < Count; NowSpawnIdx++)
     {
@@ -279,6 +298,12 @@ void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, floa
         ActiveParticles++;
         ParticleCounter++;
     }
+
+    // Spawn 모듈은 AoS에 쓰므로 새로 태어난 구간만 SoA로 가져온다
+    if (bUseSoALayout && FirstSpawnedIndex < ActiveParticles)
+    {
+        SoAData.LoadFromAoS(ParticleData, ParticleStride, FirstSpawnedIndex, ActiveParticles);
+    }
 }
 
 void FParticleEmitterInstance::KillParticle(int32 Index)
@@ -290,6 +315,9 @@ void FParticleEmitterInstance::KillParticle(int32 Index)
         DetachRibbonParticle(Index);
     }
 
+    // 단일 Kill은 인덱스를 뒤섞으므로 지난 정렬 순서는 버린다 (Tick 경로는 CompactDeadParticles에서 재매핑)
+    LastSortedIndices.Empty();
+
     // 1. 마지막 파티클의 인덱스 (ActiveParticles - 1)
     int32 LastIndex = ActiveParticles - 1;
 
@@ -301,6 +329,11 @@ void FParticleEmitterInstance::KillParticle(int32 Index)
         DECLARE_PARTICLE_PTR(Src, ParticleData, ParticleStride, LastIndex)
         memcpy(Dest, Src, ParticleStride);
 
+        if (bUseSoALayout)
+        {
+            SoAData.Move(LastIndex, Index);
+        }
+
         if (bHasRibbonTrails)
         {
             RemapRibbonParticleIndex(LastIndex, Index);
@@ -310,6 +343,109 @@ void FParticleEmitterInstance::KillParticle(int32 Index)
     ActiveParticles--;
 }
 
+namespace
+{
+    // Mask에서 [Start, End) 구간 중 비트 값이 bSet인 첫 인덱스 (없으면 End)
+    int32 FindNextMaskBit(const uint64* Mask, int32 Start, int32 End, bool bSet)
+    {
+        int32 Word = Start >> 6;
+        uint64 Bits = bSet ? Mask[Word] : ~Mask[Word];
+        Bits &= ~0ull << (Start & 63);
+
+        const int32 LastWord = (End - 1) >> 6;
+        while (Bits == 0)
+        {
+            if (++Word > LastWord) { return End; }
+            Bits = bSet ? Mask[Word] : ~Mask[Word];
+        }
+
+        const int32 Found = (Word << 6) + std::countr_zero(Bits);
+        return (Found < End) ? Found : End;
+    }
+}
+
+int32 FParticleEmitterInstance::CompactDeadParticles()
+{
+    const int32 Num = ActiveParticles;
+    if (Num <= 0) { return 0; }
+
+    const int32 NumWords = (Num + 63) >> 6;
+    uint64* Mask = DeadMask.GetData();
+
+    int32 NumDead = 0;
+    for (int32 Word = 0; Word < NumWords; ++Word)
+    {
+        NumDead += std::popcount(Mask[Word]);
+    }
+    if (NumDead == 0) { return 0; }
+
+    // 지난 프레임 정렬 순서가 있으면 그것도 새 인덱스로 옮겨야 다음 정렬의 시작 순서가 유지된다
+    const bool bRemapSortOrder = !LastSortedIndices.IsEmpty();
+    if (bHasRibbonTrails || bRemapSortOrder)
+    {
+        // 워드별 popcount의 prefix sum = 각 워드 앞까지 살아남은 수 → 워드 안에서는 비트 순서대로 번호를 매긴다
+        CompactionRemap.SetNum(Num);
+        int32 AliveBefore = 0;
+        for (int32 Word = 0; Word < NumWords; ++Word)
+        {
+            const int32 Begin = Word << 6;
+            const int32 End = FMath::Min(Begin + 64, Num);
+            const uint64 Dead = Mask[Word];
+            for (int32 i = Begin; i < End; ++i)
+            {
+                CompactionRemap[i] = ((Dead >> (i - Begin)) & 1ull) ? INDEX_NONE : AliveBefore++;
+            }
+        }
+
+        // 링크는 죽은 파티클의 NextIndex를 따라가야 하므로 메모리를 옮기기 전에 고친다
+        if (bHasRibbonTrails)
+        {
+            RemapRibbonLinksForCompaction();
+        }
+
+        // 죽은 파티클은 빼고 살아남은 파티클은 새 인덱스로 (상대 순서는 그대로)
+        if (bRemapSortOrder)
+        {
+            int32 Write = 0;
+            for (int32 OldIndex : LastSortedIndices)
+            {
+                if (OldIndex >= 0 && OldIndex < Num && CompactionRemap[OldIndex] != INDEX_NONE)
+                {
+                    LastSortedIndices[Write++] = CompactionRemap[OldIndex];
+                }
+            }
+            LastSortedIndices.SetNum(Write);
+        }
+    }
+
+    // 살아남은 연속 구간 단위로 앞으로 당긴다 (첫 번째 죽은 자리 이전은 그대로)
+    int32 Dest = FindNextMaskBit(Mask, 0, Num, true);
+    int32 Cursor = Dest;
+    while (Cursor < Num)
+    {
+        const int32 RunBegin = FindNextMaskBit(Mask, Cursor, Num, false);
+        if (RunBegin >= Num) { break; }
+        const int32 RunEnd = FindNextMaskBit(Mask, RunBegin, Num, true);
+        const int32 RunLength = RunEnd - RunBegin;
+
+        memmove(ParticleData + static_cast<SIZE_T>(Dest) * ParticleStride,
+                ParticleData + static_cast<SIZE_T>(RunBegin) * ParticleStride,
+                static_cast<SIZE_T>(RunLength) * ParticleStride);
+
+        if (bUseSoALayout)
+        {
+            SoAData.MoveRange(RunBegin, Dest, RunLength);
+        }
+
+        Dest += RunLength;
+        Cursor = RunEnd;
+    }
+
+    memset(Mask, 0, static_cast<SIZE_T>(NumWords) * sizeof(uint64));
+    ActiveParticles = Num - NumDead;
+    return NumDead;
+}
+
 // 비동기 고려된 Tick, 안에서 Component Raw Pointer 절대 사용금지!!!!!!!!
 void FParticleEmitterInstance::Tick(FParticleSimulationContext& Context)
 {
@@ -388,41 +524,54 @@ void FParticleEmitterInstance::Tick(FParticleSimulationContext& Context)
         }
     }
     
-    // ============================================================
-    // Time Update & Kill
-    // ============================================================
-    for (int32 i = 0; i < ActiveParticles; i++)
+    if (bUseSoALayout)
     {
-        DECLARE_PARTICLE_PTR(Particle, ParticleData, ParticleStride, i)
+        TickSoA(Context);
+    }
+    else
+    {
+        // ============================================================
+        // Time Update & Kill
+        // ============================================================
+        bool bAnyDead = false;
+        for (int32 i = 0; i < ActiveParticles; i++)
+        {
+            DECLARE_PARTICLE_PTR(Particle, ParticleData, ParticleStride, i)
 
-        Particle->OldLocation = Particle->Location;
-        Particle->Location += Particle->Velocity * Context.DeltaTime;
+            Particle->OldLocation = Particle->Location;
+            Particle->Location += Particle->Velocity * Context.DeltaTime;
 
-        if (Particle->OneOverMaxLifetime > 0.0f)
-        {
-            Particle->RelativeTime += Particle->OneOverMaxLifetime * Context.DeltaTime;
+            if (Particle->OneOverMaxLifetime > 0.0f)
+            {
+                Particle->RelativeTime += Particle->OneOverMaxLifetime * Context.DeltaTime;
+            }
+
+            if (Particle->RelativeTime >= 1.0f)
+            {
+                MarkParticleDead(i);
+                bAnyDead = true;
+            }
         }
 
-        if (Particle->RelativeTime >= 1.0f)
+        if (bAnyDead)
         {
-            KillParticle(i);
-            i--; // Swap & Pop 인덱스 보정
+            CompactDeadParticles();
         }
-    }
     
-    // ============================================================
-    // Module Update
-    // ============================================================
-    if (bHasRibbonTrails)
-    {
-        UpdateRibbonTrailDistances();
-    }
+        // ============================================================
+        // Module Update
+        // ============================================================
+        if (bHasRibbonTrails)
+        {
+            UpdateRibbonTrailDistances();
+        }
 
-    for (int32 i = 0; i < CurrentLODLevel->UpdateModules.Num(); i++)
-    {
-        UParticleModule* Module = CurrentLODLevel->UpdateModules[i];
-        if (!Module || !Module->bEnabled) { continue; }
-        Module->UpdateAsync(this, Module->PayloadOffset, Context);
+        for (int32 i = 0; i < CurrentLODLevel->UpdateModules.Num(); i++)
+        {
+            UParticleModule* Module = CurrentLODLevel->UpdateModules[i];
+            if (!Module || !Module->bEnabled) { continue; }
+            Module->UpdateAsync(this, Module->PayloadOffset, Context);
+        }
     }
 
     // ============================================================
@@ -450,6 +599,62 @@ void FParticleEmitterInstance::Tick(FParticleSimulationContext& Context)
     }
 }
 
+void FParticleEmitterInstance::TickSoA(FParticleSimulationContext& Context)
+{
+    // ============================================================
+    // Time Update & Kill
+    // ============================================================
+    ParticleSoAKernels::IntegrateAndAge(SoAData, ActiveParticles, Context.DeltaTime);
+
+    if (ParticleSoAKernels::BuildExpiredMask(SoAData, ActiveParticles, DeadMask.GetData()) > 0)
+    {
+        CompactDeadParticles();
+    }
+
+    // ============================================================
+    // Module Update
+    // ============================================================
+    // SIMD 커널이 없는 모듈을 만나면 그때만 AoS와 동기화한다
+    bool bAoSStale = true;   // SoA가 최신, AoS 핫 필드는 아직 옛날 값
+    bool bSoAStale = false;  // AoS 전용 모듈이 AoS를 고쳐서 SoA가 옛날 값
+
+    for (int32 i = 0; i < CurrentLODLevel->UpdateModules.Num(); i++)
+    {
+        UParticleModule* Module = CurrentLODLevel->UpdateModules[i];
+        if (!Module || !Module->bEnabled) { continue; }
+
+        if (bSoAStale)
+        {
+            SoAData.LoadFromAoS(ParticleData, ParticleStride, 0, ActiveParticles);
+            bSoAStale = false;
+        }
+
+        if (Module->UpdateSoA(this, SoAData, Context))
+        {
+            bAoSStale = true;
+            continue;
+        }
+
+        if (bAoSStale)
+        {
+            SoAData.StoreToAoS(ParticleData, ParticleStride, 0, ActiveParticles);
+            bAoSStale = false;
+        }
+        Module->UpdateAsync(this, Module->PayloadOffset, Context);
+        bSoAStale = true;
+    }
+
+    // 렌더 데이터는 AoS에서 만들어지므로 마지막에 한 번 되돌려 쓴다
+    if (bAoSStale)
+    {
+        SoAData.StoreToAoS(ParticleData, ParticleStride, 0, ActiveParticles);
+    }
+    else if (bSoAStale)
+    {
+        SoAData.LoadFromAoS(ParticleData, ParticleStride, 0, ActiveParticles);
+    }
+}
+
 void FParticleEmitterInstance::UpdateModuleCache()
 {
     if (!Template) { return; }
@@ -508,7 +713,23 @@ void FParticleEmitterInstance::UpdateModuleCache()
     }
 }
 
-FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
+namespace
+{
+    // 풀 슬롯의 페이로드가 같은 타입이면 그대로 재사용, 아니면 교체 (교체할 때만 힙 할당)
+    template<typename TData>
+    TData* AcquirePooledData(FDynamicEmitterDataBase*& Slot, EParticleType Type, uint32& AllocationCount)
+    {
+        if (!Slot || Slot->EmitterType != Type)
+        {
+            delete Slot;
+            Slot = new TData();
+            ++AllocationCount;
+        }
+        return static_cast<TData*>(Slot);
+    }
+}
+
+FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData(FDynamicEmitterDataBase*& InOutPooledData)
 {
     if (ActiveParticles <= 0) return nullptr;
 
@@ -517,7 +738,7 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
 
     if (Type == EParticleType::Sprite)
     {
-        auto* SpriteData = new FDynamicSpriteEmitterData();
+        auto* SpriteData = AcquirePooledData<FDynamicSpriteEmitterData>(InOutPooledData, Type, RenderAllocationCount);
         SpriteData->EmitterType = Type;
         SpriteData->SortMode = CachedRequiredModule->SortMode;
         SpriteData->Alignment = CachedRequiredModule->ScreenAlignment;
@@ -530,7 +751,7 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
     }
     else if (Type == EParticleType::Mesh)
     {
-        auto* MeshData = new FDynamicMeshEmitterData();
+        auto* MeshData = AcquirePooledData<FDynamicMeshEmitterData>(InOutPooledData, Type, RenderAllocationCount);
         MeshData->EmitterType = Type;
         MeshData->SortMode = CachedRequiredModule->SortMode;
         MeshData->Alignment = CachedRequiredModule->ScreenAlignment;
@@ -540,19 +761,12 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
         // 데이터 채우기
         BuildReplayData(MeshData->Source);
 
-        if (MeshData->Source.Mesh)
-        {
-            NewData = MeshData;
-        }
-        else
-        {
-            delete MeshData;
-            NewData = nullptr;
-        }
+        // 메시가 없으면 그리지 않는다 (페이로드는 슬롯에 남겨 다음 프레임에 재사용)
+        NewData = MeshData->Source.Mesh ? MeshData : nullptr;
     }
     else if (Type == EParticleType::Beam)
     {
-        auto* BeamData = new FDynamicBeamEmitterData();
+        auto* BeamData = AcquirePooledData<FDynamicBeamEmitterData>(InOutPooledData, Type, RenderAllocationCount);
         BeamData->EmitterType = Type;
         BeamData->SortMode = CachedRequiredModule->SortMode;
         BeamData->SortPriority = 0;
@@ -563,7 +777,7 @@ FDynamicEmitterDataBase* FParticleEmitterInstance::CreateDynamicData()
     else if (Type == EParticleType::Ribbon)
     {
         // RIBBON
-        auto* RibbonData = new FDynamicRibbonEmitterData();
+        auto* RibbonData = AcquirePooledData<FDynamicRibbonEmitterData>(InOutPooledData, Type, RenderAllocationCount);
         RibbonData->EmitterType = Type;
         RibbonData->bUseLocalSpace = CachedRequiredModule->bUseLocalSpace;
 
@@ -589,15 +803,15 @@ void FParticleEmitterInstance::BuildReplayData(FDynamicEmitterReplayDataBase& Ou
     OutData.ParticleStride = ParticleStride;
     OutData.Scale = FVector::One();
 
-    // 2) DataContainer 메모리 재할당
-    OutData.DataContainer.Free();
-
+    // 2) DataContainer 확보 (재사용되는 페이로드라 모자랄 때만 다시 할당)
     const int32 ParticleBytes = ActiveParticles * ParticleStride;
     const int32 IndexCount = ActiveParticles;  // 논리적으로 살아있는 파티클 수만
 
-    OutData.DataContainer.Allocate(ParticleBytes, IndexCount);
+    if (OutData.DataContainer.Allocate(ParticleBytes, IndexCount))
+    {
+        ++RenderAllocationCount;
+    }
 
-    // Data Container 재할당
     std::memcpy(
         OutData.DataContainer.ParticleData,
         ParticleData,
@@ -621,11 +835,13 @@ void FParticleEmitterInstance::BuildReplayData(FDynamicEmitterReplayDataBase& Ou
         {
             auto& SpriteOut = static_cast<FDynamicSpriteEmitterReplayData&>(OutData);
             SpriteOut.RequiredModule = CachedRequiredModule;
+            SpriteOut.SubUVModule = nullptr;
+            SpriteOut.SubUVPayloadOffset = -1;
 
             // SubUV 모듈 찾기
             if (CurrentLODLevel)
             {
-                TArray<UParticleModule*> UpdateModules = CurrentLODLevel->UpdateModules;
+                const TArray<UParticleModule*>& UpdateModules = CurrentLODLevel->UpdateModules;
                 for (UParticleModule* Module : UpdateModules)
                 {
                     if (auto* SubUV = Cast<UParticleModuleSubUV>(Module))
@@ -647,6 +863,7 @@ void FParticleEmitterInstance::BuildReplayData(FDynamicEmitterReplayDataBase& Ou
             MeshOut.Mesh = Template ? Template->Mesh : nullptr;
             MeshOut.InstanceStride = sizeof(FBaseParticle); // 추후 변경
             MeshOut.InstanceCount = ActiveParticles;
+            MeshOut.bLighting = false;
 
             for (UParticleModule* Module : CurrentLODLevel->AllModulesCache)
             {
@@ -674,6 +891,9 @@ void FParticleEmitterInstance::BuildReplayData(FDynamicEmitterReplayDataBase& Ou
         {
             auto& BeamOut = static_cast<FDynamicBeamEmitterReplayData&>(OutData);
             BeamOut.RequiredModule = CachedRequiredModule;
+            BeamOut.TessellationFactor = 10;
+            BeamOut.NoiseFrequency = 0.0f;
+            BeamOut.NoiseAmplitude = 0.0f;
 
             // 빔 모듈에서 설정 가져오기 (TypeDataModule에서 직접 가져오기)
             if (CurrentLODLevel && CurrentLODLevel->TypeDataModule)
@@ -843,6 +1063,41 @@ void FParticleEmitterInstance::RemapRibbonParticleIndex(int32 FromIndex, int32 T
     }
 }
 
+void FParticleEmitterInstance::RemapRibbonLinksForCompaction()
+{
+    if (!bHasRibbonTrails) return;
+
+    const int32 Num = ActiveParticles;
+
+    // 죽은 노드면 NextIndex를 따라 처음 만나는 살아있는 노드의 새 인덱스 (DetachRibbonParticle과 같은 규칙)
+    auto ResolveLink = [this, Num](int32 OldIndex) -> int32
+    {
+        for (int32 Step = 0; Step < Num && OldIndex >= 0 && OldIndex < Num; ++Step)
+        {
+            if (CompactionRemap[OldIndex] != INDEX_NONE)
+            {
+                return CompactionRemap[OldIndex];
+            }
+            DECLARE_PARTICLE_PTR(Dead, ParticleData, ParticleStride, OldIndex);
+            OldIndex = Dead->NextIndex;
+        }
+        return INDEX_NONE;
+    };
+
+    for (int32& Head : RibbonTrailHeads)
+    {
+        Head = ResolveLink(Head);
+    }
+
+    // 살아있는 노드만 고친다 (죽은 노드의 NextIndex는 위 체인 추적에 필요하므로 마지막까지 유지)
+    for (int32 i = 0; i < Num; ++i)
+    {
+        if (CompactionRemap[i] == INDEX_NONE) continue;
+        DECLARE_PARTICLE_PTR(P, ParticleData, ParticleStride, i);
+        P->NextIndex = ResolveLink(P->NextIndex);
+    }
+}
+
 FRibbonTrailRuntimePayload* FParticleEmitterInstance::GetRibbonPayload(int32 Index) const
 {
     if (!bHasRibbonTrails || RibbonPayloadOffset < 0 || !ParticleData) return nullptr;
@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include <random>
 #include "ParticleEmitter.h"
+#include "ParticleSoA.h"
+#include "ParticleSort.h"
 
 class UParticleSystemComponent;
 class UParticleModuleRequired;
@@ -47,6 +49,33 @@ struct FParticleEmitterInstance
     bool bHasRibbonTrails = false;
     class UParticleModuleRibbon* CachedRibbonModule = nullptr;
 
+    // ============================================================
+    // SoA 레이아웃 (Required->bUseSoALayout, Sprite/Mesh 전용)
+    // ============================================================
+    /** 핫 필드를 SoA 스트림에서 SIMD로 갱신할지 여부 (메모리 초기화 시 결정) */
+    bool bUseSoALayout = false;
+    /** ParticleData와 같은 인덱스를 쓰는 SoA 스트림. Tick이 끝나면 항상 AoS와 같은 값을 가진다 */
+    FParticleSoAData SoAData;
+
+    // ============================================================
+    // 일괄 Kill (Tick에서 죽은 파티클을 표시만 하고 한 번에 압축)
+    // ============================================================
+    /** 이번 Tick에 수명이 끝난 파티클 비트마스크 (64개 단위 워드, MaxActiveParticles 기준) */
+    TArray<uint64> DeadMask;
+    /** 압축 시 OldIndex → NewIndex (죽은 파티클은 INDEX_NONE). 리본 링크와 지난 정렬 순서 재매핑에 사용 */
+    TArray<int32> CompactionRemap;
+
+    // ============================================================
+    // 깊이 정렬 (파티클 Job에서 갱신)
+    // ============================================================
+    /** 지난 프레임 정렬 결과 (삽입 정렬의 시작 순서로 재사용, 압축 때 새 인덱스로 재매핑된다) */
+    TArray<int32> LastSortedIndices;
+    double LastSortTimeMs = 0.0;
+    EParticleSortAlgorithm LastSortAlgorithm = EParticleSortAlgorithm::None;
+
+    /** 렌더 페이로드/DataContainer 힙 할당 횟수 (Gather Job이 통계로 가져가며 0으로 되돌림) */
+    uint32 RenderAllocationCount = 0;
+
     /** 현재 활성화된 파티클 수 */
     int32 ActiveParticles = 0;
     /** 단조 증가 카운터 (랜덤 시드 용) */
@@ -92,17 +121,34 @@ struct FParticleEmitterInstance
     void SpawnParticles(int32 Count, float StartTime, float Increment,
         const FVector& InitialLocation, const FVector& InitialVelocity, FParticleSimulationContext& InContext);    
 
-    /** 파티클 제거 */
+    /** 파티클 제거 (단일 Swap & Pop) */
     void KillParticle(int32 Index);
 
+    /** Tick 중 죽은 파티클 표시 (실제 제거는 CompactDeadParticles에서 한 번에) */
+    void MarkParticleDead(int32 Index) { DeadMask[Index >> 6] |= 1ull << (Index & 63); }
+    /**
+     * DeadMask에 표시된 파티클을 순서를 유지한 채 한 번에 제거 (Stream Compaction)
+     * - 살아남은 연속 구간 단위로 AoS/SoA를 memmove
+     * - 리본 링크는 같은 Remap 테이블로 한 번에 갱신
+     * @return 제거된 파티클 수
+     */
+    int32 CompactDeadParticles();
+
     /** 파티클 업데이트 */
     /** 비동기 Tick */
     void Tick(FParticleSimulationContext& Context);
+    /** SoA 레이아웃 전용 Time Update & Kill & Module Update */
+    void TickSoA(FParticleSimulationContext& Context);
     
     /** LOD에 따른 모듈 캐싱 업데이트 */
     void UpdateModuleCache();
 
-    struct FDynamicEmitterDataBase* CreateDynamicData();
+    /**
+     * 렌더 페이로드 생성
+     * @param InOutPooledData 재사용할 페이로드 슬롯 (타입이 같으면 그대로 덮어쓰고, 다르면 교체). 소유권은 슬롯에 남는다
+     * @return 이번 프레임에 렌더할 데이터 (그릴 게 없으면 nullptr)
+     */
+    struct FDynamicEmitterDataBase* CreateDynamicData(struct FDynamicEmitterDataBase*& InOutPooledData);
     void BuildReplayData(FDynamicEmitterReplayDataBase& OutData);
 
     void InitializeRibbonState();
@@ -110,6 +156,8 @@ struct FParticleEmitterInstance
     void AttachRibbonParticle(int32 NewIndex, class FRibbonTrailRuntimePayload* Payload);
     void DetachRibbonParticle(int32 Index);
     void RemapRibbonParticleIndex(int32 FromIndex, int32 ToIndex);
+    /** 압축 직전 (이동 전) 호출: CompactionRemap으로 헤드/NextIndex를 새 인덱스로 바꾸고 죽은 노드는 건너뛴다 */
+    void RemapRibbonLinksForCompaction();
     FRibbonTrailRuntimePayload * GetRibbonPayload(int32 Index) const;
 
     bool IsComplete() const;
@@ -0,0 +1,411 @@
+﻿#include "pch.h"
+#include "ParticleSoA.h"
+#include "ParticleHelper.h"
+#include <immintrin.h> // For SSE, AVX instructions
+#include <bit>
+
+namespace
+{
+    // /arch:AVX 빌드면 8-wide, 아니면 SSE 4-wide (SoA 용량은 항상 8의 배수라 둘 다 꼬리 없음)
+#if defined(__AVX__)
+    using FSimdFloat = __m256;
+    constexpr int32 LaneCount = 8;
+    inline FSimdFloat SimdLoad(const float* P) { return _mm256_loadu_ps(P); }
+    inline void SimdStore(float* P, FSimdFloat V) { _mm256_storeu_ps(P, V); }
+    inline FSimdFloat SimdSet1(float V) { return _mm256_set1_ps(V); }
+    inline FSimdFloat SimdAdd(FSimdFloat A, FSimdFloat B) { return _mm256_add_ps(A, B); }
+    inline FSimdFloat SimdSub(FSimdFloat A, FSimdFloat B) { return _mm256_sub_ps(A, B); }
+    inline FSimdFloat SimdMul(FSimdFloat A, FSimdFloat B) { return _mm256_mul_ps(A, B); }
+    inline FSimdFloat SimdDiv(FSimdFloat A, FSimdFloat B) { return _mm256_div_ps(A, B); }
+    inline FSimdFloat SimdCmpLT(FSimdFloat A, FSimdFloat B) { return _mm256_cmp_ps(A, B, _CMP_LT_OQ); }
+    inline FSimdFloat SimdCmpGE(FSimdFloat A, FSimdFloat B) { return _mm256_cmp_ps(A, B, _CMP_GE_OQ); }
+    inline FSimdFloat SimdSelect(FSimdFloat Mask, FSimdFloat IfTrue, FSimdFloat IfFalse) { return _mm256_blendv_ps(IfFalse, IfTrue, Mask); }
+    inline int32 SimdMoveMask(FSimdFloat V) { return _mm256_movemask_ps(V); }
+#else
+    using FSimdFloat = __m128;
+    constexpr int32 LaneCount = 4;
+    inline FSimdFloat SimdLoad(const float* P) { return _mm_loadu_ps(P); }
+    inline void SimdStore(float* P, FSimdFloat V) { _mm_storeu_ps(P, V); }
+    inline FSimdFloat SimdSet1(float V) { return _mm_set1_ps(V); }
+    inline FSimdFloat SimdAdd(FSimdFloat A, FSimdFloat B) { return _mm_add_ps(A, B); }
+    inline FSimdFloat SimdSub(FSimdFloat A, FSimdFloat B) { return _mm_sub_ps(A, B); }
+    inline FSimdFloat SimdMul(FSimdFloat A, FSimdFloat B) { return _mm_mul_ps(A, B); }
+    inline FSimdFloat SimdDiv(FSimdFloat A, FSimdFloat B) { return _mm_div_ps(A, B); }
+    inline FSimdFloat SimdCmpLT(FSimdFloat A, FSimdFloat B) { return _mm_cmplt_ps(A, B); }
+    inline FSimdFloat SimdCmpGE(FSimdFloat A, FSimdFloat B) { return _mm_cmpge_ps(A, B); }
+    inline FSimdFloat SimdSelect(FSimdFloat Mask, FSimdFloat IfTrue, FSimdFloat IfFalse)
+    {
+        return _mm_or_ps(_mm_and_ps(Mask, IfTrue), _mm_andnot_ps(Mask, IfFalse));
+    }
+    inline int32 SimdMoveMask(FSimdFloat V) { return _mm_movemask_ps(V); }
+#endif
+
+    static_assert(FParticleSoAData::SimdWidth % LaneCount == 0, "SoA capacity must be a multiple of the SIMD lane count");
+
+    inline int32 RoundUpToSimd(int32 Num)
+    {
+        return (Num + FParticleSoAData::SimdWidth - 1) & ~(FParticleSoAData::SimdWidth - 1);
+    }
+
+    // 2-point 커브 평가 (스칼라 버전과 같은 규칙: t < T1 → V1, t >= T2 → V2)
+    inline FSimdFloat EvaluateTwoPoint(FSimdFloat T, float Time1, float Value1, float Time2, float Value2)
+    {
+        const FSimdFloat T1 = SimdSet1(Time1);
+        const FSimdFloat T2 = SimdSet1(Time2);
+        const FSimdFloat V1 = SimdSet1(Value1);
+        const FSimdFloat V2 = SimdSet1(Value2);
+
+        // T1 == T2면 분모가 0이지만 그 경우 모든 t가 아래 두 마스크 중 하나에 걸리므로 결과에 섞이지 않음
+        const FSimdFloat Alpha = SimdDiv(SimdSub(T, T1), SimdSub(T2, T1));
+        FSimdFloat Result = SimdAdd(V1, SimdMul(SimdSub(V2, V1), Alpha));
+        Result = SimdSelect(SimdCmpLT(T, T1), V1, Result);
+        Result = SimdSelect(SimdCmpGE(T, T2), V2, Result);
+        return Result;
+    }
+}
+
+void FParticleSoAData::Allocate(int32 MaxParticles)
+{
+    Free();
+
+    Capacity = RoundUpToSimd(FMath::Max(MaxParticles, 1));
+    constexpr int32 NumStreams = static_cast<int32>(EParticleStream::Count);
+    const SIZE_T BufferSize = static_cast<SIZE_T>(Capacity) * NumStreams * sizeof(float);
+
+    Buffer = static_cast<float*>(FMemoryManager::Allocate(BufferSize, 16));
+    // 패딩 영역도 커널이 읽으므로 NaN이 섞이지 않게 0으로 채운다
+    memset(Buffer, 0, BufferSize);
+
+    for (int32 i = 0; i < NumStreams; ++i)
+    {
+        Streams[i] = Buffer + static_cast<SIZE_T>(i) * Capacity;
+    }
+}
+
+void FParticleSoAData::Free()
+{
+    if (Buffer)
+    {
+        FMemoryManager::Deallocate(Buffer);
+        Buffer = nullptr;
+    }
+
+    for (float*& Stream : Streams)
+    {
+        Stream = nullptr;
+    }
+    Capacity = 0;
+}
+
+void FParticleSoAData::LoadFromAoS(const uint8* ParticleData, int32 Stride, int32 Begin, int32 End)
+{
+    float* LocX = Get(EParticleStream::LocationX);
+    float* LocY = Get(EParticleStream::LocationY);
+    float* LocZ = Get(EParticleStream::LocationZ);
+    float* OldX = Get(EParticleStream::OldLocationX);
+    float* OldY = Get(EParticleStream::OldLocationY);
+    float* OldZ = Get(EParticleStream::OldLocationZ);
+    float* VelX = Get(EParticleStream::VelocityX);
+    float* VelY = Get(EParticleStream::VelocityY);
+    float* VelZ = Get(EParticleStream::VelocityZ);
+    float* SizeX = Get(EParticleStream::SizeX);
+    float* SizeY = Get(EParticleStream::SizeY);
+    float* SizeZ = Get(EParticleStream::SizeZ);
+    float* BaseSizeX = Get(EParticleStream::BaseSizeX);
+    float* BaseSizeY = Get(EParticleStream::BaseSizeY);
+    float* BaseSizeZ = Get(EParticleStream::BaseSizeZ);
+    float* ColorR = Get(EParticleStream::ColorR);
+    float* ColorG = Get(EParticleStream::ColorG);
+    float* ColorB = Get(EParticleStream::ColorB);
+    float* ColorA = Get(EParticleStream::ColorA);
+    float* RelTime = Get(EParticleStream::RelativeTime);
+    float* OneOverLife = Get(EParticleStream::OneOverMaxLifetime);
+
+    for (int32 i = Begin; i < End; ++i)
+    {
+        DECLARE_PARTICLE_CONST(Particle, ParticleData, Stride, i)
+
+        LocX[i] = Particle.Location.X;        LocY[i] = Particle.Location.Y;        LocZ[i] = Particle.Location.Z;
+        OldX[i] = Particle.OldLocation.X;     OldY[i] = Particle.OldLocation.Y;     OldZ[i] = Particle.OldLocation.Z;
+        VelX[i] = Particle.Velocity.X;        VelY[i] = Particle.Velocity.Y;        VelZ[i] = Particle.Velocity.Z;
+        SizeX[i] = Particle.Size.X;           SizeY[i] = Particle.Size.Y;           SizeZ[i] = Particle.Size.Z;
+        BaseSizeX[i] = Particle.BaseSize.X;   BaseSizeY[i] = Particle.BaseSize.Y;   BaseSizeZ[i] = Particle.BaseSize.Z;
+        ColorR[i] = Particle.Color.R;         ColorG[i] = Particle.Color.G;
+        ColorB[i] = Particle.Color.B;         ColorA[i] = Particle.Color.A;
+        RelTime[i] = Particle.RelativeTime;
+        OneOverLife[i] = Particle.OneOverMaxLifetime;
+    }
+}
+
+void FParticleSoAData::StoreToAoS(uint8* ParticleData, int32 Stride, int32 Begin, int32 End) const
+{
+    const float* LocX = Get(EParticleStream::LocationX);
+    const float* LocY = Get(EParticleStream::LocationY);
+    const float* LocZ = Get(EParticleStream::LocationZ);
+    const float* OldX = Get(EParticleStream::OldLocationX);
+    const float* OldY = Get(EParticleStream::OldLocationY);
+    const float* OldZ = Get(EParticleStream::OldLocationZ);
+    const float* VelX = Get(EParticleStream::VelocityX);
+    const float* VelY = Get(EParticleStream::VelocityY);
+    const float* VelZ = Get(EParticleStream::VelocityZ);
+    const float* SizeX = Get(EParticleStream::SizeX);
+    const float* SizeY = Get(EParticleStream::SizeY);
+    const float* SizeZ = Get(EParticleStream::SizeZ);
+    const float* BaseSizeX = Get(EParticleStream::BaseSizeX);
+    const float* BaseSizeY = Get(EParticleStream::BaseSizeY);
+    const float* BaseSizeZ = Get(EParticleStream::BaseSizeZ);
+    const float* ColorR = Get(EParticleStream::ColorR);
+    const float* ColorG = Get(EParticleStream::ColorG);
+    const float* ColorB = Get(EParticleStream::ColorB);
+    const float* ColorA = Get(EParticleStream::ColorA);
+    const float* RelTime = Get(EParticleStream::RelativeTime);
+    const float* OneOverLife = Get(EParticleStream::OneOverMaxLifetime);
+
+    for (int32 i = Begin; i < End; ++i)
+    {
+        DECLARE_PARTICLE(Particle, ParticleData, Stride, i)
+
+        Particle.Location = FVector(LocX[i], LocY[i], LocZ[i]);
+        Particle.OldLocation = FVector(OldX[i], OldY[i], OldZ[i]);
+        Particle.Velocity = FVector(VelX[i], VelY[i], VelZ[i]);
+        Particle.Size = FVector(SizeX[i], SizeY[i], SizeZ[i]);
+        Particle.BaseSize = FVector(BaseSizeX[i], BaseSizeY[i], BaseSizeZ[i]);
+        Particle.Color = FLinearColor(ColorR[i], ColorG[i], ColorB[i], ColorA[i]);
+        Particle.RelativeTime = RelTime[i];
+        Particle.OneOverMaxLifetime = OneOverLife[i];
+    }
+}
+
+void FParticleSoAData::Move(int32 FromIndex, int32 ToIndex)
+{
+    for (float* Stream : Streams)
+    {
+        Stream[ToIndex] = Stream[FromIndex];
+    }
+}
+
+void FParticleSoAData::MoveRange(int32 FromIndex, int32 ToIndex, int32 Count)
+{
+    if (Count <= 0 || FromIndex == ToIndex) { return; }
+
+    for (float* Stream : Streams)
+    {
+        memmove(Stream + ToIndex, Stream + FromIndex, static_cast<SIZE_T>(Count) * sizeof(float));
+    }
+}
+
+void ParticleSoAKernels::IntegrateAndAge(FParticleSoAData& Data, int32 Num, float DeltaTime)
+{
+    float* LocX = Data.Get(EParticleStream::LocationX);
+    float* LocY = Data.Get(EParticleStream::LocationY);
+    float* LocZ = Data.Get(EParticleStream::LocationZ);
+    float* OldX = Data.Get(EParticleStream::OldLocationX);
+    float* OldY = Data.Get(EParticleStream::OldLocationY);
+    float* OldZ = Data.Get(EParticleStream::OldLocationZ);
+    const float* VelX = Data.Get(EParticleStream::VelocityX);
+    const float* VelY = Data.Get(EParticleStream::VelocityY);
+    const float* VelZ = Data.Get(EParticleStream::VelocityZ);
+    float* RelTime = Data.Get(EParticleStream::RelativeTime);
+    const float* OneOverLife = Data.Get(EParticleStream::OneOverMaxLifetime);
+
+    const FSimdFloat Dt = SimdSet1(DeltaTime);
+    const int32 Padded = RoundUpToSimd(Num);
+
+    for (int32 i = 0; i < Padded; i += LaneCount)
+    {
+        const FSimdFloat X = SimdLoad(LocX + i);
+        const FSimdFloat Y = SimdLoad(LocY + i);
+        const FSimdFloat Z = SimdLoad(LocZ + i);
+        SimdStore(OldX + i, X);
+        SimdStore(OldY + i, Y);
+        SimdStore(OldZ + i, Z);
+        SimdStore(LocX + i, SimdAdd(X, SimdMul(SimdLoad(VelX + i), Dt)));
+        SimdStore(LocY + i, SimdAdd(Y, SimdMul(SimdLoad(VelY + i), Dt)));
+        SimdStore(LocZ + i, SimdAdd(Z, SimdMul(SimdLoad(VelZ + i), Dt)));
+
+        // OneOverMaxLifetime == 0 (무한 수명)이면 더해지는 값도 0이므로 분기 없이 처리
+        SimdStore(RelTime + i, SimdAdd(SimdLoad(RelTime + i), SimdMul(SimdLoad(OneOverLife + i), Dt)));
+    }
+}
+
+void ParticleSoAKernels::ApplyVelocity(FParticleSoAData& Data, int32 Num, const FVector& Gravity, float Damping, float DeltaTime)
+{
+    float* LocX = Data.Get(EParticleStream::LocationX);
+    float* LocY = Data.Get(EParticleStream::LocationY);
+    float* LocZ = Data.Get(EParticleStream::LocationZ);
+    float* OldX = Data.Get(EParticleStream::OldLocationX);
+    float* OldY = Data.Get(EParticleStream::OldLocationY);
+    float* OldZ = Data.Get(EParticleStream::OldLocationZ);
+    float* VelX = Data.Get(EParticleStream::VelocityX);
+    float* VelY = Data.Get(EParticleStream::VelocityY);
+    float* VelZ = Data.Get(EParticleStream::VelocityZ);
+
+    const FSimdFloat Dt = SimdSet1(DeltaTime);
+    const FSimdFloat GravityDtX = SimdSet1(Gravity.X * DeltaTime);
+    const FSimdFloat GravityDtY = SimdSet1(Gravity.Y * DeltaTime);
+    const FSimdFloat GravityDtZ = SimdSet1(Gravity.Z * DeltaTime);
+    const FSimdFloat DampingFactor = SimdSet1((Damping > 0.0f) ? FMath::Max(0.0f, 1.0f - Damping * DeltaTime) : 1.0f);
+    const int32 Padded = RoundUpToSimd(Num);
+
+    for (int32 i = 0; i < Padded; i += LaneCount)
+    {
+        const FSimdFloat X = SimdLoad(LocX + i);
+        const FSimdFloat Y = SimdLoad(LocY + i);
+        const FSimdFloat Z = SimdLoad(LocZ + i);
+        SimdStore(OldX + i, X);
+        SimdStore(OldY + i, Y);
+        SimdStore(OldZ + i, Z);
+
+        const FSimdFloat VX = SimdMul(SimdAdd(SimdLoad(VelX + i), GravityDtX), DampingFactor);
+        const FSimdFloat VY = SimdMul(SimdAdd(SimdLoad(VelY + i), GravityDtY), DampingFactor);
+        const FSimdFloat VZ = SimdMul(SimdAdd(SimdLoad(VelZ + i), GravityDtZ), DampingFactor);
+        SimdStore(VelX + i, VX);
+        SimdStore(VelY + i, VY);
+        SimdStore(VelZ + i, VZ);
+
+        SimdStore(LocX + i, SimdAdd(X, SimdMul(VX, Dt)));
+        SimdStore(LocY + i, SimdAdd(Y, SimdMul(VY, Dt)));
+        SimdStore(LocZ + i, SimdAdd(Z, SimdMul(VZ, Dt)));
+    }
+}
+
+int32 ParticleSoAKernels::BuildExpiredMask(const FParticleSoAData& Data, int32 Num, uint64* OutDeadMask)
+{
+    if (Num <= 0) { return 0; }
+
+    const float* RelTime = Data.Get(EParticleStream::RelativeTime);
+    const FSimdFloat One = SimdSet1(1.0f);
+    const int32 NumWords = (Num + 63) >> 6;
+    const int32 Padded = RoundUpToSimd(Num);
+
+    int32 NumDead = 0;
+    for (int32 Word = 0; Word < NumWords; ++Word)
+    {
+        // 워드 하나(64개)를 LaneCount씩 비교해 movemask 비트를 이어 붙인다
+        const int32 Begin = Word << 6;
+        const int32 End = FMath::Min(Begin + 64, Padded);
+
+        uint64 Bits = 0;
+        for (int32 i = Begin; i < End; i += LaneCount)
+        {
+            const uint32 LaneBits = static_cast<uint32>(SimdMoveMask(SimdCmpGE(SimdLoad(RelTime + i), One)));
+            Bits |= static_cast<uint64>(LaneBits) << (i - Begin);
+        }
+
+        // 패딩 영역(Num 이후)의 비트는 지운다
+        const int32 ValidBits = Num - Begin;
+        if (ValidBits < 64)
+        {
+            Bits &= (1ull << ValidBits) - 1;
+        }
+
+        OutDeadMask[Word] = Bits;
+        NumDead += std::popcount(Bits);
+    }
+    return NumDead;
+}
+
+void ParticleSoAKernels::ColorOverLife(FParticleSoAData& Data, int32 Num, const FLinearColor& MinColor, const FLinearColor& MaxColor, bool bUseRange)
+{
+    float* ColorR = Data.Get(EParticleStream::ColorR);
+    float* ColorG = Data.Get(EParticleStream::ColorG);
+    float* ColorB = Data.Get(EParticleStream::ColorB);
+    const float* RelTime = Data.Get(EParticleStream::RelativeTime);
+
+    const FSimdFloat MinR = SimdSet1(MinColor.R);
+    const FSimdFloat MinG = SimdSet1(MinColor.G);
+    const FSimdFloat MinB = SimdSet1(MinColor.B);
+    const int32 Padded = RoundUpToSimd(Num);
+
+    if (!bUseRange)
+    {
+        for (int32 i = 0; i < Padded; i += LaneCount)
+        {
+            SimdStore(ColorR + i, MinR);
+            SimdStore(ColorG + i, MinG);
+            SimdStore(ColorB + i, MinB);
+        }
+        return;
+    }
+
+    const FSimdFloat DeltaR = SimdSet1(MaxColor.R - MinColor.R);
+    const FSimdFloat DeltaG = SimdSet1(MaxColor.G - MinColor.G);
+    const FSimdFloat DeltaB = SimdSet1(MaxColor.B - MinColor.B);
+
+    for (int32 i = 0; i < Padded; i += LaneCount)
+    {
+        const FSimdFloat T = SimdLoad(RelTime + i);
+        SimdStore(ColorR + i, SimdAdd(MinR, SimdMul(DeltaR, T)));
+        SimdStore(ColorG + i, SimdAdd(MinG, SimdMul(DeltaG, T)));
+        SimdStore(ColorB + i, SimdAdd(MinB, SimdMul(DeltaB, T)));
+    }
+}
+
+void ParticleSoAKernels::AlphaOverLife(FParticleSoAData& Data, int32 Num, float Time1, float Value1, float Time2, float Value2)
+{
+    float* ColorA = Data.Get(EParticleStream::ColorA);
+    const float* RelTime = Data.Get(EParticleStream::RelativeTime);
+    const int32 Padded = RoundUpToSimd(Num);
+
+    for (int32 i = 0; i < Padded; i += LaneCount)
+    {
+        SimdStore(ColorA + i, EvaluateTwoPoint(SimdLoad(RelTime + i), Time1, Value1, Time2, Value2));
+    }
+}
+
+void ParticleSoAKernels::SizeOverLife(FParticleSoAData& Data, int32 Num, const FVector& MinScale, const FVector& MaxScale, bool bUseRange, bool bUniform)
+{
+    float* SizeX = Data.Get(EParticleStream::SizeX);
+    float* SizeY = Data.Get(EParticleStream::SizeY);
+    float* SizeZ = Data.Get(EParticleStream::SizeZ);
+    const float* BaseSizeX = Data.Get(EParticleStream::BaseSizeX);
+    const float* BaseSizeY = Data.Get(EParticleStream::BaseSizeY);
+    const float* BaseSizeZ = Data.Get(EParticleStream::BaseSizeZ);
+    const float* RelTime = Data.Get(EParticleStream::RelativeTime);
+
+    // 균일 크기면 X 배율 하나로 모든 축을 스케일
+    const FVector Min = bUniform ? FVector(MinScale.X, MinScale.X, MinScale.X) : MinScale;
+    const FVector Delta = bUseRange
+        ? (bUniform ? FVector(MaxScale.X - MinScale.X, MaxScale.X - MinScale.X, MaxScale.X - MinScale.X) : MaxScale - MinScale)
+        : FVector::Zero();
+
+    const FSimdFloat MinX = SimdSet1(Min.X), MinY = SimdSet1(Min.Y), MinZ = SimdSet1(Min.Z);
+    const FSimdFloat DeltaX = SimdSet1(Delta.X), DeltaY = SimdSet1(Delta.Y), DeltaZ = SimdSet1(Delta.Z);
+    const int32 Padded = RoundUpToSimd(Num);
+
+    for (int32 i = 0; i < Padded; i += LaneCount)
+    {
+        const FSimdFloat T = SimdLoad(RelTime + i);
+        SimdStore(SizeX + i, SimdMul(SimdLoad(BaseSizeX + i), SimdAdd(MinX, SimdMul(DeltaX, T))));
+        SimdStore(SizeY + i, SimdMul(SimdLoad(BaseSizeY + i), SimdAdd(MinY, SimdMul(DeltaY, T))));
+        SimdStore(SizeZ + i, SimdMul(SimdLoad(BaseSizeZ + i), SimdAdd(MinZ, SimdMul(DeltaZ, T))));
+    }
+}
+
+void ParticleSoAKernels::SizeMultiplyLife(FParticleSoAData& Data, int32 Num, float Time1, const FVector& Value1, float Time2, const FVector& Value2,
+    bool bMultiplyX, bool bMultiplyY, bool bMultiplyZ)
+{
+    float* SizeX = Data.Get(EParticleStream::SizeX);
+    float* SizeY = Data.Get(EParticleStream::SizeY);
+    float* SizeZ = Data.Get(EParticleStream::SizeZ);
+    const float* BaseSizeX = Data.Get(EParticleStream::BaseSizeX);
+    const float* BaseSizeY = Data.Get(EParticleStream::BaseSizeY);
+    const float* BaseSizeZ = Data.Get(EParticleStream::BaseSizeZ);
+    const float* RelTime = Data.Get(EParticleStream::RelativeTime);
+    const float* OneOverLife = Data.Get(EParticleStream::OneOverMaxLifetime);
+    const int32 Padded = RoundUpToSimd(Num);
+
+    for (int32 i = 0; i < Padded; i += LaneCount)
+    {
+        // 절대 나이 = RelativeTime * Lifetime (Lifetime = 1 / OneOverMaxLifetime)
+        const FSimdFloat T = SimdDiv(SimdLoad(RelTime + i), SimdLoad(OneOverLife + i));
+
+        const FSimdFloat BaseX = SimdLoad(BaseSizeX + i);
+        const FSimdFloat BaseY = SimdLoad(BaseSizeY + i);
+        const FSimdFloat BaseZ = SimdLoad(BaseSizeZ + i);
+
+        SimdStore(SizeX + i, bMultiplyX ? SimdMul(BaseX, EvaluateTwoPoint(T, Time1, Value1.X, Time2, Value2.X)) : BaseX);
+        SimdStore(SizeY + i, bMultiplyY ? SimdMul(BaseY, EvaluateTwoPoint(T, Time1, Value1.Y, Time2, Value2.Y)) : BaseY);
+        SimdStore(SizeZ + i, bMultiplyZ ? SimdMul(BaseZ, EvaluateTwoPoint(T, Time1, Value1.Z, Time2, Value2.Z)) : BaseZ);
+    }
+}
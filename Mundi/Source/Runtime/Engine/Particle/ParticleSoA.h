@@ -0,0 +1,77 @@
+﻿#pragma once
+
+// SoA 스트림 종류 (FBaseParticle 중 시뮬레이션이 매 프레임 건드리는 필드만)
+enum class EParticleStream : uint8
+{
+    LocationX, LocationY, LocationZ,
+    OldLocationX, OldLocationY, OldLocationZ,
+    VelocityX, VelocityY, VelocityZ,
+    SizeX, SizeY, SizeZ,
+    BaseSizeX, BaseSizeY, BaseSizeZ,
+    ColorR, ColorG, ColorB, ColorA,
+    RelativeTime,
+    OneOverMaxLifetime,
+
+    Count
+};
+
+/**
+ * Structure-of-Arrays 파티클 스트림
+ * - 위치/속도/크기/색/수명을 성분별 연속 float 배열로 들고 있어 SIMD 커널이 필요한 캐시 라인만 읽는다
+ * - 모듈 Payload와 나머지 필드는 기존 AoS 버퍼(ParticleData)가 계속 담당 (렌더 데이터도 AoS 기준)
+ * - 용량은 SIMD 폭의 배수로 잡아서 커널이 꼬리 처리 없이 끝까지 돌 수 있다
+ */
+struct FParticleSoAData
+{
+    /** SIMD 한 번에 처리하는 float 수 (AVX 8, SSE 4) */
+    static constexpr int32 SimdWidth = 8;
+
+    float* Streams[static_cast<int32>(EParticleStream::Count)] = {};
+    float* Buffer = nullptr;
+    int32 Capacity = 0;
+
+    void Allocate(int32 MaxParticles);
+    void Free();
+    bool IsAllocated() const { return Buffer != nullptr; }
+
+    float* Get(EParticleStream Stream) const { return Streams[static_cast<int32>(Stream)]; }
+
+    /** AoS [Begin, End) 구간의 핫 필드를 SoA로 옮긴다 (Spawn 직후, AoS 전용 모듈 실행 후) */
+    void LoadFromAoS(const uint8* ParticleData, int32 Stride, int32 Begin, int32 End);
+    /** SoA [Begin, End) 구간을 AoS에 되돌려 쓴다 (AoS 전용 모듈 실행 전, 렌더 데이터 생성 전) */
+    void StoreToAoS(uint8* ParticleData, int32 Stride, int32 Begin, int32 End) const;
+
+    /** Swap & Pop용 단일 원소 이동 */
+    void Move(int32 FromIndex, int32 ToIndex);
+    /** 압축 패스용 구간 이동 [FromIndex, FromIndex + Count) → ToIndex (ToIndex <= FromIndex) */
+    void MoveRange(int32 FromIndex, int32 ToIndex, int32 Count);
+};
+
+// SoA 스트림 위에서 도는 SIMD 커널들 (Num 이후의 패딩 영역도 같이 계산하지만 결과는 버려진다)
+namespace ParticleSoAKernels
+{
+    /** OldLocation = Location, Location += Velocity * DeltaTime, RelativeTime += OneOverMaxLifetime * DeltaTime */
+    void IntegrateAndAge(FParticleSoAData& Data, int32 Num, float DeltaTime);
+
+    /** Velocity 모듈: OldLocation = Location, Velocity += Gravity * Dt, Damping 적용 후 Location += Velocity * Dt */
+    void ApplyVelocity(FParticleSoAData& Data, int32 Num, const FVector& Gravity, float Damping, float DeltaTime);
+
+    /**
+     * RelativeTime >= 1 인 파티클을 64개 단위 비트마스크로 기록하고 죽은 수를 반환
+     * @param OutDeadMask (Num + 63) / 64 개 이상의 워드. [0, Num) 구간 워드는 덮어쓰고 Num 이후 비트는 0
+     */
+    int32 BuildExpiredMask(const FParticleSoAData& Data, int32 Num, uint64* OutDeadMask);
+
+    /** Color.RGB = Min + (Max - Min) * RelativeTime (bUseRange가 false면 Min 고정) */
+    void ColorOverLife(FParticleSoAData& Data, int32 Num, const FLinearColor& MinColor, const FLinearColor& MaxColor, bool bUseRange);
+
+    /** Size = BaseSize * Lerp(Min, Max, RelativeTime). bUniform이면 X 배율을 모든 축에 사용 */
+    void SizeOverLife(FParticleSoAData& Data, int32 Num, const FVector& MinScale, const FVector& MaxScale, bool bUseRange, bool bUniform);
+
+    /** 2-point 커브: t < T1 → V1, t >= T2 → V2, 그 사이는 선형 보간 */
+    void AlphaOverLife(FParticleSoAData& Data, int32 Num, float Time1, float Value1, float Time2, float Value2);
+
+    /** Size = BaseSize * 2-point 커브(절대 나이). 축별 플래그가 꺼져 있으면 BaseSize 그대로 */
+    void SizeMultiplyLife(FParticleSoAData& Data, int32 Num, float Time1, const FVector& Value1, float Time2, const FVector& Value2,
+        bool bMultiplyX, bool bMultiplyY, bool bMultiplyZ);
+}
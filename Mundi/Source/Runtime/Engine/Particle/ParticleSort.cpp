@@ -0,0 +1,167 @@
+#include "pch.h"
+#include "ParticleSort.h"
+
+namespace
+{
+    // Job 워커마다 하나씩 (이미터 Job들이 동시에 정렬하므로 공유하지 않는다)
+    struct FParticleSortScratch
+    {
+        TArray<uint32> Keys[2];
+        TArray<int32> Indices;
+        TArray<uint8> Seen;
+    };
+    thread_local FParticleSortScratch GSortScratch;
+
+    constexpr int32 RadixBits = 8;
+    constexpr int32 RadixBuckets = 1 << RadixBits;
+    constexpr int32 RadixPasses = 32 / RadixBits;
+}
+
+EParticleSortAlgorithm ParticleSort::SortDescending(const float* Keys, int32 Num, const TArray<int32>& PreviousOrder, TArray<int32>& OutIndices)
+{
+    if (Num <= 0)
+    {
+        OutIndices.Empty();
+        return EParticleSortAlgorithm::None;
+    }
+
+    const bool bHasPreviousOrder = !PreviousOrder.IsEmpty();
+    if (Num <= InsertionSortMaxParticles || (bHasPreviousOrder && Num <= CoherentSortMaxParticles))
+    {
+        // 지난 프레임 순서 중 아직 유효한 인덱스를 먼저, 새로 생긴 인덱스는 뒤에 붙인다
+        OutIndices.SetNum(Num);
+        TArray<uint8>& Seen = GSortScratch.Seen;
+        Seen.SetNum(Num);
+        memset(Seen.GetData(), 0, static_cast<SIZE_T>(Num));
+
+        int32 Count = 0;
+        for (int32 Index : PreviousOrder)
+        {
+            if (Index >= 0 && Index < Num && !Seen[Index])
+            {
+                Seen[Index] = 1;
+                OutIndices[Count++] = Index;
+            }
+        }
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            if (!Seen[Index])
+            {
+                OutIndices[Count++] = Index;
+            }
+        }
+
+        const int64 MaxShifts = (Num <= InsertionSortMaxParticles)
+            ? INT64_MAX
+            : static_cast<int64>(Num) * InsertionShiftBudgetPerParticle;
+        if (InsertionSortDescending(Keys, OutIndices, MaxShifts))
+        {
+            return EParticleSortAlgorithm::Insertion;
+        }
+    }
+
+    RadixSortDescending(Keys, Num, OutIndices);
+    return EParticleSortAlgorithm::Radix;
+}
+
+bool ParticleSort::InsertionSortDescending(const float* Keys, TArray<int32>& InOutIndices, int64 MaxShifts)
+{
+    const int32 Num = InOutIndices.Num();
+    int32* Indices = InOutIndices.GetData();
+    int64 Shifts = 0;
+
+    for (int32 i = 1; i < Num; ++i)
+    {
+        const int32 Current = Indices[i];
+        const float CurrentKey = Keys[Current];
+
+        int32 j = i - 1;
+        while (j >= 0 && Keys[Indices[j]] < CurrentKey)
+        {
+            Indices[j + 1] = Indices[j];
+            --j;
+        }
+        Indices[j + 1] = Current;
+
+        Shifts += (i - 1) - j;
+        if (Shifts > MaxShifts)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ParticleSort::RadixSortDescending(const float* Keys, int32 Num, TArray<int32>& OutIndices)
+{
+    OutIndices.SetNum(Num);
+    if (Num <= 1)
+    {
+        if (Num == 1) { OutIndices[0] = 0; }
+        return;
+    }
+
+    TArray<uint32>& SrcKeys = GSortScratch.Keys[0];
+    TArray<uint32>& DstKeys = GSortScratch.Keys[1];
+    TArray<int32>& DstIndices = GSortScratch.Indices;
+    SrcKeys.SetNum(Num);
+    DstKeys.SetNum(Num);
+    DstIndices.SetNum(Num);
+
+    // 1) 키 변환 + 모든 pass의 히스토그램을 한 번에 계산
+    //    내림차순이므로 키를 비트 반전해서 오름차순으로 정렬한다 (안정 정렬 유지)
+    uint32 Histograms[RadixPasses][RadixBuckets] = {};
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const uint32 Key = ~FloatToSortableKey(Keys[i]);
+        SrcKeys[i] = Key;
+        OutIndices[i] = i;
+        for (int32 Pass = 0; Pass < RadixPasses; ++Pass)
+        {
+            ++Histograms[Pass][(Key >> (Pass * RadixBits)) & (RadixBuckets - 1)];
+        }
+    }
+
+    uint32* KeysIn = SrcKeys.GetData();
+    uint32* KeysOut = DstKeys.GetData();
+    int32* IndicesIn = OutIndices.GetData();
+    int32* IndicesOut = DstIndices.GetData();
+
+    for (int32 Pass = 0; Pass < RadixPasses; ++Pass)
+    {
+        uint32* Histogram = Histograms[Pass];
+        const int32 Shift = Pass * RadixBits;
+
+        // 모든 키가 같은 버킷이면 이 자리수는 순서를 바꾸지 않으므로 건너뛴다 (깊이 키는 상위 바이트가 자주 같음)
+        if (Histogram[(KeysIn[0] >> Shift) & (RadixBuckets - 1)] == static_cast<uint32>(Num))
+        {
+            continue;
+        }
+
+        // Exclusive prefix sum → 버킷별 시작 위치
+        uint32 Offset = 0;
+        for (int32 Bucket = 0; Bucket < RadixBuckets; ++Bucket)
+        {
+            const uint32 Count = Histogram[Bucket];
+            Histogram[Bucket] = Offset;
+            Offset += Count;
+        }
+
+        for (int32 i = 0; i < Num; ++i)
+        {
+            const uint32 Key = KeysIn[i];
+            const uint32 Dest = Histogram[(Key >> Shift) & (RadixBuckets - 1)]++;
+            KeysOut[Dest] = Key;
+            IndicesOut[Dest] = IndicesIn[i];
+        }
+
+        std::swap(KeysIn, KeysOut);
+        std::swap(IndicesIn, IndicesOut);
+    }
+
+    // 결과가 Scratch 쪽에 있으면 OutIndices로 복사
+    if (IndicesIn != OutIndices.GetData())
+    {
+        memcpy(OutIndices.GetData(), IndicesIn, static_cast<SIZE_T>(Num) * sizeof(int32));
+    }
+}
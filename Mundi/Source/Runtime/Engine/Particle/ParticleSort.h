@@ -0,0 +1,57 @@
+﻿#pragma once
+
+// 이번 프레임에 파티클 정렬에 실제로 쓰인 알고리즘 (통계 표시용)
+enum class EParticleSortAlgorithm : uint8
+{
+    None,
+    Insertion,  // 이전 프레임 순서에서 시작하는 삽입 정렬
+    Radix,      // 32-bit float 키 LSD Radix Sort
+};
+
+inline const char* GetParticleSortAlgorithmName(EParticleSortAlgorithm Algorithm)
+{
+    switch (Algorithm)
+    {
+    case EParticleSortAlgorithm::Insertion: return "Insertion";
+    case EParticleSortAlgorithm::Radix:     return "Radix";
+    default:                                return "None";
+    }
+}
+
+/**
+ * 파티클 깊이 정렬 (Back-to-front, 큰 키가 먼저)
+ * - 적은 수 / 이전 프레임과 순서가 거의 같은 경우: 이전 순서에서 시작하는 삽입 정렬
+ * - 많은 수 / 순서가 많이 바뀐 경우: float → 정렬 가능한 uint32 변환 후 8-bit 4 pass LSD Radix Sort
+ */
+namespace ParticleSort
+{
+    /** 이 수 이하면 이전 순서가 없어도 삽입 정렬 */
+    constexpr int32 InsertionSortMaxParticles = 64;
+    /** 이 수 이하에서만 이전 순서 기반 삽입 정렬을 시도 (그 이상은 바로 Radix) */
+    constexpr int32 CoherentSortMaxParticles = 4096;
+    /** 삽입 정렬이 파티클당 평균 이만큼 넘게 밀어내면 포기하고 Radix로 전환 */
+    constexpr int32 InsertionShiftBudgetPerParticle = 8;
+
+    /** IEEE float 비트를 부호 포함 대소 관계가 uint 비교와 같아지도록 뒤집는다 */
+    inline uint32 FloatToSortableKey(float Value)
+    {
+        uint32 Bits;
+        memcpy(&Bits, &Value, sizeof(uint32));
+        const uint32 Mask = (Bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u;
+        return Bits ^ Mask;
+    }
+
+    /**
+     * Keys 기준 내림차순으로 OutIndices를 채운다
+     * @param Keys          파티클별 정렬 키 (Num개)
+     * @param PreviousOrder 지난 프레임 정렬 결과 (없으면 빈 배열). Num 이상인 인덱스는 무시된다
+     * @return 실제로 사용한 알고리즘
+     */
+    EParticleSortAlgorithm SortDescending(const float* Keys, int32 Num, const TArray<int32>& PreviousOrder, TArray<int32>& OutIndices);
+
+    /** 이전 순서에서 시작하는 삽입 정렬. 밀어낸 횟수가 MaxShifts를 넘으면 false (OutIndices는 정렬이 안 끝난 상태) */
+    bool InsertionSortDescending(const float* Keys, TArray<int32>& InOutIndices, int64 MaxShifts);
+
+    /** 안정 LSD Radix Sort (내림차순) */
+    void RadixSortDescending(const float* Keys, int32 Num, TArray<int32>& OutIndices);
+}
@@ -1,4 +1,20 @@
 #pragma once
+#include "ParticleSort.h"
+
+class UParticleEmitter;
+
+// --------------------------------------------------------
+// [통계 구조체] 이미터 하나의 파티클 정렬 결과
+// --------------------------------------------------------
+struct FParticleEmitterSortStat
+{
+    // 포인터만 보관하고 이름은 오버레이가 그릴 때 조회 (매 프레임 FString 생성 방지)
+    UParticleEmitter* Emitter = nullptr;
+
+    uint32 NumParticles = 0;
+    double SortTimeMs = 0.0;
+    EParticleSortAlgorithm Algorithm = EParticleSortAlgorithm::None;
+};
 // --------------------------------------------------------
 // [통계 구조체] 파티클 시스템 현황
 // --------------------------------------------------------
@@ -10,11 +26,35 @@ struct FParticleStats
     // 2. DrawCall (생성된 MeshBatch 수)
     uint32 DrawCalls = 0;
 
+    // 3. 깊이 정렬 (이미터별 + 합계)
+    double TotalSortTimeMs = 0.0;
+    TArray<FParticleEmitterSortStat> EmitterSorts;
+
+    // 4. 파티클 프레임의 힙 할당 횟수 (풀이 데워진 뒤에는 0이어야 정상)
+    //    렌더 페이로드/DataContainer + Job 객체/의존성 배열 (컴포넌트별 Job 풀 미스)
+    uint32 HeapAllocations = 0;
 
     void Reset()
     {
         TotalActiveParticles = 0;
         DrawCalls = 0;
+        TotalSortTimeMs = 0.0;
+        EmitterSorts.Empty();
+        HeapAllocations = 0;
+    }
+
+    /** 정렬 시간이 가장 긴 이미터 (없으면 nullptr) */
+    const FParticleEmitterSortStat* FindSlowestSort() const
+    {
+        const FParticleEmitterSortStat* Slowest = nullptr;
+        for (const FParticleEmitterSortStat& Stat : EmitterSorts)
+        {
+            if (!Slowest || Stat.SortTimeMs > Slowest->SortTimeMs)
+            {
+                Slowest = &Stat;
+            }
+        }
+        return Slowest;
     }
 };
 
@@ -36,6 +76,12 @@ public:
     // 데이터 누적 (여러 컴포넌트가 있을 수 있으므로 +=)
     void AddParticleCount(uint32 Count) { CurrentStats.TotalActiveParticles += Count; }
     void AddDrawCalls(uint32 Count)     { CurrentStats.DrawCalls += Count; }
+    void AddHeapAllocations(uint32 Count) { CurrentStats.HeapAllocations += Count; }
+    void AddEmitterSortStat(const FParticleEmitterSortStat& Stat)
+    {
+        CurrentStats.TotalSortTimeMs += Stat.SortTimeMs;
+        CurrentStats.EmitterSorts.Add(Stat);
+    }
 
     const FParticleStats& GetStats() const { return CurrentStats; }
 
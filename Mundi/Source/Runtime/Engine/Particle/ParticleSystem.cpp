@@ -1,6 +1,8 @@
 ﻿#include "pch.h"
 #include "ParticleSystem.h"
 #include "ParticleEmitter.h"
+#include "ParticleLODLevel.h"
+#include "Modules/ParticleModuleCollision.h"
 #include "JsonSerializer.h"
 #include <fstream>
 
@@ -36,6 +38,26 @@ void UParticleSystem::BuildRuntimeCache()
     }
 }
 
+bool UParticleSystem::HasCollisionModule() const
+{
+    for (UParticleEmitter* Emitter : Emitters)
+    {
+        if (!Emitter) continue;
+        for (UParticleLODLevel* LODLevel : Emitter->LODLevels)
+        {
+            if (!LODLevel) continue;
+            for (UParticleModule* Module : LODLevel->UpdateModules)
+            {
+                if (Module && Module->bEnabled && Cast<UParticleModuleCollision>(Module))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
 UParticleEmitter* UParticleSystem::AddEmitter(UClass* EmitterClass)
 {
     if (EmitterClass->IsChildOf(UParticleEmitter::StaticClass()))
@@ -107,6 +129,7 @@ void UParticleSystem::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         {
             ObjectName = FName(NameStr);
         }
+        FJsonSerializer::ReadFloat(InOutHandle, "CollisionQueryRadius", CollisionQueryRadius, 1000.0f, false);
 
         // Emitters 배열 로드
         if (InOutHandle.hasKey("Emitters"))
@@ -136,6 +159,7 @@ void UParticleSystem::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         // =========================================================
         InOutHandle["Type"] = "ParticleSystem";
         InOutHandle["Name"] = ObjectName.ToString();
+        InOutHandle["CollisionQueryRadius"] = CollisionQueryRadius;
 
         // Emitters 배열 저장
         JSON EmittersArray = JSON::Make(JSON::Class::Array);
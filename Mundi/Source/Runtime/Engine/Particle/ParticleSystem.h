@@ -24,6 +24,12 @@ public:
     int32 MaxActiveParticles = 0;
     float MaxLifetime = 0.f;
 
+    /** 파티클 충돌용 콜라이더를 모을 반경 (컴포넌트 위치 기준 박스의 절반 크기) */
+    float CollisionQueryRadius = 1000.0f;
+
+    /** 활성화된 Collision 모듈이 있는 이미터가 하나라도 있는지 */
+    bool HasCollisionModule() const;
+
 // Add Section
     UParticleEmitter* AddEmitter(UClass* EmitterClass);
     
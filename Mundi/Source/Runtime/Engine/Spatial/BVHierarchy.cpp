@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include <algorithm>
+#include <bit>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -45,6 +46,20 @@ namespace {
         outTMax = tmax;
         return true;
     }
+
+    inline double SurfaceArea(const FAABB& Box)
+    {
+        const double Dx = std::max(0.0f, Box.Max.X - Box.Min.X);
+        const double Dy = std::max(0.0f, Box.Max.Y - Box.Min.Y);
+        const double Dz = std::max(0.0f, Box.Max.Z - Box.Min.Z);
+        return 2.0 * (Dx * Dy + Dy * Dz + Dz * Dx);
+    }
+
+    inline bool IsSameBounds(const FAABB& A, const FAABB& B)
+    {
+        return A.Min.X == B.Min.X && A.Min.Y == B.Min.Y && A.Min.Z == B.Min.Z
+            && A.Max.X == B.Max.X && A.Max.Y == B.Max.Y && A.Max.Z == B.Max.Z;
+    }
 }
 
 FBVHierarchy::FBVHierarchy(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
@@ -62,12 +77,22 @@ FBVHierarchy::~FBVHierarchy()
 
 void FBVHierarchy::Clear()
 {
+    // 진행 중인 백그라운드 빌드는 결과만 버린다 (Job은 자기 스냅샷만 만지므로 기다릴 필요 없음)
+    CancelBackgroundRebuild();
+
     // NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
     StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
+    SlotBounds = TArray<FAABB>();
     Nodes = TArray<FLBVHNode>();
+    ComponentSlots = TMap<UPrimitiveComponent*, int32>();
+    SlotLeaves = TArray<int32>();
+    NumTombstones = 0;
+    PendingInserts = TArray<UPrimitiveComponent*>();
+    PendingRefitLeaves = TArray<int32>();
+    WeightedAreaSum = 0.0;
+    BuiltCost = 0.0f;
     Bounds = FAABB();
-    bPendingRebuild = false;
 }
 
 void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
@@ -83,7 +108,21 @@ void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
     // Level 복사 등으로 다량의 컴포넌트를 한 번에 넣는 상황 전제
     // 일반적인 update에서 budget 단위로 끊어 갱신되는 로직 우회해 강제 rebuild
     BuildLBVH();
-    bPendingRebuild = false;
+}
+
+void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components, const TArray<FAABB>& ComponentBounds)
+{
+    for (int32 i = 0; i < Components.Num() && i < ComponentBounds.Num(); ++i)
+    {
+        if (Components[i])
+        {
+            StaticMeshComponentBounds.Add(Components[i], ComponentBounds[i]);
+        }
+    }
+
+    // Level 복사 등으로 다량의 컴포넌트를 한 번에 넣는 상황 전제
+    // 일반적인 update에서 budget 단위로 끊어 갱신되는 로직 우회해 강제 rebuild
+    BuildLBVH();
 }
 
 void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
@@ -99,10 +138,32 @@ void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
         return;
     }
 
-    const FAABB WorldBounds = InComponent->GetWorldAABB();
+    Update(InComponent, InComponent->GetWorldAABB());
+}
+
+void FBVHierarchy::Update(UPrimitiveComponent* InComponent, const FAABB& WorldBounds)
+{
+    if (!InComponent)
+    {
+        return;
+    }
 
     StaticMeshComponentBounds.Add(InComponent, WorldBounds);
-    bPendingRebuild = true;
+    if (PendingBuild)
+    {
+        ChangedDuringBuild.insert(InComponent);
+    }
+
+    // 이미 트리에 있으면 자기 리프만 Refit, 처음 보는 컴포넌트는 삽입 대기
+    if (const int32* Slot = ComponentSlots.Find(InComponent))
+    {
+        SlotBounds[*Slot] = WorldBounds;
+        PendingRefitLeaves.Add(SlotLeaves[*Slot]);
+    }
+    else
+    {
+        PendingInserts.Add(InComponent);
+    }
 }
 
 void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
@@ -112,65 +173,140 @@ void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
         return;
     }
 
-    if (StaticMeshComponentBounds.Find(InComponent))
+    if (StaticMeshComponentBounds.Remove(InComponent))
     {
-        StaticMeshComponentBounds.Remove(InComponent);
-        bPendingRebuild = true;
+        if (PendingBuild)
+        {
+            ChangedDuringBuild.insert(InComponent);
+        }
+        TombstoneComponent(InComponent);
+    }
+}
+
+void FBVHierarchy::TombstoneComponent(UPrimitiveComponent* InComponent)
+{
+    const int32* Slot = ComponentSlots.Find(InComponent);
+    if (!Slot)
+    {
+        return;
     }
+
+    // 슬롯은 비워만 두고 리프 범위는 그대로 (쿼리는 nullptr 슬롯을 건너뛴다)
+    const int32 SlotIdx = *Slot;
+    ComponentSlots.Remove(InComponent);
+    StaticMeshComponentArray[SlotIdx] = nullptr;
+    ++NumTombstones;
+    PendingRefitLeaves.Add(SlotLeaves[SlotIdx]);
 }
 
 void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
 {
-    if (Nodes.empty()) return;
-    //프러스텀 외부에 바운드 존재
-    if (!IsAABBVisible(InFrustum, Nodes[0].Bounds)) return;
-    //프러스텀 내부에 바운드 존재 (교차 X)
-    if (!IsAABBIntersects(InFrustum, Nodes[0].Bounds))
+    TArray<UPrimitiveComponent*> VisibleComponents;
+    QueryFrustumComponents(InFrustum, VisibleComponents);
+
+    for (UPrimitiveComponent* Component : VisibleComponents)
     {
-        for (UPrimitiveComponent* Component : StaticMeshComponentArray)
+        if (AActor* Owner = Component->GetOwner())
         {
-            if (!Component) continue;
-            if (StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
-                continue;
-            if (AActor* Owner = Component->GetOwner())
-            {
-                Owner->SetCulled(false);
-            }
+            Owner->SetCulled(false);
         }
-        return;
     }
-    //프러스텀과 바운드가 교차
-    TArray<int32> IdxStack;
-    IdxStack.push_back({ 0 });
+}
 
-    while (!IdxStack.empty())
+void FBVHierarchy::QueryFrustumComponents(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutComponents) const
+{
+    if (Nodes.empty()) return;
+
+    // 노드 분류도 같은 SSE 함수 사용 (남는 레인은 같은 박스로 채우고 결과는 무시)
+    uint8 RootInside = 0;
+    const FAABB RootBox[4] = { Nodes[0].Bounds, Nodes[0].Bounds, Nodes[0].Bounds, Nodes[0].Bounds };
+    if (!(ClassifyAABBs_4_SSE(InFrustum, RootBox, RootInside) & 1)) return;
+
+    // bInside: 조상이 이미 프러스텀 안에 완전히 들어와 있어 더 판정할 필요 없음
+    struct FStackEntry
     {
-        int32 Idx = IdxStack.back();
-        IdxStack.pop_back();
-        const FLBVHNode& node = Nodes[Idx];
-        if (node.IsLeaf())
+        int32 Idx;
+        bool bInside;
+    };
+    TArray<FStackEntry> Stack;
+    Stack.Reserve(64);
+    Stack.push_back({ 0, (RootInside & 1) != 0 });
+
+    while (!Stack.empty())
+    {
+        const FStackEntry Entry = Stack.back();
+        Stack.pop_back();
+        const FLBVHNode& Node = Nodes[Entry.Idx];
+
+        if (Node.IsLeaf())
         {
-            for (int32 i = 0; i < node.Count; ++i)
+            if (Entry.bInside)
             {
-                UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
-                    continue;
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                if (IsAABBVisible(InFrustum, Box))
+                for (int32 i = 0; i < Node.Count; ++i)
+                {
+                    if (UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i])
+                    {
+                        OutComponents.Add(Component);
+                    }
+                }
+                continue;
+            }
+
+            // 리프 슬롯의 AABB는 연속이므로 4개씩 바로 읽는다 (꼬리는 마지막 박스로 채움)
+            for (int32 Base = 0; Base < Node.Count; Base += 4)
+            {
+                const int32 First = Node.First + Base;
+                const int32 NumInGroup = std::min(4, Node.Count - Base);
+
+                uint8 InsideMask = 0;
+                uint32 VisibleMask = 0;
+                if (NumInGroup == 4)
+                {
+                    VisibleMask = ClassifyAABBs_4_SSE(InFrustum, &SlotBounds[First], InsideMask);
+                }
+                else
+                {
+                    FAABB Padded[4];
+                    for (int32 k = 0; k < 4; ++k)
+                    {
+                        Padded[k] = SlotBounds[First + std::min(k, NumInGroup - 1)];
+                    }
+                    VisibleMask = ClassifyAABBs_4_SSE(InFrustum, Padded, InsideMask) & ((1u << NumInGroup) - 1);
+                }
+
+                while (VisibleMask)
                 {
-                    if (AActor* Owner = Component->GetOwner())
+                    const int32 k = std::countr_zero(VisibleMask);
+                    VisibleMask &= VisibleMask - 1;
+                    if (UPrimitiveComponent* Component = StaticMeshComponentArray[First + k])
                     {
-                        Owner->SetCulled(false);
+                        OutComponents.Add(Component);
                     }
                 }
             }
             continue;
         }
-        if (node.Left >= 0 && IsAABBVisible(InFrustum, Nodes[node.Left].Bounds))
-            IdxStack.push_back({ node.Left });
-        if (node.Right >= 0 && IsAABBVisible(InFrustum, Nodes[node.Right].Bounds))
-            IdxStack.push_back({ node.Right });
+
+        if (Entry.bInside)
+        {
+            Stack.push_back({ Node.Left, true });
+            Stack.push_back({ Node.Right, true });
+            continue;
+        }
+
+        const FAABB& LeftBounds = Nodes[Node.Left].Bounds;
+        const FAABB& RightBounds = Nodes[Node.Right].Bounds;
+        const FAABB ChildBounds[4] = { LeftBounds, RightBounds, LeftBounds, RightBounds };
+        uint8 ChildInside = 0;
+        const uint8 ChildVisible = ClassifyAABBs_4_SSE(InFrustum, ChildBounds, ChildInside);
+        if (ChildVisible & 1)
+        {
+            Stack.push_back({ Node.Left, (ChildInside & 1) != 0 });
+        }
+        if (ChildVisible & 2)
+        {
+            Stack.push_back({ Node.Right, (ChildInside & 2) != 0 });
+        }
     }
 }
 
@@ -225,7 +361,18 @@ int FBVHierarchy::TotalNodeCount() const
 
 int FBVHierarchy::TotalActorCount() const
 {
-    return static_cast<int>(StaticMeshComponentArray.size());
+    return static_cast<int>(StaticMeshComponentArray.size()) - NumTombstones;
+}
+
+float FBVHierarchy::GetSAHCost() const
+{
+    if (Nodes.empty())
+    {
+        return 0.0f;
+    }
+
+    const double RootArea = SurfaceArea(Nodes[0].Bounds);
+    return RootArea > 0.0 ? static_cast<float>(WeightedAreaSum / RootArea) : 0.0f;
 }
 
 int FBVHierarchy::MaxOccupiedDepth() const
@@ -237,14 +384,15 @@ void FBVHierarchy::DebugDump() const
 {
     UE_LOG("===== BVHierachy (LBVH) DUMP BEGIN =====\r\n");
     char buf[256];
-    std::snprintf(buf, sizeof(buf), "nodes=%zu, components=%zu\r\n", Nodes.size(), StaticMeshComponentArray.size());
+    std::snprintf(buf, sizeof(buf), "nodes=%zu, slots=%zu, tombstones=%d, sah=%.2f (built %.2f)\r\n",
+        Nodes.size(), StaticMeshComponentArray.size(), NumTombstones, GetSAHCost(), BuiltCost);
     UE_LOG(buf);
     for (size_t i = 0; i < Nodes.size(); ++i)
     {
         const auto& n = Nodes[i];
         std::snprintf(buf, sizeof(buf),
-            "[%zu] L=%d R=%d F=%d C=%d | [(%.1f,%.1f,%.1f)-(%.1f,%.1f,%.1f)]\r\n",
-            i, n.Left, n.Right, n.First, n.Count,
+            "[%zu] P=%d L=%d R=%d F=%d C=%d | [(%.1f,%.1f,%.1f)-(%.1f,%.1f,%.1f)]\r\n",
+            i, n.Parent, n.Left, n.Right, n.First, n.Count,
             n.Bounds.Min.X, n.Bounds.Min.Y, n.Bounds.Min.Z,
             n.Bounds.Max.X, n.Bounds.Max.Y, n.Bounds.Max.Z);
         UE_LOG(buf);
@@ -271,134 +419,333 @@ namespace
 
 void FBVHierarchy::BuildLBVH()
 {
-    StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
-    const int N = StaticMeshComponentArray.Num();
-    Nodes = TArray<FLBVHNode>();
+    // 동기 전체 빌드가 진행 중인 백그라운드 빌드보다 항상 최신
+    CancelBackgroundRebuild();
 
-    if (N == 0)
-    {
-        Bounds = FAABB();
-        return;
-    }
+    FBuildData Data;
+    SnapshotBuildInput(Data);
+    BuildTree(Data, MaxObjects);
+    AdoptBuild(Data);
+}
 
-    bool bHasBounds = false;
+void FBVHierarchy::SnapshotBuildInput(FBuildData& OutData) const
+{
+    OutData.Components.Reserve(StaticMeshComponentBounds.Num());
+    OutData.ComponentBounds.Reserve(StaticMeshComponentBounds.Num());
     for (const auto& Pair : StaticMeshComponentBounds)
     {
-        const FAABB& Bound = Pair.second;
-        if (!bHasBounds)
-        {
-            Bounds = Bound;
-            bHasBounds = true;
-        }
-        else
-        {
-            Bounds = FAABB::Union(Bounds, Bound);
-        }
+        OutData.Components.Add(Pair.first);
+        OutData.ComponentBounds.Add(Pair.second);
     }
+}
 
-    if (!bHasBounds)
+void FBVHierarchy::BuildTree(FBuildData& Data, int32 InMaxObjects)
+{
+    const int N = Data.Components.Num();
+    Data.Nodes = TArray<FLBVHNode>();
+    Data.Bounds = FAABB();
+
+    if (N == 0)
     {
-        Bounds = FAABB();
         return;
     }
 
-    TArray<uint32> Codes;
-    Codes.resize(N);
-    const FVector Min = Bounds.Min;
-    const FVector Extent = Bounds.GetHalfExtent();
-
-    for (int i = 0; i < N; ++i)
+    Data.Bounds = Data.ComponentBounds[0];
+    for (int i = 1; i < N; ++i)
     {
-        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
-        const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
-        const FVector Center = Bound ? Bound->GetCenter() : Component->GetWorldAABB().GetCenter();
-
-        const auto Normalize = [](float Value, float MinValue, float ExtHalf)
-            {
-                if (ExtHalf > 0.0f)
-                {
-                    return std::clamp((Value - MinValue) / (ExtHalf * 2.0f), 0.0f, 1.0f);
-                }
-                return 0.5f;
-            };
-
-        const float Nx = Normalize(Center.X, Min.X, Extent.X);
-        const float Ny = Normalize(Center.Y, Min.Y, Extent.Y);
-        const float Nz = Normalize(Center.Z, Min.Z, Extent.Z);
+        Data.Bounds = FAABB::Union(Data.Bounds, Data.ComponentBounds[i]);
+    }
 
-        const uint32 Ix = static_cast<uint32>(Nx * 1023.0f);
-        const uint32 Iy = static_cast<uint32>(Ny * 1023.0f);
-        const uint32 Iz = static_cast<uint32>(Nz * 1023.0f);
+    const FVector Min = Data.Bounds.Min;
+    const FVector Extent = Data.Bounds.GetHalfExtent();
 
-        Codes[i] = Morton3D(Ix, Iy, Iz);
-    }
+    const auto Normalize = [](float Value, float MinValue, float ExtHalf)
+        {
+            if (ExtHalf > 0.0f)
+            {
+                return std::clamp((Value - MinValue) / (ExtHalf * 2.0f), 0.0f, 1.0f);
+            }
+            return 0.5f;
+        };
 
-    TArray<std::pair<UPrimitiveComponent*, uint32>> ComponentCodePairs;
-    ComponentCodePairs.resize(N);
+    TArray<std::pair<uint32, int32>> CodeIndexPairs;
+    CodeIndexPairs.resize(N);
     for (int i = 0; i < N; ++i)
     {
-        ComponentCodePairs[i] = { StaticMeshComponentArray[i], Codes[i] };
+        const FVector Center = Data.ComponentBounds[i].GetCenter();
+
+        const uint32 Ix = static_cast<uint32>(Normalize(Center.X, Min.X, Extent.X) * 1023.0f);
+        const uint32 Iy = static_cast<uint32>(Normalize(Center.Y, Min.Y, Extent.Y) * 1023.0f);
+        const uint32 Iz = static_cast<uint32>(Normalize(Center.Z, Min.Z, Extent.Z) * 1023.0f);
+
+        CodeIndexPairs[i] = { Morton3D(Ix, Iy, Iz), i };
     }
 
-    std::sort(ComponentCodePairs.begin(), ComponentCodePairs.end(),
+    std::sort(CodeIndexPairs.begin(), CodeIndexPairs.end(),
         [](const auto& LHS, const auto& RHS)
         {
-            return LHS.second < RHS.second;
+            return LHS.first < RHS.first;
         });
 
+    TArray<UPrimitiveComponent*> SortedComponents;
+    TArray<FAABB> SortedBounds;
+    SortedComponents.resize(N);
+    SortedBounds.resize(N);
     for (int i = 0; i < N; ++i)
     {
-        StaticMeshComponentArray[i] = ComponentCodePairs[i].first;
+        SortedComponents[i] = Data.Components[CodeIndexPairs[i].second];
+        SortedBounds[i] = Data.ComponentBounds[CodeIndexPairs[i].second];
     }
+    Data.Components = std::move(SortedComponents);
+    Data.ComponentBounds = std::move(SortedBounds);
 
-    Nodes.reserve(std::max(1, 2 * N));
-    Nodes.clear();
-    BuildRange(0, N);
+    Data.Nodes.reserve(std::max(1, 2 * N));
+    BuildRange(Data, std::max(InMaxObjects, 1), 0, N, -1);
 }
 
-int FBVHierarchy::BuildRange(int s, int e)
+int32 FBVHierarchy::BuildRange(FBuildData& Data, int32 InMaxObjects, int32 s, int32 e, int32 Parent)
 {
-    int nodeIdx = static_cast<int>(Nodes.size());
-    Nodes.push_back(FLBVHNode{});
-    FLBVHNode& node = Nodes[nodeIdx];
+    const int32 nodeIdx = static_cast<int32>(Data.Nodes.size());
+    Data.Nodes.push_back(FLBVHNode{});
+    Data.Nodes[nodeIdx].Parent = Parent;
 
-    int count = e - s;
-    if (count <= MaxObjects)
+    const int32 count = e - s;
+    if (count <= InMaxObjects)
     {
+        FAABB Accumulated = Data.ComponentBounds[s];
+        for (int32 i = s + 1; i < e; ++i)
+        {
+            Accumulated = FAABB::Union(Accumulated, Data.ComponentBounds[i]);
+        }
+
+        FLBVHNode& node = Data.Nodes[nodeIdx];
         node.First = s;
         node.Count = count;
-        bool bInitialized = false;
-        FAABB Accumulated;
-        for (int i = s; i < e; ++i)
+        node.Bounds = Accumulated;
+        return nodeIdx;
+    }
+
+    const int32 mid = (s + e) / 2;
+    const int32 L = BuildRange(Data, InMaxObjects, s, mid, nodeIdx);
+    const int32 R = BuildRange(Data, InMaxObjects, mid, e, nodeIdx);
+
+    // 재귀 중 push_back이 있었으므로 참조는 여기서 다시 얻는다
+    FLBVHNode& node = Data.Nodes[nodeIdx];
+    node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
+    node.Bounds = FAABB::Union(Data.Nodes[L].Bounds, Data.Nodes[R].Bounds);
+    return nodeIdx;
+}
+
+void FBVHierarchy::AdoptBuild(FBuildData& Data)
+{
+    StaticMeshComponentArray = std::move(Data.Components);
+    SlotBounds = std::move(Data.ComponentBounds);
+    Nodes = std::move(Data.Nodes);
+    Bounds = Data.Bounds;
+
+    ComponentSlots = TMap<UPrimitiveComponent*, int32>();
+    ComponentSlots.reserve(StaticMeshComponentArray.size());
+    for (int32 Slot = 0; Slot < StaticMeshComponentArray.Num(); ++Slot)
+    {
+        ComponentSlots.Add(StaticMeshComponentArray[Slot], Slot);
+    }
+
+    SlotLeaves.SetNum(StaticMeshComponentArray.Num(), INDEX_NONE);
+    for (int32 NodeIdx = 0; NodeIdx < Nodes.Num(); ++NodeIdx)
+    {
+        const FLBVHNode& Node = Nodes[NodeIdx];
+        for (int32 i = 0; i < Node.Count; ++i)
         {
-            UPrimitiveComponent* Component = StaticMeshComponentArray[i];
-            if (!Component)
-            {
-                continue;
-            }
+            SlotLeaves[Node.First + i] = NodeIdx;
+        }
+    }
 
-            const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
-            const FAABB LocalBound = Bound ? *Bound : Component->GetWorldAABB();
-            if (!bInitialized)
-            {
-                Accumulated = LocalBound;
-                bInitialized = true;
-            }
-            else
+    // 예전 트리 기준으로 쌓인 작업은 무효 (스냅샷 이후 변경분은 ChangedDuringBuild로 다시 들어온다)
+    NumTombstones = 0;
+    PendingInserts.Empty();
+    PendingRefitLeaves.Empty();
+
+    RecomputeCost();
+    BuiltCost = GetSAHCost();
+}
+
+void FBVHierarchy::KickBackgroundRebuild()
+{
+    std::shared_ptr<FBuildData> Data = std::make_shared<FBuildData>();
+    SnapshotBuildInput(*Data);
+
+    PendingBuild = Data;
+    ChangedDuringBuild.clear();
+
+    const int32 BuildMaxObjects = MaxObjects;
+    BuildHandle = FJobSystem::GetInstance().Submit([Data, BuildMaxObjects]()
+    {
+        BuildTree(*Data, BuildMaxObjects);
+    });
+}
+
+void FBVHierarchy::CancelBackgroundRebuild()
+{
+    PendingBuild.reset();
+    BuildHandle.Reset();
+    ChangedDuringBuild.clear();
+}
+
+void FBVHierarchy::InsertComponent(UPrimitiveComponent* InComponent, const FAABB& InBounds)
+{
+    const int32 Slot = StaticMeshComponentArray.Num();
+    StaticMeshComponentArray.Add(InComponent);
+    SlotBounds.Add(InBounds);
+    ComponentSlots.Add(InComponent, Slot);
+
+    FLBVHNode Leaf;
+    Leaf.Bounds = InBounds;
+    Leaf.First = Slot;
+    Leaf.Count = 1;
+
+    const int32 LeafIdx = Nodes.Num();
+    Nodes.Add(Leaf);
+    SlotLeaves.Add(LeafIdx);
+    WeightedAreaSum += GetNodeCostWeight(Leaf) * SurfaceArea(InBounds);
+
+    if (LeafIdx == 0)
+    {
+        Bounds = InBounds;
+        return;
+    }
+
+    // 1. 루트부터 합쳤을 때 면적이 덜 늘어나는 자식을 따라 내려가 형제가 될 리프를 찾는다
+    int32 SiblingIdx = 0;
+    while (!Nodes[SiblingIdx].IsLeaf())
+    {
+        const FLBVHNode& Node = Nodes[SiblingIdx];
+        const FAABB& LeftBounds = Nodes[Node.Left].Bounds;
+        const FAABB& RightBounds = Nodes[Node.Right].Bounds;
+        const double GrowLeft = SurfaceArea(FAABB::Union(LeftBounds, InBounds)) - SurfaceArea(LeftBounds);
+        const double GrowRight = SurfaceArea(FAABB::Union(RightBounds, InBounds)) - SurfaceArea(RightBounds);
+        SiblingIdx = (GrowLeft <= GrowRight) ? Node.Left : Node.Right;
+    }
+
+    // 2. 형제 자리에 (형제, 새 리프)를 자식으로 갖는 내부 노드를 끼워 넣는다
+    FLBVHNode NewParent;
+    NewParent.Bounds = FAABB::Union(Nodes[SiblingIdx].Bounds, InBounds);
+    NewParent.Right = LeafIdx;
+    WeightedAreaSum += GetNodeCostWeight(NewParent) * SurfaceArea(NewParent.Bounds);
+
+    if (SiblingIdx == 0)
+    {
+        // 쿼리는 항상 0번에서 시작하므로 기존 루트를 뒤로 옮기고 새 내부 노드를 0번에 둔다
+        const FLBVHNode OldRoot = Nodes[0];
+        const int32 MovedIdx = Nodes.Num();
+        Nodes.Add(OldRoot);
+        if (OldRoot.IsLeaf())
+        {
+            for (int32 i = 0; i < OldRoot.Count; ++i)
             {
-                Accumulated = FAABB::Union(Accumulated, LocalBound);
+                SlotLeaves[OldRoot.First + i] = MovedIdx;
             }
         }
-        node.Bounds = bInitialized ? Accumulated : Bounds;
-        return nodeIdx;
+        else
+        {
+            Nodes[OldRoot.Left].Parent = MovedIdx;
+            Nodes[OldRoot.Right].Parent = MovedIdx;
+        }
+
+        NewParent.Left = MovedIdx;
+        NewParent.Parent = -1;
+        Nodes[0] = NewParent;
+        Nodes[MovedIdx].Parent = 0;
+        Nodes[LeafIdx].Parent = 0;
+        Bounds = NewParent.Bounds;
+        return;
     }
 
-    int mid = (s + e) / 2;
-    int L = BuildRange(s, mid);
-    int R = BuildRange(mid, e);
-    node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
-    node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
-    return nodeIdx;
+    const int32 GrandParentIdx = Nodes[SiblingIdx].Parent;
+    const int32 NewParentIdx = Nodes.Num();
+    NewParent.Left = SiblingIdx;
+    NewParent.Parent = GrandParentIdx;
+    Nodes.Add(NewParent);
+
+    FLBVHNode& GrandParent = Nodes[GrandParentIdx];
+    if (GrandParent.Left == SiblingIdx)
+    {
+        GrandParent.Left = NewParentIdx;
+    }
+    else
+    {
+        GrandParent.Right = NewParentIdx;
+    }
+    Nodes[SiblingIdx].Parent = NewParentIdx;
+    Nodes[LeafIdx].Parent = NewParentIdx;
+
+    RefitAncestors(GrandParentIdx);
+}
+
+void FBVHierarchy::RefitLeaf(int32 NodeIdx)
+{
+    const FLBVHNode& Leaf = Nodes[NodeIdx];
+
+    bool bInitialized = false;
+    FAABB Accumulated;
+    for (int32 i = 0; i < Leaf.Count; ++i)
+    {
+        if (!StaticMeshComponentArray[Leaf.First + i])
+        {
+            continue;
+        }
+        const FAABB& Bound = SlotBounds[Leaf.First + i];
+        Accumulated = bInitialized ? FAABB::Union(Accumulated, Bound) : Bound;
+        bInitialized = true;
+    }
+
+    if (!bInitialized)
+    {
+        // 전부 Tombstone인 리프는 점으로 줄여서 부모 바운드를 키우지 않게 한다
+        const FVector Center = Leaf.Bounds.GetCenter();
+        Accumulated = FAABB(Center, Center);
+    }
+
+    if (IsSameBounds(Accumulated, Leaf.Bounds))
+    {
+        return;
+    }
+
+    const int32 ParentIdx = Leaf.Parent;
+    SetNodeBounds(NodeIdx, Accumulated);
+    RefitAncestors(ParentIdx);
+}
+
+void FBVHierarchy::RefitAncestors(int32 NodeIdx)
+{
+    // 바운드가 그대로인 조상을 만나면 그 위도 그대로이므로 멈춘다
+    while (NodeIdx >= 0)
+    {
+        const FLBVHNode& Node = Nodes[NodeIdx];
+        const FAABB NewBounds = FAABB::Union(Nodes[Node.Left].Bounds, Nodes[Node.Right].Bounds);
+        if (IsSameBounds(NewBounds, Node.Bounds))
+        {
+            break;
+        }
+
+        SetNodeBounds(NodeIdx, NewBounds);
+        NodeIdx = Nodes[NodeIdx].Parent;
+    }
+}
+
+void FBVHierarchy::SetNodeBounds(int32 NodeIdx, const FAABB& NewBounds)
+{
+    FLBVHNode& Node = Nodes[NodeIdx];
+    WeightedAreaSum += GetNodeCostWeight(Node) * (SurfaceArea(NewBounds) - SurfaceArea(Node.Bounds));
+    Node.Bounds = NewBounds;
+}
+
+void FBVHierarchy::RecomputeCost()
+{
+    WeightedAreaSum = 0.0;
+    for (const FLBVHNode& Node : Nodes)
+    {
+        WeightedAreaSum += GetNodeCostWeight(Node) * SurfaceArea(Node.Bounds);
+    }
 }
 
 void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
@@ -446,8 +793,7 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
                 if (!Owner) continue;
                 if (Owner->GetActorHiddenInEditor()) continue;
 
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
+                const FAABB& Box = SlotBounds[node.First + i];
 
                 float tmin, tmax;
                 if (!RayAABB_IntersectT(Ray, Box, tmin, tmax))
@@ -496,10 +842,76 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
 
 void FBVHierarchy::FlushRebuild()
 {
-    if (bPendingRebuild)
+    // 1. 백그라운드 빌드가 끝났으면 교체하고, 스냅샷 이후 바뀐 컴포넌트를 새 트리에 다시 반영
+    if (PendingBuild && BuildHandle.IsComplete())
+    {
+        std::shared_ptr<FBuildData> Built = std::move(PendingBuild);
+        BuildHandle.Reset();
+        AdoptBuild(*Built);
+
+        for (UPrimitiveComponent* Component : ChangedDuringBuild)
+        {
+            const FAABB* CurrentBounds = StaticMeshComponentBounds.Find(Component);
+            if (!CurrentBounds)
+            {
+                TombstoneComponent(Component);
+            }
+            else if (const int32* Slot = ComponentSlots.Find(Component))
+            {
+                // 스냅샷 시점 바운드를 최신 값으로 교체
+                SlotBounds[*Slot] = *CurrentBounds;
+                PendingRefitLeaves.Add(SlotLeaves[*Slot]);
+            }
+            else
+            {
+                PendingInserts.Add(Component);
+            }
+        }
+        ChangedDuringBuild.clear();
+    }
+
+    // 2. 빈 트리에 넣거나 한 번에 많이 들어오면 (레벨 로드 등) 증분 삽입보다 전체 빌드가 낫다
+    const int32 NumSlots = StaticMeshComponentArray.Num();
+    if (!PendingInserts.IsEmpty()
+        && (Nodes.IsEmpty() || PendingInserts.Num() > std::max(MinSyncRebuildInserts, NumSlots / 4)))
     {
         BuildLBVH();
-        bPendingRebuild = false;
+        return;
+    }
+
+    // 3. 움직였거나 Tombstone이 생긴 리프부터 조상 방향으로 Refit
+    // 삽입보다 먼저 해야 한다: 루트가 리프일 때 삽입하면 그 리프가 뒤로 옮겨지고 0번이 내부 노드가 되므로
+    // 대기 중인 리프 인덱스가 더 이상 같은 노드를 가리키지 않는다
+    for (int32 LeafIdx : PendingRefitLeaves)
+    {
+        RefitLeaf(LeafIdx);
+    }
+    PendingRefitLeaves.Empty();
+
+    // 4. 증분 삽입 (내려가는 경로의 바운드는 위에서 이미 최신)
+    for (UPrimitiveComponent* Component : PendingInserts)
+    {
+        if (ComponentSlots.Contains(Component))
+        {
+            continue; // 같은 프레임에 두 번 Update된 경우
+        }
+        if (const FAABB* Cached = StaticMeshComponentBounds.Find(Component))
+        {
+            InsertComponent(Component, *Cached);
+        }
+    }
+    PendingInserts.Empty();
+    Bounds = Nodes.IsEmpty() ? FAABB() : Nodes[0].Bounds;
+
+    // 5. 품질이 떨어졌으면 백그라운드에서 전체 빌드 (결과는 다음 FlushRebuild들 중 하나에서 교체)
+    if (!PendingBuild && !Nodes.IsEmpty())
+    {
+        const bool bCostDegraded = GetSAHCost() > BuiltCost * RebuildCostRatio;
+        const bool bTooManyTombstones = NumTombstones > static_cast<int32>(StaticMeshComponentArray.Num() * MaxTombstoneRatio);
+        if (bCostDegraded || bTooManyTombstones)
+        {
+            KickBackgroundRebuild();
+        }
     }
 }
 
@@ -509,9 +921,10 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
     NodeIntersectFunc NodeIntersects,
     ComponentIntersectFunc ComponentIntersects) const
 {
-    TSet<UPrimitiveComponent*> IntersectedComponents;
+    // 슬롯마다 컴포넌트가 한 번만 있으므로 중복 제거용 Set이 필요 없다
+    TArray<UPrimitiveComponent*> IntersectedComponents;
     if (Nodes.empty())
-        return TArray<UPrimitiveComponent*>();
+        return IntersectedComponents;
     TArray<int32> IdxStack;
     IdxStack.push_back({ 0 });
 
@@ -527,13 +940,11 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
                 for (int32 i = 0; i < Node.Count; ++i)
                 {
                     UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
-                    if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
+                    if (!Component)
                         continue;
-                    const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                    const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                    if (ComponentIntersects(Box, InBound))
+                    if (ComponentIntersects(SlotBounds[Node.First + i], InBound))
                     {
-                        IntersectedComponents.insert(Component);
+                        IntersectedComponents.Add(Component);
                     }
                 }
             }
@@ -544,7 +955,7 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponentsGeneric(
             }
         }
     }
-    return IntersectedComponents.Array();
+    return IntersectedComponents;
 }
 
 // FAABB 오버로드
@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include <memory>
+#include "JobSystem.h"
 
 struct FFrustum;
 struct FRay; // forward declaration for ray type
@@ -9,6 +11,10 @@ struct FBoundingSphere;
 
 /**
  * @brief Broad phase BVH based on UPrimitiveComponent
+ * - 움직인 컴포넌트는 리프와 조상 노드의 바운드만 제자리에서 갱신 (Refit)
+ * - 새 컴포넌트는 면적 증가가 가장 작은 리프 옆에 끼워 넣고, 제거는 슬롯을 비워두는 Tombstone 처리
+ * - SAH 비용이나 Tombstone 비율이 나빠지면 Job System에서 전체 LBVH를 다시 만들어 교체
+ * - 리프는 슬롯 범위만 들고, 슬롯별 AABB는 Morton 순서의 연속 배열(SlotBounds)에 있어 쿼리가 해시맵을 보지 않는다
  */
 class FBVHierarchy
 {
@@ -27,13 +33,20 @@ public:
     void Clear();
 
     void BulkUpdate(const TArray<UPrimitiveComponent*>& Components);
+    /** 바운드를 직접 넘기는 버전 (벤치마크 등 GetWorldAABB를 거치지 않을 때) */
+    void BulkUpdate(const TArray<UPrimitiveComponent*>& Components, const TArray<FAABB>& ComponentBounds);
     void Update(UPrimitiveComponent* InComponent);
+    /** 바운드를 직접 넘기는 버전 (벤치마크 등 GetWorldAABB를 거치지 않을 때, 오너 활성 검사도 하지 않음) */
+    void Update(UPrimitiveComponent* InComponent, const FAABB& WorldBounds);
     void Remove(UPrimitiveComponent* InComponent);
 
+    /** 이번 프레임에 모인 삽입/Refit을 적용하고, 트리 품질에 따라 백그라운드 리빌드를 시작/교체 */
     void FlushRebuild();
 
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
     void QueryFrustum(const FFrustum& InFrustum);
+    /** 프러스텀에 보이는 컴포넌트 수집 (리프는 SSE로 4개씩, 완전히 안쪽인 서브트리는 판정 없이 수집) */
+    void QueryFrustumComponents(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutComponents) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
@@ -46,6 +59,11 @@ public:
     int MaxOccupiedDepth() const;
     void DebugDump() const;
     const FAABB& GetBounds() const { return Bounds; }
+    /** 루트 면적으로 정규화한 SAH 비용 (마지막 전체 빌드 직후 값과 비교해 리빌드 여부를 정한다) */
+    float GetSAHCost() const;
+    bool IsRebuildInFlight() const { return PendingBuild != nullptr; }
+    /** 트리에 슬롯이 있는 컴포넌트인지 (쿼리 결과를 믿어도 되는지 판단용) */
+    bool Contains(UPrimitiveComponent* InComponent) const { return ComponentSlots.Contains(InComponent); }
 
     // 프러스텀 기준으로 오클루더(내부노드 AABB) / 오클루디(리프의 액터들) 수집
     // VP는 행벡터 기준(네 컨벤션): p' = p * VP
@@ -55,13 +73,45 @@ private:
     struct FLBVHNode
     {
         FAABB Bounds;
+        int32 Parent = -1;
         int32 Left = -1;
         int32 Right = -1;
         int32 First = -1;
         int32 Count = 0;
         bool IsLeaf() const { return Count > 0; }
     };
+    // 전체 빌드 입력/출력 (백그라운드 Job은 이 스냅샷만 만진다)
+    struct FBuildData
+    {
+        TArray<UPrimitiveComponent*> Components;
+        TArray<FAABB> ComponentBounds;
+        TArray<FLBVHNode> Nodes;
+        FAABB Bounds;
+    };
+
     void BuildLBVH();
+    void SnapshotBuildInput(FBuildData& OutData) const;
+    static void BuildTree(FBuildData& Data, int32 InMaxObjects);
+    static int32 BuildRange(FBuildData& Data, int32 InMaxObjects, int32 s, int32 e, int32 Parent);
+    void AdoptBuild(FBuildData& Data);
+    void KickBackgroundRebuild();
+    void CancelBackgroundRebuild();
+
+    // 증분 갱신
+    void InsertComponent(UPrimitiveComponent* InComponent, const FAABB& InBounds);
+    void TombstoneComponent(UPrimitiveComponent* InComponent);
+    void RefitLeaf(int32 NodeIdx);
+    void RefitAncestors(int32 NodeIdx);
+    void SetNodeBounds(int32 NodeIdx, const FAABB& NewBounds);
+    static double GetNodeCostWeight(const FLBVHNode& Node) { return Node.IsLeaf() ? static_cast<double>(Node.Count) : 1.0; }
+    void RecomputeCost();
+
+    // SAH 비용이 마지막 전체 빌드 대비 이 배율을 넘으면 리빌드
+    static constexpr float RebuildCostRatio = 1.5f;
+    // 비어 있는 슬롯이 전체의 이 비율을 넘으면 리빌드
+    static constexpr float MaxTombstoneRatio = 0.25f;
+    // 한 프레임 삽입이 이보다 많으면 증분 삽입 대신 바로 전체 빌드 (레벨 로드 등)
+    static constexpr int32 MinSyncRebuildInserts = 64;
 
 private:
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
@@ -69,18 +119,35 @@ private:
         , NodeIntersectFunc NodeIntersects
         , ComponentIntersectFunc ComponentIntersects) const;
 
-    int BuildRange(int s, int e);
-
     int Depth;
     int MaxDepth;
     int MaxObjects;
     FAABB Bounds;
 
     TMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
+    // 리프가 가리키는 슬롯 배열 (제거된 슬롯은 nullptr인 Tombstone)
     TArray<UPrimitiveComponent*> StaticMeshComponentArray;
+    // 슬롯별 월드 AABB (StaticMeshComponentArray와 같은 인덱스, 쿼리 내부 루프 전용)
+    TArray<FAABB> SlotBounds;
 
     // LBVH nodes
     TArray<FLBVHNode> Nodes;
 
-    bool bPendingRebuild = false;
+    // 컴포넌트 → 슬롯, 슬롯 → 리프 노드
+    TMap<UPrimitiveComponent*, int32> ComponentSlots;
+    TArray<int32> SlotLeaves;
+    int32 NumTombstones = 0;
+
+    // 다음 FlushRebuild에서 처리할 작업
+    TArray<UPrimitiveComponent*> PendingInserts;
+    TArray<int32> PendingRefitLeaves;
+
+    // SAH 비용 = Σ(노드 면적 × 가중치) / 루트 면적. 분자를 증분으로 유지한다
+    double WeightedAreaSum = 0.0;
+    float BuiltCost = 0.0f;
+
+    // 백그라운드 전체 빌드 (스냅샷 이후 바뀐 컴포넌트는 교체 직후 다시 반영)
+    std::shared_ptr<FBuildData> PendingBuild;
+    FJobHandle BuildHandle;
+    TSet<UPrimitiveComponent*> ChangedDuringBuild;
 };
@@ -0,0 +1,382 @@
+﻿#include "pch.h"
+#include "SpatialBenchmark.h"
+#include <random>
+#include "BVHierarchy.h"
+#include "Frustum.h"
+#include "PlatformTime.h"
+#include "Actor.h"
+#include "CameraComponent.h"
+#include "StaticMeshComponent.h"
+#include "CapsuleComponent.h"
+#include "Collision.h"
+#include "ShapeOverlapScene.h"
+
+void FSpatialBenchmark::RunFrustumQueryBenchmark(int32 NumComponents, int32 NumQueries)
+{
+    UE_LOG("[SpatialBenchmark] Frustum query: %d components x %d queries", NumComponents, NumQueries);
+
+    // 1. 컴포넌트는 포인터 키로만 쓰이므로 메시 없이 만들고, 바운드는 직접 넘긴다
+    std::mt19937 Rng(1234);
+    std::uniform_real_distribution<float> PlaneDist(-20000.0f, 20000.0f);
+    std::uniform_real_distribution<float> HeightDist(0.0f, 500.0f);
+    std::uniform_real_distribution<float> SizeDist(20.0f, 200.0f);
+
+    TArray<UPrimitiveComponent*> Components;
+    TArray<FAABB> Bounds;
+    Components.Reserve(NumComponents);
+    Bounds.Reserve(NumComponents);
+    for (int32 i = 0; i < NumComponents; ++i)
+    {
+        const FVector Center(PlaneDist(Rng), PlaneDist(Rng), HeightDist(Rng));
+        const float HalfSize = SizeDist(Rng) * 0.5f;
+        const FVector Half(HalfSize, HalfSize, HalfSize);
+        Components.Add(NewObject<UStaticMeshComponent>());
+        Bounds.Add(FAABB(Center - Half, Center + Half));
+    }
+
+    FBVHierarchy BVH(FAABB(), 0, 8, 8);
+    const uint64 BuildStart = FPlatformTime::Cycles64();
+    BVH.BulkUpdate(Components, Bounds);
+    const double BuildMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BuildStart);
+
+    // 2. 일반적인 게임 카메라 (90도, 16:9, 원거리 10000)로 제자리 회전
+    UCameraComponent* Camera = NewObject<UCameraComponent>();
+    Camera->SetFOV(90.0f);
+    Camera->SetAspectRatio(16.0f / 9.0f);
+    Camera->SetClipPlanes(1.0f, 10000.0f);
+
+    TArray<FFrustum> Frustums;
+    Frustums.Reserve(NumQueries);
+    for (int32 q = 0; q < NumQueries; ++q)
+    {
+        const float Yaw = 360.0f * static_cast<float>(q) / static_cast<float>(FMath::Max(NumQueries, 1));
+        Camera->SetWorldLocationAndRotation(FVector(0.0f, 0.0f, 200.0f), FQuat::MakeFromEulerZYX(FVector(0.0f, 0.0f, Yaw)));
+        Frustums.Add(CreateFrustumFromCamera(*Camera));
+    }
+
+    // 3. BVH 쿼리 vs 전수 검사
+    TArray<UPrimitiveComponent*> Visible;
+    Visible.Reserve(NumComponents);
+    uint64 BVHCycles = 0;
+    uint64 BruteCycles = 0;
+    int64 BVHVisibleTotal = 0;
+    int64 BruteVisibleTotal = 0;
+
+    for (const FFrustum& Frustum : Frustums)
+    {
+        Visible.Empty();
+        const uint64 BVHStart = FPlatformTime::Cycles64();
+        BVH.QueryFrustumComponents(Frustum, Visible);
+        BVHCycles += FPlatformTime::Cycles64() - BVHStart;
+        BVHVisibleTotal += Visible.Num();
+
+        int32 BruteVisible = 0;
+        const uint64 BruteStart = FPlatformTime::Cycles64();
+        for (const FAABB& Box : Bounds)
+        {
+            BruteVisible += IsAABBVisible(Frustum, Box) ? 1 : 0;
+        }
+        BruteCycles += FPlatformTime::Cycles64() - BruteStart;
+        BruteVisibleTotal += BruteVisible;
+    }
+
+    const double Queries = static_cast<double>(FMath::Max(NumQueries, 1));
+    const double BVHMs = FPlatformTime::ToMilliseconds(BVHCycles) / Queries;
+    const double BruteMs = FPlatformTime::ToMilliseconds(BruteCycles) / Queries;
+
+    UE_LOG("[SpatialBenchmark] BVH build       : %.3f ms (%d nodes)", BuildMs, BVH.TotalNodeCount());
+    UE_LOG("[SpatialBenchmark] BVH query       : %.4f ms/query, %.0f visible", BVHMs, BVHVisibleTotal / Queries);
+    UE_LOG("[SpatialBenchmark] Brute force     : %.4f ms/query, %.0f visible (x%.1f)",
+        BruteMs, BruteVisibleTotal / Queries, BVHMs > 0.0 ? BruteMs / BVHMs : 0.0);
+    if (BVHVisibleTotal != BruteVisibleTotal)
+    {
+        UE_LOG("[SpatialBenchmark] WARNING: visible count mismatch (BVH %lld, brute %lld)", BVHVisibleTotal, BruteVisibleTotal);
+    }
+
+    BVH.Clear();
+    ObjectFactory::DeleteObject(Camera);
+    for (UPrimitiveComponent* Component : Components)
+    {
+        ObjectFactory::DeleteObject(Component);
+    }
+}
+
+namespace
+{
+    // BVH AABB 쿼리 결과 수가 살아 있는 바운드 전수 검사와 같은지
+    bool MatchesBruteForce(const FBVHierarchy& BVH, const TMap<UPrimitiveComponent*, FAABB>& LiveBounds, const FAABB& QueryBox)
+    {
+        int32 Expected = 0;
+        for (const auto& Pair : LiveBounds)
+        {
+            Expected += QueryBox.Intersects(Pair.second) ? 1 : 0;
+        }
+        return BVH.QueryIntersectedComponents(QueryBox).Num() == Expected;
+    }
+
+    FAABB MakeBox(const FVector& Center, float HalfSize)
+    {
+        const FVector Half(HalfSize, HalfSize, HalfSize);
+        return FAABB(Center - Half, Center + Half);
+    }
+}
+
+void FSpatialBenchmark::RunIncrementalUpdateCheck(int32 NumComponents, int32 NumFrames)
+{
+    UE_LOG("[SpatialBenchmark] BVH incremental update: %d components x %d frames", NumComponents, NumFrames);
+
+    TArray<UPrimitiveComponent*> AllocatedComponents;
+    auto NewComponent = [&AllocatedComponents]()
+    {
+        UPrimitiveComponent* Component = NewObject<UStaticMeshComponent>();
+        AllocatedComponents.Add(Component);
+        return Component;
+    };
+
+    // 1. 루트가 리프인 작은 트리: 한 프레임에 기존 컴포넌트 이동 + 새 컴포넌트 삽입
+    //    (삽입이 루트 리프를 뒤로 옮기므로, 이동한 리프의 Refit이 옮겨진 노드에 적용돼야 한다)
+    int32 SmallWorldMismatches = 0;
+    {
+        FBVHierarchy BVH(FAABB(), 0, 8, 8);
+        TMap<UPrimitiveComponent*, FAABB> LiveBounds;
+        TArray<UPrimitiveComponent*> Components;
+        TArray<FAABB> Bounds;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            Components.Add(NewComponent());
+            Bounds.Add(MakeBox(FVector(static_cast<float>(i) * 10.0f, 0.0f, 0.0f), 1.0f));
+            LiveBounds.Add(Components[i], Bounds[i]);
+        }
+        BVH.BulkUpdate(Components, Bounds);
+
+        const FAABB MovedBounds = MakeBox(FVector(500.0f, 500.0f, 0.0f), 1.0f);
+        BVH.Update(Components[0], MovedBounds);
+        LiveBounds.Add(Components[0], MovedBounds);
+
+        UPrimitiveComponent* Spawned = NewComponent();
+        const FAABB SpawnedBounds = MakeBox(FVector(-500.0f, 0.0f, 0.0f), 1.0f);
+        BVH.Update(Spawned, SpawnedBounds);
+        LiveBounds.Add(Spawned, SpawnedBounds);
+
+        BVH.FlushRebuild();
+
+        for (const auto& Pair : LiveBounds)
+        {
+            SmallWorldMismatches += MatchesBruteForce(BVH, LiveBounds, Pair.second) ? 0 : 1;
+        }
+        SmallWorldMismatches += MatchesBruteForce(BVH, LiveBounds, MakeBox(FVector(0.0f, 0.0f, 0.0f), 10000.0f)) ? 0 : 1;
+        BVH.Clear();
+    }
+
+    // 2. 큰 트리에서 매 프레임 임의 이동/추가/제거
+    std::mt19937 Rng(777);
+    const float HalfWorld = 5000.0f;
+    std::uniform_real_distribution<float> PlaneDist(-HalfWorld, HalfWorld);
+    std::uniform_real_distribution<float> StepDist(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> SizeDist(5.0f, 60.0f);
+    std::uniform_real_distribution<float> QuerySizeDist(100.0f, 1500.0f);
+
+    FBVHierarchy BVH(FAABB(), 0, 8, 8);
+    TMap<UPrimitiveComponent*, FAABB> LiveBounds;
+    TArray<UPrimitiveComponent*> Live;
+    {
+        TArray<FAABB> Bounds;
+        for (int32 i = 0; i < NumComponents; ++i)
+        {
+            UPrimitiveComponent* Component = NewComponent();
+            const FAABB Box = MakeBox(FVector(PlaneDist(Rng), PlaneDist(Rng), 0.0f), SizeDist(Rng));
+            Live.Add(Component);
+            Bounds.Add(Box);
+            LiveBounds.Add(Component, Box);
+        }
+        BVH.BulkUpdate(Live, Bounds);
+    }
+
+    const int32 MovesPerFrame = FMath::Max(NumComponents / 50, 1);
+    const int32 ChurnPerFrame = FMath::Max(NumComponents / 500, 1);
+    uint64 FlushCycles = 0;
+    int32 NumChecks = 0;
+    int32 Mismatches = 0;
+
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        for (int32 m = 0; m < MovesPerFrame && !Live.IsEmpty(); ++m)
+        {
+            UPrimitiveComponent* Component = Live[Rng() % Live.Num()];
+            const FAABB Old = LiveBounds[Component];
+            const FVector Center = Old.GetCenter() + FVector(StepDist(Rng), StepDist(Rng), 0.0f);
+            const FAABB Moved = MakeBox(Center, Old.GetHalfExtent().X);
+            BVH.Update(Component, Moved);
+            LiveBounds.Add(Component, Moved);
+        }
+        for (int32 c = 0; c < ChurnPerFrame; ++c)
+        {
+            UPrimitiveComponent* Spawned = NewComponent();
+            const FAABB Box = MakeBox(FVector(PlaneDist(Rng), PlaneDist(Rng), 0.0f), SizeDist(Rng));
+            BVH.Update(Spawned, Box);
+            LiveBounds.Add(Spawned, Box);
+            Live.Add(Spawned);
+
+            if (!Live.IsEmpty())
+            {
+                const int32 RemoveIndex = static_cast<int32>(Rng() % Live.Num());
+                UPrimitiveComponent* Removed = Live[RemoveIndex];
+                BVH.Remove(Removed);
+                LiveBounds.Remove(Removed);
+                Live[RemoveIndex] = Live.back();
+                Live.pop_back();
+            }
+        }
+
+        const uint64 FlushStart = FPlatformTime::Cycles64();
+        BVH.FlushRebuild();
+        FlushCycles += FPlatformTime::Cycles64() - FlushStart;
+
+        if (Frame % 10 == 0)
+        {
+            for (int32 q = 0; q < 8; ++q)
+            {
+                const FAABB QueryBox = MakeBox(FVector(PlaneDist(Rng), PlaneDist(Rng), 0.0f), QuerySizeDist(Rng));
+                Mismatches += MatchesBruteForce(BVH, LiveBounds, QueryBox) ? 0 : 1;
+                ++NumChecks;
+            }
+        }
+    }
+
+    const double FlushMs = FPlatformTime::ToMilliseconds(FlushCycles) / static_cast<double>(FMath::Max(NumFrames, 1));
+    UE_LOG("[SpatialBenchmark] Small tree move+insert : %s", SmallWorldMismatches == 0 ? "OK" : "FAILED");
+    UE_LOG("[SpatialBenchmark] Incremental flush      : %.4f ms/frame, %d nodes, SAH cost %.2f", FlushMs, BVH.TotalNodeCount(), BVH.GetSAHCost());
+    if (SmallWorldMismatches != 0 || Mismatches != 0)
+    {
+        UE_LOG("[SpatialBenchmark] WARNING: query mismatch (small tree %d, random %d / %d)", SmallWorldMismatches, Mismatches, NumChecks);
+    }
+
+    BVH.Clear();
+    for (UPrimitiveComponent* Component : AllocatedComponents)
+    {
+        ObjectFactory::DeleteObject(Component);
+    }
+}
+
+void FSpatialBenchmark::RunShapeBroadphaseBenchmark(int32 NumCapsules, int32 NumFrames)
+{
+    UE_LOG("[SpatialBenchmark] Shape overlap: %d moving capsules x %d frames", NumCapsules, NumFrames);
+
+    // 1. 캐릭터 크기 캡슐을 평면에 흩뿌린다 (밀도는 프레임당 접촉이 캡슐 수와 비슷한 정도)
+    //    캡슐마다 액터를 따로 둬야 같은 액터 쌍 필터에 걸리지 않는다
+    std::mt19937 Rng(4321);
+    const float HalfArena = 40.0f;
+    std::uniform_real_distribution<float> PlaneDist(-HalfArena, HalfArena);
+    std::uniform_real_distribution<float> SpeedDist(-3.0f, 3.0f);
+
+    TArray<AActor*> Owners;
+    TArray<UShapeComponent*> Capsules;
+    TArray<FVector> Velocities;
+    Owners.Reserve(NumCapsules);
+    Capsules.Reserve(NumCapsules);
+    Velocities.Reserve(NumCapsules);
+    for (int32 i = 0; i < NumCapsules; ++i)
+    {
+        AActor* Owner = NewObject<AActor>();
+        UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>();
+        Capsule->SetOwner(Owner);
+        Capsule->CapsuleRadius = 0.4f;
+        Capsule->CapsuleHalfHeight = 0.9f;
+        Capsule->SetBlockComponent(true);
+        Capsule->SetGenerateOverlapEvents(false);
+        Capsule->SetWorldLocation(FVector(PlaneDist(Rng), PlaneDist(Rng), 0.9f));
+
+        Owners.Add(Owner);
+        Capsules.Add(Capsule);
+        Velocities.Add(FVector(SpeedDist(Rng), SpeedDist(Rng), 0.0f));
+    }
+
+    struct FCapsuleSegment { FVector P0; FVector P1; float Radius; };
+    TArray<FCapsuleSegment> Segments;
+    Segments.SetNum(NumCapsules);
+
+    // 월드 없이 실제 씬 경로(ResolveShapes → GatherContacts)를 그대로 탄다
+    FShapeOverlapScene Scene(nullptr);
+    TArray<FHitResult> Hits;
+    TArray<FHitResult> Overlaps;
+
+    uint64 BruteCycles = 0;
+    uint64 SceneCycles = 0;
+    int64 BruteContacts = 0;
+    int64 SceneContacts = 0;
+    int64 CandidateTotal = 0;
+    int32 FullSorts = 0;
+    const float DeltaTime = 1.0f / 60.0f;
+
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        // 2. 이동 + 경계 반사 (두 방식 공통 준비 작업이라 시간에서 뺀다)
+        for (int32 i = 0; i < NumCapsules; ++i)
+        {
+            FVector Location = Capsules[i]->GetWorldLocation() + Velocities[i] * DeltaTime;
+            if (Location.X < -HalfArena || Location.X > HalfArena) { Velocities[i].X = -Velocities[i].X; }
+            if (Location.Y < -HalfArena || Location.Y > HalfArena) { Velocities[i].Y = -Velocities[i].Y; }
+            Capsules[i]->SetWorldLocation(Location);
+
+            FShape Shape;
+            Capsules[i]->GetShape(Shape);
+            Collision::BuildCapsule(Shape, Capsules[i]->GetWorldTransform(), Segments[i].P0, Segments[i].P1, Segments[i].Radius);
+        }
+
+        // 3. 예전 방식: 셰이프마다 나머지 모든 셰이프와 검사 (대칭 쌍도 양쪽에서 한 번씩)
+        //    세그먼트를 미리 만들어 둔 하한치라 실제 예전 Tick보다 유리하다
+        const uint64 BruteStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < NumCapsules; ++i)
+        {
+            for (int32 j = 0; j < NumCapsules; ++j)
+            {
+                if (i == j) { continue; }
+                FHitResult Hit;
+                if (Collision::ComputeCapsuleToCapsulePenetration(Segments[i].P0, Segments[i].P1, Segments[i].Radius,
+                    Segments[j].P0, Segments[j].P1, Segments[j].Radius, Hit))
+                {
+                    ++BruteContacts;
+                }
+            }
+        }
+        BruteCycles += FPlatformTime::Cycles64() - BruteStart;
+
+        // 4. FShapeOverlapScene: 한 번의 해석 + 컴포넌트마다 자기 접촉 꺼내기 (셰이프 Tick과 같은 호출)
+        const uint64 SceneStart = FPlatformTime::Cycles64();
+        Scene.BeginFrame();
+        Scene.ResolveShapes(Capsules);
+        for (UShapeComponent* Capsule : Capsules)
+        {
+            Hits.Empty();
+            Overlaps.Empty();
+            FVector PushOut;
+            Scene.GatherContacts(Capsule, Hits, Overlaps, PushOut);
+            SceneContacts += Hits.Num();
+        }
+        SceneCycles += FPlatformTime::Cycles64() - SceneStart;
+        CandidateTotal += Scene.GetNumCandidatePairs();
+        FullSorts += Scene.DidFullSortLastResolve() ? 1 : 0;
+    }
+
+    const double Frames = static_cast<double>(FMath::Max(NumFrames, 1));
+    const double BruteMs = FPlatformTime::ToMilliseconds(BruteCycles) / Frames;
+    const double SceneMs = FPlatformTime::ToMilliseconds(SceneCycles) / Frames;
+
+    UE_LOG("[SpatialBenchmark] All-shapes scan    : %.3f ms/frame, %.0f contacts", BruteMs, BruteContacts / Frames);
+    UE_LOG("[SpatialBenchmark] FShapeOverlapScene : %.3f ms/frame, %.0f contacts (%.0f candidate pairs, %d full sorts, x%.1f)",
+        SceneMs, SceneContacts / Frames, CandidateTotal / Frames, FullSorts,
+        SceneMs > 0.0 ? BruteMs / SceneMs : 0.0);
+    if (BruteContacts != SceneContacts)
+    {
+        UE_LOG("[SpatialBenchmark] WARNING: contact count mismatch (scan %lld, scene %lld)", BruteContacts, SceneContacts);
+    }
+
+    for (UShapeComponent* Capsule : Capsules)
+    {
+        ObjectFactory::DeleteObject(Capsule);
+    }
+    for (AActor* Owner : Owners)
+    {
+        ObjectFactory::DeleteObject(Owner);
+    }
+}
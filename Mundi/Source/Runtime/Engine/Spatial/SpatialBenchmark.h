@@ -0,0 +1,30 @@
+﻿#pragma once
+
+/**
+ * 공간 자료구조 헤드리스 벤치마크 (콘솔: BENCH BVH)
+ * 월드/렌더러 없이 컴포넌트와 바운드만 만들어 쿼리 비용을 잰다
+ */
+class FSpatialBenchmark
+{
+public:
+    /**
+     * 임의 배치된 NumComponents개의 AABB로 BVH를 만들고, 제자리에서 한 바퀴 도는 카메라 프러스텀으로
+     * NumQueries번 질의해 BVH 쿼리와 전수 검사(IsAABBVisible)의 쿼리당 시간을 로그로 출력
+     */
+    static void RunFrustumQueryBenchmark(int32 NumComponents = 50000, int32 NumQueries = 256);
+
+    /**
+     * BVH 증분 갱신(Refit/삽입/Tombstone/백그라운드 리빌드) 검증 (콘솔: BENCH BVH)
+     * 1) 루트가 리프인 작은 트리에서 같은 프레임에 이동 + 삽입
+     * 2) NumComponents개로 시작해 NumFrames 프레임 동안 임의 이동/추가/제거
+     * 매 검사마다 AABB 쿼리 결과 수를 전수 검사와 비교하고, 불일치 수와 평균 FlushRebuild 시간을 로그로 출력
+     */
+    static void RunIncrementalUpdateCheck(int32 NumComponents = 4000, int32 NumFrames = 600);
+
+    /**
+     * 평면 위를 돌아다니는 NumCapsules개의 캡슐 컴포넌트를 NumFrames 프레임 동안 움직이며
+     * 예전 셰이프 Tick 방식(셰이프마다 나머지 전부와 캡슐 검사)과
+     * FShapeOverlapScene(ResolveShapes + 컴포넌트별 GatherContacts)의 프레임당 시간과 접촉 수를 로그로 출력 (콘솔: BENCH SHAPES)
+     */
+    static void RunShapeBroadphaseBenchmark(int32 NumCapsules = 2000, int32 NumFrames = 120);
+};
@@ -0,0 +1,90 @@
+﻿#include "pch.h"
+#include "SweepAndPrune.h"
+#include <algorithm>
+
+void FSweepAndPrune::SortEndpoints(const TArray<FAABB>& Bounds)
+{
+    const int32 Num = Bounds.Num();
+    bFullSortLastCall = false;
+
+    if (Sorted.Num() == Num)
+    {
+        // 1. 지난 순서 그대로 X 구간만 갱신하고 삽입 정렬 (이동 횟수가 너무 많으면 전체 정렬로 전환)
+        for (FEndpoint& Endpoint : Sorted)
+        {
+            Endpoint.MinX = Bounds[Endpoint.Index].Min.X;
+            Endpoint.MaxX = Bounds[Endpoint.Index].Max.X;
+        }
+
+        const int64 MaxMoves = static_cast<int64>(Num) * 8;
+        int64 Moves = 0;
+        for (int32 i = 1; i < Num && Moves <= MaxMoves; ++i)
+        {
+            const FEndpoint Key = Sorted[i];
+            int32 j = i - 1;
+            while (j >= 0 && Sorted[j].MinX > Key.MinX)
+            {
+                Sorted[j + 1] = Sorted[j];
+                --j;
+                ++Moves;
+            }
+            Sorted[j + 1] = Key;
+        }
+
+        if (Moves <= MaxMoves)
+        {
+            return;
+        }
+    }
+    else
+    {
+        // 개수가 바뀌면 인덱스 대응이 깨지므로 새로 만든다
+        Sorted.SetNum(Num);
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Sorted[i].MinX = Bounds[i].Min.X;
+            Sorted[i].MaxX = Bounds[i].Max.X;
+            Sorted[i].Index = i;
+        }
+    }
+
+    std::sort(Sorted.begin(), Sorted.end(), [](const FEndpoint& L, const FEndpoint& R)
+    {
+        return L.MinX < R.MinX;
+    });
+    bFullSortLastCall = true;
+}
+
+void FSweepAndPrune::FindOverlappingPairs(const TArray<FAABB>& Bounds, TArray<FPair>& OutPairs)
+{
+    OutPairs.Empty();
+    if (Bounds.Num() < 2)
+    {
+        Sorted.Empty();
+        return;
+    }
+
+    SortEndpoints(Bounds);
+
+    // 2. 각 구간에 대해 Min.X가 자신의 Max.X를 넘기 전까지의 뒤쪽 구간만 본다
+    const int32 Num = Sorted.Num();
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const FEndpoint& Current = Sorted[i];
+        const FAABB& CurrentBounds = Bounds[Current.Index];
+
+        for (int32 j = i + 1; j < Num && Sorted[j].MinX <= Current.MaxX; ++j)
+        {
+            const FAABB& OtherBounds = Bounds[Sorted[j].Index];
+            if (CurrentBounds.Min.Y > OtherBounds.Max.Y || OtherBounds.Min.Y > CurrentBounds.Max.Y ||
+                CurrentBounds.Min.Z > OtherBounds.Max.Z || OtherBounds.Min.Z > CurrentBounds.Max.Z)
+            {
+                continue;
+            }
+
+            const int32 A = Current.Index;
+            const int32 B = Sorted[j].Index;
+            OutPairs.Add({ FMath::Min(A, B), FMath::Max(A, B) });
+        }
+    }
+}
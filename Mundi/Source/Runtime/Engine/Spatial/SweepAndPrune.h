@@ -0,0 +1,38 @@
+﻿#pragma once
+#include "AABB.h"
+
+/**
+ * X축 Sweep and Prune 브로드페이즈
+ * - AABB를 Min.X 기준으로 정렬한 뒤 한 번 훑으면서 X 구간이 겹치는 것끼리만 Y/Z를 비교한다
+ * - 결과 쌍은 (A < B)로 한 번씩만 나오므로 대칭 중복이 없다
+ * - 정렬 배열을 멤버로 들고 있어, 입력 개수가 같으면 지난 프레임 순서에서 삽입 정렬로 시작한다
+ *   (물체가 조금씩 움직이는 일반적인 프레임에서는 거의 O(N))
+ */
+class FSweepAndPrune
+{
+public:
+    struct FPair
+    {
+        int32 A;
+        int32 B;
+    };
+
+    /** Bounds 중 서로 겹치는 모든 인덱스 쌍을 OutPairs에 채운다 (OutPairs는 비우고 시작) */
+    void FindOverlappingPairs(const TArray<FAABB>& Bounds, TArray<FPair>& OutPairs);
+
+    /** 지난 호출에서 삽입 정렬 대신 전체 정렬을 했는지 (통계/벤치마크용) */
+    bool DidFullSortLastCall() const { return bFullSortLastCall; }
+
+private:
+    struct FEndpoint
+    {
+        float MinX;
+        float MaxX;
+        int32 Index;
+    };
+
+    void SortEndpoints(const TArray<FAABB>& Bounds);
+
+    TArray<FEndpoint> Sorted;
+    bool bFullSortLastCall = false;
+};
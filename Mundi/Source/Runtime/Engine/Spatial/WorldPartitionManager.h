@@ -34,6 +34,8 @@ public:
 	void MarkDirty(UPrimitiveComponent* Smc);
 
 	void Update(float DeltaTime, const uint32 BudgetCount = 256);
+	/** 더티 큐에서 아직 처리되지 않은 컴포넌트 (BVH 바운드가 최신이 아님) */
+	bool IsDirty(UPrimitiveComponent* Component) const { return ComponentDirtySet.Contains(Component); }
 
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
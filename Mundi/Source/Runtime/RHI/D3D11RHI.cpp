@@ -71,6 +71,7 @@ void D3D11RHI::Release()
     if (DepthStencilStateAlwaysNoWrite) { DepthStencilStateAlwaysNoWrite->Release(); DepthStencilStateAlwaysNoWrite = nullptr; }
     if (DepthStencilStateDisable) { DepthStencilStateDisable->Release(); DepthStencilStateDisable = nullptr; }
     if (DepthStencilStateGreaterEqualWrite) { DepthStencilStateGreaterEqualWrite->Release(); DepthStencilStateGreaterEqualWrite = nullptr; }
+    if (DepthStencilStateAlwaysWrite) { DepthStencilStateAlwaysWrite->Release(); DepthStencilStateAlwaysWrite = nullptr; }
     if (DepthStencilStateOverlayWriteStencil) { DepthStencilStateOverlayWriteStencil->Release(); DepthStencilStateOverlayWriteStencil = nullptr; }
     if (DepthStencilStateStencilRejectOverlay) { DepthStencilStateStencilRejectOverlay->Release(); DepthStencilStateStencilRejectOverlay = nullptr; }
 
@@ -192,6 +193,10 @@ void D3D11RHI::CreateDepthStencilState()
     desc.DepthFunc = D3D11_COMPARISON_GREATER_EQUAL;
     Device->CreateDepthStencilState(&desc, &DepthStencilStateGreaterEqualWrite);
 
+    // 5-1) AlwaysWrite: Always + Write ALL (섀도우 아틀라스의 한 영역만 먼 깊이로 덮어쓸 때)
+    desc.DepthFunc = D3D11_COMPARISON_ALWAYS;
+    Device->CreateDepthStencilState(&desc, &DepthStencilStateAlwaysWrite);
+
     // 6) OverlayWriteStencil: Always + NoWriteDepth + Stencil=REPLACE 1
     ZeroMemory(&desc, sizeof(desc));
     desc.DepthEnable = TRUE;
@@ -1089,6 +1094,9 @@ void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
     case EComparisonFunc::Disable:
 		DeviceContext->OMSetDepthStencilState(DepthStencilStateDisable, 0);
         break;
+    case EComparisonFunc::AlwaysWrite:
+        DeviceContext->OMSetDepthStencilState(DepthStencilStateAlwaysWrite, 0);
+        break;
     }
 }
 
@@ -0,0 +1,64 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 프러스텀 컬링 통계
+// 뷰 컬링(메시/데칼)과 라이트별 그림자 캐스터 컬링 결과를 추적
+struct FCullingStats
+{
+	// 뷰 프러스텀 기준 메시 컴포넌트
+	uint32 TotalMeshes = 0;
+	uint32 VisibleMeshes = 0;
+	uint32 CulledMeshes = 0;
+
+	// 뷰 프러스텀 기준 데칼 (OBB 판정)
+	uint32 TotalDecals = 0;
+	uint32 VisibleDecals = 0;
+
+	// 그림자: 라이트 뷰(섀도우 요청) 하나당 캐스터 판정 결과의 합
+	uint32 ShadowViews = 0;
+	uint32 ShadowCastersDrawn = 0;
+	uint32 ShadowCastersCulled = 0;
+
+	// 뷰 + 라이트 프러스텀 쿼리에 쓴 시간
+	double CullingTimeMS = 0.0;
+
+	void Reset()
+	{
+		*this = FCullingStats();
+	}
+};
+
+// 컬링 통계 전역 매니저 (싱글톤)
+// 마지막으로 렌더링한 뷰의 결과를 UStatsOverlayD2D에 제공
+class FCullingStatManager
+{
+public:
+	static FCullingStatManager& GetInstance()
+	{
+		static FCullingStatManager Instance;
+		return Instance;
+	}
+
+	void UpdateStats(const FCullingStats& InStats)
+	{
+		CurrentStats = InStats;
+	}
+
+	const FCullingStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FCullingStatManager() = default;
+	~FCullingStatManager() = default;
+	FCullingStatManager(const FCullingStatManager&) = delete;
+	FCullingStatManager& operator=(const FCullingStatManager&) = delete;
+
+	FCullingStats CurrentStats;
+};
@@ -276,6 +276,8 @@ void FLightManager::Release()
 		VSMShadowAtlasTexture2D->Release();
 		VSMShadowAtlasTexture2D = nullptr;
 	}
+
+	InvalidateShadowCache();
 }
 
 void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
@@ -478,6 +480,9 @@ void FLightManager::ClearAllDepthStencilView(D3D11RHI* RHIDevice)
 	
 	// 비워진 리소스를 다시 할당 시키려고
 	bHaveToUpdate = true;
+
+	// 아틀라스 내용이 사라졌으므로 캐시도 무효
+	InvalidateShadowCache();
 }
 
 bool FLightManager::GetCachedShadowData(ULightComponent* Light, int32 SubViewIndex, FShadowMapData& OutData) const
@@ -639,6 +644,100 @@ void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutR
 	}
 }
 
+void FLightManager::BeginShadowCachePass()
+{
+	++ShadowCachePass;
+	bHasReusableShadowCache2D = false;
+
+	// 직전 패스에 유효하지 않았던 항목은 다시 맞을 수 없으므로 정리
+	auto PruneCache = [this](TMap<ULightComponent*, TArray<FShadowCacheEntry>>& Cache, bool& bOutHasReusable)
+	{
+		for (auto It = Cache.begin(); It != Cache.end();)
+		{
+			bool bAnyAlive = false;
+			for (const FShadowCacheEntry& Entry : It->second)
+			{
+				if (Entry.LastPass + 1 == ShadowCachePass)
+				{
+					bAnyAlive = true;
+					if (Entry.Signature != 0)
+					{
+						bOutHasReusable = true;
+					}
+				}
+			}
+
+			if (bAnyAlive)
+			{
+				++It;
+			}
+			else
+			{
+				It = Cache.erase(It);
+			}
+		}
+	};
+
+	bool bHasReusableCube = false;
+	PruneCache(ShadowCache2D, bHasReusableShadowCache2D);
+	PruneCache(ShadowCacheCube, bHasReusableCube);
+}
+
+bool FLightManager::IsShadowCacheValid(const FShadowRenderRequest& Request, uint64 Signature, bool bCube) const
+{
+	if (Signature == 0 || Request.Size == 0 || !Request.LightOwner || Request.SubViewIndex < 0)
+	{
+		return false;
+	}
+
+	const TArray<FShadowCacheEntry>* Entries = (bCube ? ShadowCacheCube : ShadowCache2D).Find(Request.LightOwner);
+	if (!Entries || Request.SubViewIndex >= Entries->Num())
+	{
+		return false;
+	}
+
+	// 직전 패스 이후 다른 요청이 이 영역을 덮어쓰지 않았음이 보장되는 경우만 재사용
+	const FShadowCacheEntry& Entry = (*Entries)[Request.SubViewIndex];
+	if (Entry.Signature != Signature || Entry.LastPass + 1 != ShadowCachePass || Entry.Size != Request.Size)
+	{
+		return false;
+	}
+
+	if (bCube)
+	{
+		return Entry.AssignedSliceIndex == Request.AssignedSliceIndex;
+	}
+	return Entry.AtlasViewportOffset == Request.AtlasViewportOffset;
+}
+
+void FLightManager::MarkShadowCached(const FShadowRenderRequest& Request, uint64 Signature, bool bCube)
+{
+	if (Request.Size == 0 || !Request.LightOwner || Request.SubViewIndex < 0)
+	{
+		return;
+	}
+
+	TArray<FShadowCacheEntry>& Entries = (bCube ? ShadowCacheCube : ShadowCache2D)[Request.LightOwner];
+	if (Entries.Num() <= Request.SubViewIndex)
+	{
+		Entries.SetNum(Request.SubViewIndex + 1);
+	}
+
+	FShadowCacheEntry& Entry = Entries[Request.SubViewIndex];
+	Entry.Signature = Signature;
+	Entry.LastPass = ShadowCachePass;
+	Entry.AtlasViewportOffset = Request.AtlasViewportOffset;
+	Entry.Size = Request.Size;
+	Entry.AssignedSliceIndex = Request.AssignedSliceIndex;
+}
+
+void FLightManager::InvalidateShadowCache()
+{
+	ShadowCache2D.Empty();
+	ShadowCacheCube.Empty();
+	bHasReusableShadowCache2D = false;
+}
+
 void FLightManager::ClearAllLightList()
 {
 	AmbientLightList.clear();
@@ -657,6 +756,7 @@ void FLightManager::ClearAllLightList()
 
 	ShadowDataCache2D.clear();
 	ShadowDataCacheCube.clear();
+	InvalidateShadowCache();
 }
 
 template<typename T>
@@ -741,6 +841,7 @@ void FLightManager::DeRegisterLight<UDirectionalLightComponent>(UDirectionalLigh
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ShadowCache2D.Remove(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent* LightComponent)
@@ -757,6 +858,7 @@ void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent*
 	bHaveToUpdate = true;
 
 	ShadowDataCacheCube.Remove(LightComponent);
+	ShadowCacheCube.Remove(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* LightComponent)
@@ -772,6 +874,7 @@ void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* Li
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ShadowCache2D.Remove(LightComponent);
 }
 
 
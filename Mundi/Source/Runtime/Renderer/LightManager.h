@@ -52,6 +52,16 @@ struct FShadowRenderRequest
     }
 };
 
+// 정적 섀도우 캐시 항목 (라이트의 서브 뷰 하나가 아틀라스에 남겨둔 내용)
+struct FShadowCacheEntry
+{
+    uint64 Signature = 0;           // 라이트 행렬 + 캐스터 목록 해시 (0이면 재사용 불가)
+    uint32 LastPass = 0;            // 이 영역의 내용이 마지막으로 유효했던 섀도우 패스 번호
+    FVector2D AtlasViewportOffset;  // 2D 아틀라스 영역
+    uint32 Size = 0;
+    int32 AssignedSliceIndex = -1;  // 큐브 아틀라스 슬라이스
+};
+
 // -----------------------------------------------------------------------------
 // 2. Pass 2 (GPU) 셰이더용 구조체
 // -----------------------------------------------------------------------------
@@ -158,6 +168,17 @@ public:
     void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
     void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube);
 
+    // --- 정적 섀도우 캐시 (라이트와 캐스터가 그대로면 아틀라스 영역을 다시 그리지 않는다) ---
+    // 섀도우 패스 시작 시 호출. 더 이상 재사용될 수 없는 항목을 정리한다
+    void BeginShadowCachePass();
+    // 직전 섀도우 패스에 같은 영역, 같은 시그니처로 남아 있는 요청이면 true
+    bool IsShadowCacheValid(const FShadowRenderRequest& Request, uint64 Signature, bool bCube) const;
+    // 이번 패스에서 요청 영역에 남은 내용을 기록 (Signature 0은 다음 패스에 재사용하지 않음)
+    void MarkShadowCached(const FShadowRenderRequest& Request, uint64 Signature, bool bCube);
+    // 직전 패스의 2D 아틀라스 내용 중 재사용 가능한 영역이 있는지 (없으면 아틀라스 전체를 지우는 게 싸다)
+    bool HasReusableShadowCache2D() const { return bHasReusableShadowCache2D; }
+    void InvalidateShadowCache();
+
     TArray<UAmbientLightComponent*> GetAmbientLightList() { return AmbientLightList; }
     TArray<UDirectionalLightComponent*> GetDirectionalLightList() { return DIrectionalLightList; }
     TArray<UPointLightComponent*> GetPointLightList() { return PointLightList; }
@@ -209,6 +230,14 @@ private:
     // Key: 라이트, Value: 할당된 큐브맵 슬라이스 인덱스
     TMap<ULightComponent*, int32> ShadowDataCacheCube;
 
+    // --- 정적 섀도우 캐시 ---
+    // Key: 라이트, Value: SubViewIndex별 캐시 항목
+    TMap<ULightComponent*, TArray<FShadowCacheEntry>> ShadowCache2D;
+    TMap<ULightComponent*, TArray<FShadowCacheEntry>> ShadowCacheCube;
+    // 뷰포트마다 RenderShadowMaps가 불리므로 프레임이 아닌 섀도우 패스 단위로 센다 (0은 '없음')
+    uint32 ShadowCachePass = 0;
+    bool bHasReusableShadowCache2D = false;
+
 
     //structured buffer
     ID3D11Buffer* PointLightBuffer = nullptr;
@@ -6,6 +6,7 @@
 // 전방 선언
 class UShader;
 class UMaterial;
+struct FShaderVariant;
 
 /**
  * @struct FMeshBatchElement
@@ -94,6 +95,11 @@ struct FMeshBatchElement
 	uint32 InstanceCount = 0;
 	uint32 InstanceStart = 0;
 
+	// --- 5. 자동 인스턴싱 (FMeshInstanceMerger) ---
+	// USE_INSTANCING을 지원하는 셰이더와 이 배치가 쓰는 변형. 둘 다 있어야 같은 배치끼리 합쳐진다
+	UShader* InstancingShader = nullptr;
+	const FShaderVariant* ShaderVariant = nullptr;
+
 	// --- 기본 생성자 ---
 	FMeshBatchElement() = default;
 
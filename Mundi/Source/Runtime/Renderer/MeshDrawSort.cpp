@@ -0,0 +1,162 @@
+﻿#include "pch.h"
+#include "MeshDrawSort.h"
+#include "MeshBatchElement.h"
+#include "Hash.h"
+
+namespace
+{
+	constexpr int32 RadixBits = 8;
+	constexpr int32 RadixBuckets = 1 << RadixBits;
+	constexpr int32 RadixPasses = 64 / RadixBits;
+
+	constexpr uint64 FieldMask(int32 Bits)
+	{
+		return (uint64(1) << Bits) - 1;
+	}
+
+	// 양수 float은 비트 패턴 순서가 값 순서와 같으므로 부호를 뺀 상위 12비트가 로그 스케일 깊이 버킷이 된다
+	uint64 QuantizeDepth(float ViewDepth)
+	{
+		const float Depth = ViewDepth > 0.0f ? ViewDepth : 0.0f; // 카메라 뒤와 NaN은 0 버킷
+		uint32 Bits;
+		std::memcpy(&Bits, &Depth, sizeof(Bits));
+		return (Bits >> (31 - FMeshDrawSorter::DepthBits)) & FieldMask(FMeshDrawSorter::DepthBits);
+	}
+
+	void InsertionSort(FMeshDrawSortEntry* Entries, int32 Num)
+	{
+		for (int32 i = 1; i < Num; ++i)
+		{
+			const FMeshDrawSortEntry Current = Entries[i];
+			int32 j = i - 1;
+			while (j >= 0 && Entries[j].Key > Current.Key)
+			{
+				Entries[j + 1] = Entries[j];
+				--j;
+			}
+			Entries[j + 1] = Current;
+		}
+	}
+}
+
+void FMeshDrawSorter::Reset()
+{
+	Entries.Empty();
+	ShaderIds.Empty();
+	MaterialIds.Empty();
+	VertexBufferIds.Empty();
+}
+
+uint32 FMeshDrawSorter::GetDenseId(TMap<uint64, uint32>& Ids, uint64 Identity)
+{
+	// 처음 보는 조합이면 지금까지 나온 개수가 새 ID
+	return Ids.emplace(Identity, static_cast<uint32>(Ids.size())).first->second;
+}
+
+void FMeshDrawSorter::Add(const FMeshBatchElement& Batch, uint32 BatchIndex, EMeshDrawPass Pass, const FMatrix& ViewMatrix, bool bBackToFront)
+{
+	// DrawMeshBatches가 상태를 다시 바인딩하는 기준과 같은 묶음으로 ID를 매긴다
+	const uint64 ShaderId = GetDenseId(ShaderIds,
+		HashCombine(reinterpret_cast<uint64>(Batch.VertexShader), reinterpret_cast<uint64>(Batch.PixelShader)));
+	const uint64 MaterialId = GetDenseId(MaterialIds,
+		HashCombine(reinterpret_cast<uint64>(Batch.Material), reinterpret_cast<uint64>(Batch.InstanceShaderResourceView)));
+	const uint64 VertexBufferId = GetDenseId(VertexBufferIds,
+		HashCombine(reinterpret_cast<uint64>(Batch.VertexBuffer), reinterpret_cast<uint64>(Batch.IndexBuffer)));
+
+	// 수동 우선순위가 없는(-1) 배치가 먼저, 있으면 값 순서대로
+	const uint64 Priority = Batch.SortPriority < 0 ? 0 : static_cast<uint64>(std::min(Batch.SortPriority + 1, 255));
+
+	// 오브젝트 원점의 뷰 공간 z (행 벡터 규약: p * View)
+	const FMatrix& World = Batch.WorldMatrix;
+	const float ViewDepth = World.M[3][0] * ViewMatrix.M[0][2] + World.M[3][1] * ViewMatrix.M[1][2]
+		+ World.M[3][2] * ViewMatrix.M[2][2] + ViewMatrix.M[3][2];
+	uint64 Depth = QuantizeDepth(ViewDepth);
+	if (bBackToFront)
+	{
+		Depth = FieldMask(DepthBits) - Depth;
+	}
+
+	FMeshDrawSortEntry Entry;
+	Entry.Key = (static_cast<uint64>(Pass) << PassShift)
+		| (Priority << PriorityShift)
+		| ((ShaderId & FieldMask(ShaderBits)) << ShaderShift)
+		| ((MaterialId & FieldMask(MaterialBits)) << MaterialShift)
+		| ((VertexBufferId & FieldMask(VertexBufferBits)) << VertexBufferShift)
+		| (Depth << DepthShift);
+	Entry.Index = BatchIndex;
+	Entries.Add(Entry);
+}
+
+void FMeshDrawSorter::Sort()
+{
+	SortEntries(Entries, ScratchEntries);
+}
+
+int32 FMeshDrawSorter::FindFirstOfPass(EMeshDrawPass Pass) const
+{
+	const uint64 PassKey = static_cast<uint64>(Pass) << PassShift;
+	const auto It = std::lower_bound(Entries.begin(), Entries.end(), PassKey,
+		[](const FMeshDrawSortEntry& Entry, uint64 Key) { return Entry.Key < Key; });
+	return static_cast<int32>(It - Entries.begin());
+}
+
+void FMeshDrawSorter::SortEntries(TArray<FMeshDrawSortEntry>& InOutEntries, TArray<FMeshDrawSortEntry>& Scratch)
+{
+	const int32 Num = InOutEntries.Num();
+	if (Num <= InsertionSortMaxEntries)
+	{
+		InsertionSort(InOutEntries.GetData(), Num);
+		return;
+	}
+
+	// 1) 모든 pass의 히스토그램을 한 번에 계산
+	uint32 Histograms[RadixPasses][RadixBuckets] = {};
+	for (const FMeshDrawSortEntry& Entry : InOutEntries)
+	{
+		for (int32 Pass = 0; Pass < RadixPasses; ++Pass)
+		{
+			++Histograms[Pass][(Entry.Key >> (Pass * RadixBits)) & (RadixBuckets - 1)];
+		}
+	}
+
+	Scratch.SetNum(Num);
+	FMeshDrawSortEntry* In = InOutEntries.GetData();
+	FMeshDrawSortEntry* Out = Scratch.GetData();
+	bool bResultInScratch = false;
+
+	for (int32 Pass = 0; Pass < RadixPasses; ++Pass)
+	{
+		uint32* Histogram = Histograms[Pass];
+		const int32 Shift = Pass * RadixBits;
+
+		// 모든 키가 같은 버킷이면 이 자리수는 순서를 바꾸지 않으므로 건너뛴다 (패스/우선순위 바이트는 대개 같음)
+		if (Histogram[(In[0].Key >> Shift) & (RadixBuckets - 1)] == static_cast<uint32>(Num))
+		{
+			continue;
+		}
+
+		// Exclusive prefix sum → 버킷별 시작 위치
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < RadixBuckets; ++Bucket)
+		{
+			const uint32 Count = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const uint32 Dest = Histogram[(In[i].Key >> Shift) & (RadixBuckets - 1)]++;
+			Out[Dest] = In[i];
+		}
+
+		std::swap(In, Out);
+		bResultInScratch = !bResultInScratch;
+	}
+
+	// 결과가 Scratch 쪽에 있으면 버퍼를 맞바꾼다 (복사 없이, 두 배열 모두 용량 유지)
+	if (bResultInScratch)
+	{
+		InOutEntries.swap(Scratch);
+	}
+}
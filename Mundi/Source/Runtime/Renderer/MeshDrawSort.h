@@ -0,0 +1,79 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+struct FMeshBatchElement;
+
+// 드로우 리스트 정렬 항목. 무거운 FMeshBatchElement는 제자리에 두고 (키, 인덱스)만 옮긴다
+struct FMeshDrawSortEntry
+{
+	uint64 Key = 0;
+	uint32 Index = 0;
+};
+
+// 정렬 키의 최상위 필드. 한 리스트에 여러 패스를 담으면 패스별로 연속 구간이 된다
+enum class EMeshDrawPass : uint8
+{
+	Opaque = 0,
+	ParticleSprite = 1,	// 깊이 쓰기 없이 먼저 그린다
+	ParticleMesh = 2,
+};
+
+/**
+ * 64-bit 드로우 정렬 키 생성 + Radix Sort
+ * 키 배치 (상위 → 하위): Pass 4 | SortPriority 8 | Shader 12 | Material 14 | VertexBuffer 14 | Depth 12
+ * - 셰이더/머티리얼/버퍼는 포인터 대신 리스트 안에서 처음 등장한 순서로 매긴 조밀한 ID를 쓴다
+ *   (필드 폭을 넘는 ID는 겹칠 수 있지만 묶음 품질만 떨어질 뿐 그리기 결과는 같다)
+ * - Depth는 뷰 공간 z의 float 비트 상위 12비트 (지수 + 가수 4비트라 로그 스케일 버킷)
+ */
+class FMeshDrawSorter
+{
+public:
+	static constexpr int32 DepthBits = 12;
+	static constexpr int32 VertexBufferBits = 14;
+	static constexpr int32 MaterialBits = 14;
+	static constexpr int32 ShaderBits = 12;
+	static constexpr int32 PriorityBits = 8;
+	static constexpr int32 PassBits = 4;
+
+	static constexpr int32 DepthShift = 0;
+	static constexpr int32 VertexBufferShift = DepthShift + DepthBits;
+	static constexpr int32 MaterialShift = VertexBufferShift + VertexBufferBits;
+	static constexpr int32 ShaderShift = MaterialShift + MaterialBits;
+	static constexpr int32 PriorityShift = ShaderShift + ShaderBits;
+	static constexpr int32 PassShift = PriorityShift + PriorityBits;
+	static_assert(PassShift + PassBits == 64, "정렬 키 필드 합이 64비트가 아님");
+
+	/** 이 수 이하는 삽입 정렬 (Radix 히스토그램 비용이 더 크다) */
+	static constexpr int32 InsertionSortMaxEntries = 64;
+
+	/** 새 리스트 시작 (엔트리와 ID 테이블을 비우고 용량은 유지) */
+	void Reset();
+
+	/** BatchIndex번 배치의 키를 만들어 추가. bBackToFront면 깊이 필드를 뒤집는다 */
+	void Add(const FMeshBatchElement& Batch, uint32 BatchIndex, EMeshDrawPass Pass, const FMatrix& ViewMatrix, bool bBackToFront);
+
+	/** 키 오름차순 안정 정렬 */
+	void Sort();
+
+	const TArray<FMeshDrawSortEntry>& GetEntries() const { return Entries; }
+	int32 Num() const { return Entries.Num(); }
+
+	/** 정렬된 엔트리에서 Pass 이상인 첫 위치 (없으면 Num) */
+	int32 FindFirstOfPass(EMeshDrawPass Pass) const;
+
+	static EMeshDrawPass GetPass(uint64 Key) { return static_cast<EMeshDrawPass>(Key >> PassShift); }
+
+	/** 키 오름차순 안정 정렬 (작으면 삽입 정렬, 아니면 8-bit x 8 pass LSD Radix). Scratch는 작업 버퍼 */
+	static void SortEntries(TArray<FMeshDrawSortEntry>& InOutEntries, TArray<FMeshDrawSortEntry>& Scratch);
+
+private:
+	static uint32 GetDenseId(TMap<uint64, uint32>& Ids, uint64 Identity);
+
+	TArray<FMeshDrawSortEntry> Entries;
+	TArray<FMeshDrawSortEntry> ScratchEntries;
+
+	// 포인터 조합 → 조밀한 ID (리스트마다 다시 매김)
+	TMap<uint64, uint32> ShaderIds;
+	TMap<uint64, uint32> MaterialIds;
+	TMap<uint64, uint32> VertexBufferIds;
+};
@@ -0,0 +1,70 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 패스 하나의 드로우 리스트 정렬/상태 변경 통계
+struct FMeshDrawPassStats
+{
+	uint32 NumDraws = 0;
+	// 메시 배치 수집 시간 (직렬 준비 단계 포함)과 수집에 쓴 청크 수 (1이면 직렬)
+	double CollectTimeMS = 0.0;
+	uint32 CollectChunks = 0;
+	// (키 생성 + Radix Sort) 시간
+	double SortTimeMS = 0.0;
+	// DrawMeshBatches가 실제로 다시 바인딩한 횟수
+	uint32 ShaderChanges = 0;
+	uint32 MaterialChanges = 0;
+	uint32 VertexBufferChanges = 0;
+
+	// 자동 인스턴싱: 실제로 제출한 드로우 수, 합쳐진 인스턴스드 드로우 수와 그 안에 들어간 오브젝트 수
+	uint32 SubmittedDraws = 0;
+	uint32 InstancedDraws = 0;
+	uint32 InstancedObjects = 0;
+	double MergeTimeMS = 0.0;
+};
+
+// 정렬 키로 그리는 패스들의 통계 (뷰 하나 기준)
+struct FMeshDrawStats
+{
+	FMeshDrawPassStats Opaque;
+	FMeshDrawPassStats Particle;
+
+	void Reset()
+	{
+		*this = FMeshDrawStats();
+	}
+};
+
+// 드로우 정렬 통계 전역 매니저 (싱글톤)
+// 마지막으로 렌더링한 뷰의 결과를 UStatsOverlayD2D에 제공
+class FMeshDrawStatManager
+{
+public:
+	static FMeshDrawStatManager& GetInstance()
+	{
+		static FMeshDrawStatManager Instance;
+		return Instance;
+	}
+
+	void UpdateStats(const FMeshDrawStats& InStats)
+	{
+		CurrentStats = InStats;
+	}
+
+	const FMeshDrawStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FMeshDrawStatManager() = default;
+	~FMeshDrawStatManager() = default;
+	FMeshDrawStatManager(const FMeshDrawStatManager&) = delete;
+	FMeshDrawStatManager& operator=(const FMeshDrawStatManager&) = delete;
+
+	FMeshDrawStats CurrentStats;
+};
@@ -0,0 +1,240 @@
+﻿#include "pch.h"
+#include "MeshInstanceMerger.h"
+#include "MeshBatchElement.h"
+#include "MeshDrawStats.h"
+#include "Shader.h"
+
+FMeshInstanceMerger::~FMeshInstanceMerger()
+{
+	Release();
+}
+
+void FMeshInstanceMerger::Release()
+{
+	if (InstanceBuffer)
+	{
+		InstanceBuffer->Release();
+		InstanceBuffer = nullptr;
+	}
+	InstanceCapacity = 0;
+}
+
+bool FMeshInstanceMerger::CanInstance(const FMeshBatchElement& Batch)
+{
+	// 인스턴싱 셰이더를 갖고 있는 스태틱 메시 배치만 (스키닝/이미 인스턴스드/SubUV 배치는 제외)
+	return Batch.InstancingShader && Batch.ShaderVariant
+		&& !Batch.bInstancedDraw
+		&& !Batch.GPUSkinMatrixSRV
+		&& Batch.VertexBuffer && Batch.IndexBuffer && Batch.VertexStride > 0 && Batch.IndexCount > 0
+		&& Batch.SubImages_Horizontal <= 1 && Batch.SubImages_Vertical <= 1
+		&& Batch.ScreenAlignment == EScreenAlignment::None;
+}
+
+bool FMeshInstanceMerger::IsSameDraw(const FMeshBatchElement& A, const FMeshBatchElement& B)
+{
+	// 월드 행렬과 ObjectID를 뺀, DrawMeshBatches가 드로우마다 바인딩하는 모든 상태가 같아야 한다
+	return A.ShaderVariant == B.ShaderVariant
+		&& A.Material == B.Material
+		&& A.InstanceShaderResourceView == B.InstanceShaderResourceView
+		&& A.VertexBuffer == B.VertexBuffer
+		&& A.IndexBuffer == B.IndexBuffer
+		&& A.VertexStride == B.VertexStride
+		&& A.PrimitiveTopology == B.PrimitiveTopology
+		&& A.IndexCount == B.IndexCount
+		&& A.StartIndex == B.StartIndex
+		&& A.BaseVertexIndex == B.BaseVertexIndex
+		&& A.SortPriority == B.SortPriority
+		&& A.InstanceColor == B.InstanceColor
+		&& A.CartoonOutlineThreshold == B.CartoonOutlineThreshold
+		&& A.CartoonShadingLevels == B.CartoonShadingLevels
+		&& A.CartoonSpecularThreshold == B.CartoonSpecularThreshold
+		&& A.CartoonRimIntensity == B.CartoonRimIntensity;
+}
+
+const FShaderVariant* FMeshInstanceMerger::GetInstancedVariant(const FMeshBatchElement& Batch)
+{
+	if (const FShaderVariant** Found = InstancedVariants.Find(Batch.ShaderVariant))
+	{
+		return *Found;
+	}
+
+	// 원래 변형과 같은 매크로 + USE_INSTANCING (뷰 모드/조명 모델/카툰 설정이 그대로 따라온다)
+	TArray<FShaderMacro> Macros = Batch.ShaderVariant->SourceMacros;
+	Macros.Add(FShaderMacro(UShader::MACRO_USE_INSTANCING, "1"));
+	const FShaderVariant* Variant = Batch.InstancingShader->GetOrCompileShaderVariant(Macros);
+	if (Variant && (!Variant->VertexShader || !Variant->PixelShader || !Variant->InputLayout))
+	{
+		Variant = nullptr;
+	}
+
+	InstancedVariants.Add(Batch.ShaderVariant, Variant);
+	return Variant;
+}
+
+bool FMeshInstanceMerger::EnsureInstanceBuffer(D3D11RHI* RHIDevice, uint32 NumInstances)
+{
+	if (InstanceBuffer && NumInstances <= InstanceCapacity)
+	{
+		return true;
+	}
+
+	Release();
+
+	// 자주 다시 만들지 않도록 여유를 둔다
+	const uint32 NewCapacity = std::max<uint32>(NumInstances + NumInstances / 2, 256);
+
+	D3D11_BUFFER_DESC Desc = {};
+	Desc.ByteWidth = sizeof(FStaticMeshInstanceData) * NewCapacity;
+	Desc.Usage = D3D11_USAGE_DYNAMIC;
+	Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+	Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+	if (FAILED(RHIDevice->GetDevice()->CreateBuffer(&Desc, nullptr, &InstanceBuffer)))
+	{
+		InstanceBuffer = nullptr;
+		return false;
+	}
+
+	InstanceCapacity = NewCapacity;
+	return true;
+}
+
+bool FMeshInstanceMerger::Merge(D3D11RHI* RHIDevice, TArray<FMeshBatchElement>& InOutBatches, const TArray<FMeshDrawSortEntry>& SortedDraws, FMeshDrawPassStats& OutStats)
+{
+	MergedDraws.Empty();
+	Groups.Empty();
+	InstancedVariants.Empty();
+
+	const int32 NumDraws = SortedDraws.Num();
+	if (!RHIDevice || NumDraws < static_cast<int32>(MinInstances))
+	{
+		return false;
+	}
+
+	// --- 1. 같은 상태 구간마다 같은 드로우를 그룹으로 묶는다 ---
+	NextInGroup.SetNum(NumDraws);
+	int32 SpanGroupBegin = 0;
+	uint64 SpanState = ~0ull;
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
+	{
+		const uint64 State = SortedDraws[DrawIndex].Key >> FMeshDrawSorter::VertexBufferShift;
+		if (State != SpanState)
+		{
+			SpanState = State;
+			SpanGroupBegin = Groups.Num();
+		}
+
+		NextInGroup[DrawIndex] = -1;
+		const FMeshBatchElement& Batch = InOutBatches[SortedDraws[DrawIndex].Index];
+		const bool bInstanceable = CanInstance(Batch);
+
+		int32 GroupIndex = -1;
+		if (bInstanceable)
+		{
+			const int32 SearchEnd = std::max(SpanGroupBegin, Groups.Num() - MaxGroupSearch);
+			for (int32 Candidate = Groups.Num() - 1; Candidate >= SearchEnd; --Candidate)
+			{
+				const FInstanceGroup& Group = Groups[Candidate];
+				if (Group.bInstanceable && IsSameDraw(InOutBatches[SortedDraws[Group.First].Index], Batch))
+				{
+					GroupIndex = Candidate;
+					break;
+				}
+			}
+		}
+
+		if (GroupIndex < 0)
+		{
+			FInstanceGroup& NewGroup = Groups[Groups.Emplace()];
+			NewGroup.First = DrawIndex;
+			NewGroup.Last = DrawIndex;
+			NewGroup.Count = 1;
+			NewGroup.bInstanceable = bInstanceable;
+			continue;
+		}
+
+		FInstanceGroup& Group = Groups[GroupIndex];
+		NextInGroup[Group.Last] = DrawIndex;
+		Group.Last = DrawIndex;
+		++Group.Count;
+	}
+
+	// --- 2. 인스턴싱할 그룹 결정 (셰이더 변형이 없으면 원래 경로) ---
+	uint32 TotalInstances = 0;
+	int32 NumInstancedGroups = 0;
+	for (FInstanceGroup& Group : Groups)
+	{
+		if (!Group.bInstanceable || Group.Count < MinInstances)
+		{
+			continue;
+		}
+		Group.InstancedVariant = GetInstancedVariant(InOutBatches[SortedDraws[Group.First].Index]);
+		if (Group.InstancedVariant)
+		{
+			TotalInstances += Group.Count;
+			++NumInstancedGroups;
+		}
+	}
+
+	if (NumInstancedGroups == 0 || !EnsureInstanceBuffer(RHIDevice, TotalInstances))
+	{
+		return false;
+	}
+
+	ID3D11DeviceContext* Context = RHIDevice->GetDeviceContext();
+	D3D11_MAPPED_SUBRESOURCE Mapped = {};
+	if (FAILED(Context->Map(InstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+	{
+		return false;
+	}
+	FStaticMeshInstanceData* Instances = static_cast<FStaticMeshInstanceData*>(Mapped.pData);
+
+	// --- 3. 그룹 순서대로 드로우 목록을 다시 만들고 인스턴스 데이터를 채운다 ---
+	InOutBatches.Reserve(InOutBatches.Num() + NumInstancedGroups);
+	MergedDraws.Reserve(NumDraws - static_cast<int32>(TotalInstances) + NumInstancedGroups);
+
+	uint32 WrittenInstances = 0;
+	for (const FInstanceGroup& Group : Groups)
+	{
+		if (!Group.InstancedVariant)
+		{
+			for (int32 DrawIndex = Group.First; DrawIndex >= 0; DrawIndex = NextInGroup[DrawIndex])
+			{
+				MergedDraws.Add(SortedDraws[DrawIndex]);
+			}
+			continue;
+		}
+
+		// InOutBatches에 추가하기 전에 대표 배치를 복사해 둔다 (참조 무효화 방지)
+		FMeshBatchElement Merged = InOutBatches[SortedDraws[Group.First].Index];
+		Merged.VertexShader = Group.InstancedVariant->VertexShader;
+		Merged.PixelShader = Group.InstancedVariant->PixelShader;
+		Merged.InputLayout = Group.InstancedVariant->InputLayout;
+		Merged.WorldMatrix = FMatrix::Identity();
+		Merged.bInstancedDraw = true;
+		Merged.InstanceVertexBuffer = InstanceBuffer;
+		Merged.InstanceStride = sizeof(FStaticMeshInstanceData);
+		Merged.InstanceStart = WrittenInstances;
+		Merged.InstanceCount = Group.Count;
+
+		for (int32 DrawIndex = Group.First; DrawIndex >= 0; DrawIndex = NextInGroup[DrawIndex])
+		{
+			const FMeshBatchElement& Source = InOutBatches[SortedDraws[DrawIndex].Index];
+			FStaticMeshInstanceData& Instance = Instances[WrittenInstances++];
+			Instance.WorldMatrix = Source.WorldMatrix;
+			Instance.WorldInverseTranspose = Source.WorldMatrix.InverseAffine().Transpose();
+			Instance.ObjectID = Source.ObjectID;
+		}
+
+		FMeshDrawSortEntry Entry;
+		Entry.Key = SortedDraws[Group.First].Key;
+		Entry.Index = static_cast<uint32>(InOutBatches.Add(Merged));
+		MergedDraws.Add(Entry);
+	}
+
+	Context->Unmap(InstanceBuffer, 0);
+
+	OutStats.InstancedDraws += static_cast<uint32>(NumInstancedGroups);
+	OutStats.InstancedObjects += TotalInstances;
+	return true;
+}
@@ -0,0 +1,69 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "MeshDrawSort.h"
+
+struct FMeshBatchElement;
+struct FMeshDrawPassStats;
+struct FShaderVariant;
+class D3D11RHI;
+
+/**
+ * 정렬된 드로우 목록에서 같은 메시 섹션 / 머티리얼 / 셰이더를 쓰는 배치를 인스턴스드 드로우 하나로 합친다
+ * - 정렬 키에서 깊이만 다른 구간(같은 Pass/Priority/Shader/Material/VB) 안에서만 묶으므로 상태 순서는 그대로다
+ * - 합친 배치의 월드 행렬과 ObjectID는 매 프레임 다시 채우는 동적 인스턴스 버퍼에 들어가고,
+ *   셰이더는 같은 매크로에 USE_INSTANCING을 더한 변형으로 바꾼다
+ * - 버퍼를 프레임 사이에 유지해야 하므로 URenderer가 소유한다 (FSceneRenderer는 뷰마다 새로 만들어짐)
+ */
+class FMeshInstanceMerger
+{
+public:
+	/** 이 수 이상 모여야 인스턴싱 (한 개는 기존 경로가 더 싸다) */
+	static constexpr uint32 MinInstances = 2;
+	/** 같은 상태 구간 안에서 새 배치와 비교해 볼 최근 그룹 수 */
+	static constexpr int32 MaxGroupSearch = 8;
+
+	FMeshInstanceMerger() = default;
+	~FMeshInstanceMerger();
+
+	FMeshInstanceMerger(const FMeshInstanceMerger&) = delete;
+	FMeshInstanceMerger& operator=(const FMeshInstanceMerger&) = delete;
+
+	/**
+	 * SortedDraws 순서를 따라 합칠 수 있는 배치를 묶는다
+	 * 합친 배치는 InOutBatches 뒤에 새로 추가되고, 그 배치를 가리키는 새 드로우 순서는 GetMergedDraws()로 얻는다
+	 * @return 하나라도 합쳤으면 true (false면 SortedDraws를 그대로 쓰면 된다)
+	 */
+	bool Merge(D3D11RHI* RHIDevice, TArray<FMeshBatchElement>& InOutBatches, const TArray<FMeshDrawSortEntry>& SortedDraws, FMeshDrawPassStats& OutStats);
+
+	const TArray<FMeshDrawSortEntry>& GetMergedDraws() const { return MergedDraws; }
+
+	void Release();
+
+private:
+	// SortedDraws 안의 인덱스로 이어 붙인 같은 드로우 묶음 (NextInGroup으로 연결)
+	struct FInstanceGroup
+	{
+		int32 First = -1;
+		int32 Last = -1;
+		uint32 Count = 0;
+		bool bInstanceable = false;
+		const FShaderVariant* InstancedVariant = nullptr;
+	};
+
+	static bool CanInstance(const FMeshBatchElement& Batch);
+	static bool IsSameDraw(const FMeshBatchElement& A, const FMeshBatchElement& B);
+
+	const FShaderVariant* GetInstancedVariant(const FMeshBatchElement& Batch);
+	bool EnsureInstanceBuffer(D3D11RHI* RHIDevice, uint32 NumInstances);
+
+	ID3D11Buffer* InstanceBuffer = nullptr;
+	uint32 InstanceCapacity = 0;
+
+	// Merge마다 다시 쓰는 작업 배열 (용량 유지)
+	TArray<FInstanceGroup> Groups;
+	TArray<int32> NextInGroup;
+	TArray<FMeshDrawSortEntry> MergedDraws;
+
+	// 원래 변형 → USE_INSTANCING 변형. 핫 리로드로 변형이 바뀔 수 있어 Merge마다 비운다
+	TMap<const FShaderVariant*, const FShaderVariant*> InstancedVariants;
+};
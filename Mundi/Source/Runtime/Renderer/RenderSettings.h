@@ -40,6 +40,10 @@ public:
     void SetShadowAATechnique(EShadowAATechnique In) { ShadowAATechnique = In; }
     EShadowAATechnique GetShadowAATechnique() const { return ShadowAATechnique; }
 
+    // 파티클 패스 전에 이번 프레임의 파티클 Job을 모두 기다릴지 (디버깅/결정적 캡처용)
+    void SetWaitForParticleJobs(bool bEnable) { bWaitForParticleJobs = bEnable; }
+    bool ShouldWaitForParticleJobs() const { return bWaitForParticleJobs; }
+
 private:
     EEngineShowFlags ShowFlags = EEngineShowFlags::SF_DefaultEnabled;
     EViewMode ViewMode = EViewMode::VMI_Lit_Phong;
@@ -55,4 +59,7 @@ private:
 
     // 그림자 안티 에일리어싱
     EShadowAATechnique ShadowAATechnique = EShadowAATechnique::PCF; // 기본값 PCF
+
+    // 파티클 프레임 펜스 대기 (기본은 기다리지 않고 완료된 결과만 그린다)
+    bool bWaitForParticleJobs = false;
 };
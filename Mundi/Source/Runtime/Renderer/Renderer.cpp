@@ -114,7 +114,7 @@ UPrimitiveComponent* URenderer::GetPrimitiveCollided(int MouseX, int MouseY) con
 		DeviceContext->Unmap(RHIDevice->GetIdStagingBuffer(), 0);
 	}
 
-	if (PickedId == 0)
+	if (PickedId == 0 || !GUObjectArray.IsValidIndex(static_cast<int32>(PickedId)))
 		return nullptr;
 	return Cast<UPrimitiveComponent>(GUObjectArray[PickedId]);
 }
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "RHIDevice.h"
 #include "LineDynamicMesh.h"
+#include "MeshInstanceMerger.h"
 
 class UStaticMeshComponent;
 class UTextRenderComponent;
@@ -52,6 +53,9 @@ public:
 
 	D3D11RHI* GetRHIDevice() { return RHIDevice; }
 
+	// 뷰마다 새로 만들어지는 FSceneRenderer가 프레임 사이에 인스턴스 버퍼를 재사용하도록 여기서 소유
+	FMeshInstanceMerger& GetInstanceMerger() { return InstanceMerger; }
+
 	void SetCurrentCamera(ACameraActor* InCamera) { CurrentCamera = InCamera; }
 	ACameraActor* GetCurrentCamera() const { return CurrentCamera; }
 
@@ -81,6 +85,9 @@ private:
 
 	void InitializePrimitiveBatch();
 
+	// 스태틱 메시 자동 인스턴싱 (동적 인스턴스 버퍼 포함)
+	FMeshInstanceMerger InstanceMerger;
+
 	// 이전 drawCall에서 이미 썼던 RnderState면, 다시 Set 하지 않기 위해 만든 변수들
 	EViewMode PreViewModeIndex = EViewMode::VMI_Wireframe; // RSSetState, UpdateColorConstantBuffers
 	//UMaterial* PreUMaterial = nullptr; // SRV, UpdatePixelConstantBuffers
@@ -0,0 +1,290 @@
+﻿#include "pch.h"
+#include "RendererBenchmark.h"
+#include <random>
+#include "PlatformTime.h"
+#include "CameraComponent.h"
+#include "TileLightCuller.h"
+#include "MeshBatchElement.h"
+#include "MeshDrawSort.h"
+
+namespace
+{
+    // 배치 순서대로 그릴 때의 상태 전환 수 (DrawMeshBatches와 같은 기준)
+    struct FDrawStateChanges
+    {
+        uint32 Shader = 0;
+        uint32 Material = 0;
+        uint32 VertexBuffer = 0;
+    };
+
+    template<typename GetBatchFn>
+    FDrawStateChanges CountStateChanges(int32 Num, GetBatchFn GetBatch)
+    {
+        FDrawStateChanges Changes;
+        const FMeshBatchElement* Prev = nullptr;
+        for (int32 i = 0; i < Num; ++i)
+        {
+            const FMeshBatchElement& Batch = GetBatch(i);
+            if (!Prev || Prev->VertexShader != Batch.VertexShader || Prev->PixelShader != Batch.PixelShader) { ++Changes.Shader; }
+            if (!Prev || Prev->Material != Batch.Material) { ++Changes.Material; }
+            if (!Prev || Prev->VertexBuffer != Batch.VertexBuffer) { ++Changes.VertexBuffer; }
+            Prev = &Batch;
+        }
+        return Changes;
+    }
+
+    template<typename T>
+    T* FakeHandle(uint32 Id)
+    {
+        // 역참조하지 않는 식별용 포인터 (정렬/비교에만 쓴다)
+        return reinterpret_cast<T*>(static_cast<uintptr_t>(Id + 1) * 64);
+    }
+}
+
+void FRendererBenchmark::RunLightCullingBenchmark(int32 NumLights, uint32 Width, uint32 Height, int32 NumFrames)
+{
+    const int32 NumSpotLights = NumLights / 4;
+    const int32 NumPointLights = NumLights - NumSpotLights;
+    UE_LOG("[RendererBenchmark] Light culling: %d lights (P:%d S:%d) at %ux%u x %d frames",
+        NumLights, NumPointLights, NumSpotLights, Width, Height, NumFrames);
+
+    // 1. 원점에서 +X를 보는 카메라 앞에 라이트를 흩뿌린다 (깊이 방향으로 길게 겹치도록)
+    constexpr float NearClip = 1.0f;
+    constexpr float FarClip = 10000.0f;
+    UCameraComponent* Camera = NewObject<UCameraComponent>();
+    Camera->SetFOV(90.0f);
+    Camera->SetClipPlanes(NearClip, FarClip);
+    const FMatrix ViewMatrix = Camera->GetViewMatrix();
+    const FMatrix ProjMatrix = Camera->GetProjectionMatrix(static_cast<float>(Width) / static_cast<float>(Height));
+
+    std::mt19937 Rng(1234);
+    std::uniform_real_distribution<float> DepthDist(100.0f, 8000.0f);
+    std::uniform_real_distribution<float> SideDist(-4000.0f, 4000.0f);
+    std::uniform_real_distribution<float> HeightDist(-1500.0f, 1500.0f);
+    std::uniform_real_distribution<float> RadiusDist(100.0f, 600.0f);
+
+    TArray<FPointLightInfo> PointLights;
+    TArray<FSpotLightInfo> SpotLights;
+    PointLights.SetNum(NumPointLights);
+    SpotLights.SetNum(NumSpotLights);
+    for (FPointLightInfo& Light : PointLights)
+    {
+        Light = FPointLightInfo{};
+        Light.Position = FVector(DepthDist(Rng), SideDist(Rng), HeightDist(Rng));
+        Light.AttenuationRadius = RadiusDist(Rng);
+    }
+    for (FSpotLightInfo& Light : SpotLights)
+    {
+        Light = FSpotLightInfo{};
+        Light.Position = FVector(DepthDist(Rng), SideDist(Rng), HeightDist(Rng));
+        Light.Direction = FVector(0.0f, 0.0f, -1.0f);
+        Light.AttenuationRadius = RadiusDist(Rng);
+    }
+
+    // 2. 이전 방식 (타일마다 프러스텀 + 전체 라이트 평면 테스트)
+    FTileLightCuller TileCuller;
+    TileCuller.Initialize(nullptr, 16);
+    TileCuller.CullLightsPerTileFrustum(PointLights, SpotLights, ViewMatrix, ProjMatrix, NearClip, FarClip, Width, Height);
+    const uint64 TileStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        TileCuller.CullLightsPerTileFrustum(PointLights, SpotLights, ViewMatrix, ProjMatrix, NearClip, FarClip, Width, Height);
+    }
+    const double TileMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - TileStart) / FMath::Max(NumFrames, 1);
+    const FTileCullingStats TileStats = TileCuller.GetStats();
+
+    // 3. 클러스터 방식 (뷰 공간 변환 1회 + 슬라이스별 사각형 분배, 슬라이스 병렬)
+    FTileLightCuller ClusterCuller;
+    ClusterCuller.Initialize(nullptr, 16);
+    ClusterCuller.CullLights(PointLights, SpotLights, ViewMatrix, ProjMatrix, NearClip, FarClip, Width, Height);
+    const uint64 ClusterStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        ClusterCuller.CullLights(PointLights, SpotLights, ViewMatrix, ProjMatrix, NearClip, FarClip, Width, Height);
+    }
+    const double ClusterMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ClusterStart) / FMath::Max(NumFrames, 1);
+    const FTileCullingStats ClusterStats = ClusterCuller.GetStats();
+
+    // 4. 임의의 화면 위치 + 깊이 샘플에서 셰이더가 순회할 라이트 수 비교, 실제로 닿는 라이트 누락 검사
+    TArray<FVector> ViewCenters;
+    TArray<float> Radii;
+    TArray<uint32> PackedIndices;
+    for (int32 i = 0; i < NumPointLights; ++i)
+    {
+        ViewCenters.Add(ViewMatrix.TransformPosition(PointLights[i].Position));
+        Radii.Add(PointLights[i].AttenuationRadius);
+        PackedIndices.Add(static_cast<uint32>(i));
+    }
+    for (int32 i = 0; i < NumSpotLights; ++i)
+    {
+        ViewCenters.Add(ViewMatrix.TransformPosition(SpotLights[i].Position));
+        Radii.Add(SpotLights[i].AttenuationRadius);
+        PackedIndices.Add((1u << 16) | static_cast<uint32>(i));
+    }
+
+    constexpr int32 NumSamples = 4096;
+    constexpr uint32 TileSize = 16;
+    const uint32 TileCountX = (Width + TileSize - 1) / TileSize;
+    const uint32 TileCountY = (Height + TileSize - 1) / TileSize;
+    const TArray<uint32>& TileData = TileCuller.GetTileLightIndices();
+    const TArray<uint32>& ClusterData = ClusterCuller.GetClusterLightData();
+    std::uniform_int_distribution<uint32> PixelXDist(0, Width - 1);
+    std::uniform_int_distribution<uint32> PixelYDist(0, Height - 1);
+    std::uniform_real_distribution<float> LogDepthDist(std::log2(50.0f), std::log2(9000.0f));
+
+    uint64 TileLightsVisited = 0;
+    uint64 ClusterLightsVisited = 0;
+    uint64 LightsAffecting = 0;
+    int32 MissedLights = 0;
+    for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+    {
+        const uint32 PixelX = PixelXDist(Rng);
+        const uint32 PixelY = PixelYDist(Rng);
+        const float ViewZ = std::exp2(LogDepthDist(Rng));
+
+        // 픽셀 중심 → 뷰 공간 점
+        const float NdcX = ((static_cast<float>(PixelX) + 0.5f) / static_cast<float>(Width)) * 2.0f - 1.0f;
+        const float NdcY = 1.0f - ((static_cast<float>(PixelY) + 0.5f) / static_cast<float>(Height)) * 2.0f;
+        const FVector ViewPoint(NdcX * ViewZ / ProjMatrix.M[0][0], NdcY * ViewZ / ProjMatrix.M[1][1], ViewZ);
+
+        const uint32 TileIndex = (PixelY / TileSize) * TileCountX + (PixelX / TileSize);
+        TileLightsVisited += TileData[TileIndex * 256];
+
+        // 셰이더(CalculateClusterIndex)와 같은 슬라이스 계산
+        int32 Slice = static_cast<int32>(std::floor(std::log2(ViewZ) * ClusterCuller.GetClusterSliceScale() + ClusterCuller.GetClusterSliceBias()));
+        Slice = FMath::Clamp(Slice, 0, static_cast<int32>(FTileLightCuller::ClusterSliceCount) - 1);
+        const uint32 ClusterIndex = static_cast<uint32>(Slice) * TileCountX * TileCountY + TileIndex;
+        const uint32 ListOffset = ClusterData[ClusterIndex * 2];
+        const uint32 ListCount = ClusterData[ClusterIndex * 2 + 1];
+        ClusterLightsVisited += ListCount;
+
+        for (int32 LightIdx = 0; LightIdx < ViewCenters.Num(); ++LightIdx)
+        {
+            const FVector Delta = ViewPoint - ViewCenters[LightIdx];
+            if (FVector::Dot(Delta, Delta) >= Radii[LightIdx] * Radii[LightIdx])
+            {
+                continue;
+            }
+
+            ++LightsAffecting;
+            bool bFound = false;
+            for (uint32 i = 0; i < ListCount && !bFound; ++i)
+            {
+                bFound = ClusterData[ListOffset + i] == PackedIndices[LightIdx];
+            }
+            MissedLights += bFound ? 0 : 1;
+        }
+    }
+
+    UE_LOG("[RendererBenchmark] Tile frustum (2D)  : %.3f ms/frame, %u tiles, buffer %u KB, avg %.2f lights/tile",
+        TileMs, TileStats.TotalTileCount, TileStats.LightIndexBufferSizeBytes / 1024, TileStats.AvgLightsPerCluster);
+    UE_LOG("[RendererBenchmark] Clustered (x%u)    : %.3f ms/frame (x%.1f), %u clusters, buffer %u KB, avg %.2f lights/cluster",
+        FTileLightCuller::ClusterSliceCount, ClusterMs, ClusterMs > 0.0 ? TileMs / ClusterMs : 0.0,
+        ClusterStats.TotalClusterCount, ClusterStats.LightIndexBufferSizeBytes / 1024, ClusterStats.AvgLightsPerCluster);
+    UE_LOG("[RendererBenchmark] Lights visited per shaded sample: tile %.2f, cluster %.2f, actually affecting %.2f (%d samples)",
+        static_cast<double>(TileLightsVisited) / NumSamples,
+        static_cast<double>(ClusterLightsVisited) / NumSamples,
+        static_cast<double>(LightsAffecting) / NumSamples, NumSamples);
+    if (MissedLights > 0)
+    {
+        UE_LOG("[RendererBenchmark] WARNING: clustered lists missed %d affecting lights", MissedLights);
+    }
+
+    ObjectFactory::DeleteObject(Camera);
+}
+
+void FRendererBenchmark::RunDrawSortBenchmark(int32 NumBatches, int32 NumFrames)
+{
+    constexpr uint32 NumShaders = 8;
+    constexpr uint32 NumMaterials = 256;
+    constexpr uint32 NumMeshes = 512;
+    UE_LOG("[RendererBenchmark] Draw sort: %d batches (shaders %u, materials %u, meshes %u) x %d frames, FMeshBatchElement %u bytes",
+        NumBatches, NumShaders, NumMaterials, NumMeshes, NumFrames, static_cast<uint32>(sizeof(FMeshBatchElement)));
+
+    // 1. 씬 수집 순서를 흉내 낸 무작위 배치 (메시가 머티리얼을 대체로 고정해서 쓰도록)
+    std::mt19937 Rng(4321);
+    std::uniform_int_distribution<uint32> MeshDist(0, NumMeshes - 1);
+    std::uniform_real_distribution<float> PosDist(-5000.0f, 5000.0f);
+    std::uniform_real_distribution<float> DepthDist(10.0f, 10000.0f);
+
+    TArray<FMeshBatchElement> Batches;
+    Batches.SetNum(NumBatches);
+    for (FMeshBatchElement& Batch : Batches)
+    {
+        const uint32 Mesh = MeshDist(Rng);
+        const uint32 Material = (Mesh * 7) % NumMaterials;
+        const uint32 Shader = Material % NumShaders;
+        Batch.VertexShader = FakeHandle<ID3D11VertexShader>(Shader);
+        Batch.PixelShader = FakeHandle<ID3D11PixelShader>(Shader);
+        Batch.Material = FakeHandle<UMaterialInterface>(Material);
+        Batch.VertexBuffer = FakeHandle<ID3D11Buffer>(Mesh * 2);
+        Batch.IndexBuffer = FakeHandle<ID3D11Buffer>(Mesh * 2 + 1);
+        Batch.WorldMatrix = FMatrix::Identity();
+        Batch.WorldMatrix.M[3][0] = DepthDist(Rng);
+        Batch.WorldMatrix.M[3][1] = PosDist(Rng);
+        Batch.WorldMatrix.M[3][2] = PosDist(Rng);
+    }
+
+    // 뷰 행렬은 +X를 보는 카메라의 축 교환만 (깊이 = 월드 X)
+    FMatrix ViewMatrix = FMatrix::Identity();
+    ViewMatrix.M[0][0] = 0.0f; ViewMatrix.M[0][2] = 1.0f;
+    ViewMatrix.M[1][1] = 0.0f; ViewMatrix.M[1][0] = 1.0f;
+    ViewMatrix.M[2][2] = 0.0f; ViewMatrix.M[2][1] = 1.0f;
+
+    const FDrawStateChanges Unsorted = CountStateChanges(NumBatches, [&](int32 i) -> const FMeshBatchElement& { return Batches[i]; });
+
+    // 2. 이전 방식: 배열 사본을 operator<로 정렬 (사본 만드는 시간은 제외)
+    TArray<FMeshBatchElement> Copy;
+    double LegacyMs = 0.0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Copy = Batches;
+        const uint64 Start = FPlatformTime::Cycles64();
+        Copy.Sort();
+        LegacyMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Start);
+    }
+    LegacyMs /= NumFrames;
+    const FDrawStateChanges Legacy = CountStateChanges(NumBatches, [&](int32 i) -> const FMeshBatchElement& { return Copy[i]; });
+
+    // 3. 새 방식: 키 생성 + Radix (키 생성 포함)
+    FMeshDrawSorter Sorter;
+    double KeyMs = 0.0;
+    double RadixMs = 0.0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        const uint64 Start = FPlatformTime::Cycles64();
+        Sorter.Reset();
+        for (int32 i = 0; i < NumBatches; ++i)
+        {
+            Sorter.Add(Batches[i], static_cast<uint32>(i), EMeshDrawPass::Opaque, ViewMatrix, false);
+        }
+        const uint64 KeyEnd = FPlatformTime::Cycles64();
+        Sorter.Sort();
+        const uint64 End = FPlatformTime::Cycles64();
+        KeyMs += FPlatformTime::ToMilliseconds(KeyEnd - Start);
+        RadixMs += FPlatformTime::ToMilliseconds(End - KeyEnd);
+    }
+    KeyMs /= NumFrames;
+    RadixMs /= NumFrames;
+
+    const TArray<FMeshDrawSortEntry>& Entries = Sorter.GetEntries();
+    const FDrawStateChanges Keyed = CountStateChanges(NumBatches, [&](int32 i) -> const FMeshBatchElement& { return Batches[Entries[i].Index]; });
+
+    int32 OrderErrors = 0;
+    for (int32 i = 1; i < Entries.Num(); ++i)
+    {
+        OrderErrors += Entries[i - 1].Key > Entries[i].Key ? 1 : 0;
+    }
+
+    const double NewMs = KeyMs + RadixMs;
+    UE_LOG("[RendererBenchmark] Batch Sort (operator<) : %.3f ms/frame, changes shader %u / material %u / VB %u",
+        LegacyMs, Legacy.Shader, Legacy.Material, Legacy.VertexBuffer);
+    UE_LOG("[RendererBenchmark] Key + Radix           : %.3f ms/frame (key %.3f + sort %.3f, x%.1f), changes shader %u / material %u / VB %u",
+        NewMs, KeyMs, RadixMs, NewMs > 0.0 ? LegacyMs / NewMs : 0.0, Keyed.Shader, Keyed.Material, Keyed.VertexBuffer);
+    UE_LOG("[RendererBenchmark] Unsorted              : changes shader %u / material %u / VB %u",
+        Unsorted.Shader, Unsorted.Material, Unsorted.VertexBuffer);
+    if (OrderErrors > 0)
+    {
+        UE_LOG("[RendererBenchmark] WARNING: radix output has %d out-of-order keys", OrderErrors);
+    }
+}
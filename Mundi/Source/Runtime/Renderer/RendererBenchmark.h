@@ -0,0 +1,23 @@
+﻿#pragma once
+
+/**
+ * 렌더러 CPU 패스 헤드리스 벤치마크 (콘솔: BENCH LIGHTS, BENCH DRAWSORT)
+ * RHI 없이 CPU 측 결과만 만들어 비용을 잰다
+ */
+class FRendererBenchmark
+{
+public:
+    /**
+     * Width x Height 뷰포트 앞에 흩어진 NumLights개(포인트 3/4, 스포트 1/4)의 라이트를 NumFrames번 컬링해
+     * 이전 2D 타일 프러스텀 방식과 클러스터 방식의 프레임당 시간, 버퍼 크기, 샘플 픽셀당 순회 라이트 수를 로그로 출력
+     * (클러스터 결과가 실제로 닿는 라이트를 빠뜨리지 않는지도 같이 검사)
+     */
+    static void RunLightCullingBenchmark(int32 NumLights = 1024, uint32 Width = 1920, uint32 Height = 1080, int32 NumFrames = 10);
+
+    /**
+     * 가짜 셰이더/머티리얼/버퍼 포인터로 만든 NumBatches개 배치를 NumFrames번 정렬해
+     * 이전 방식(FMeshBatchElement 배열을 operator<로 Sort)과 64-bit 키 + Radix 방식의 프레임당 시간,
+     * 정렬 결과 순서대로 그릴 때의 셰이더/머티리얼/VB 전환 수를 로그로 출력
+     */
+    static void RunDrawSortBenchmark(int32 NumBatches = 20000, int32 NumFrames = 20);
+};
@@ -45,10 +45,13 @@
 #include "LineComponent.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "Hash.h"
 #include "PlatformTime.h"
+#include "JobSystem.h"
 #include "PostProcessing/VignettePass.h"
 #include "Source/Editor/FBX/FbxLoader.h"
 #include "SkinnedMeshComponent.h"
+#include "SkeletalMeshComponent.h"
 #include "SkinningStats.h"
 #include "StatsOverlayD2D.h"
 #include "Source/Runtime/Engine/Particle/ParticleStats.h"
@@ -92,10 +95,14 @@ void FSceneRenderer::Render()
     // (Background is cleared per-path when binding scene color)
     // 렌더링할 대상 수집 (Cull + Gather)
     GatherVisibleProxies();
+	DrawStats.Reset();
 
 	TIME_PROFILE(ShadowMapPass)
 	RenderShadowMaps();
 	TIME_PROFILE_END(ShadowMapPass)
+
+	// 뷰 컬링 + 라이트별 캐스터 컬링 결과
+	FCullingStatManager::GetInstance().UpdateStats(CullingStats);
 	
 	// ViewMode에 따라 렌더링 경로 결정
 	if (View->RenderSettings->GetViewMode() == EViewMode::VMI_Lit_Phong ||
@@ -148,6 +155,9 @@ void FSceneRenderer::Render()
 
     // BackBuffer 위에 라인 오버레이(항상 위)를 그린다
     RenderFinalOverlayLines();
+
+	// 패스별 드로우 정렬 시간 / 상태 변경 횟수
+	FMeshDrawStatManager::GetInstance().UpdateStats(DrawStats);
 }
 
 //====================================================================================
@@ -242,18 +252,63 @@ void FSceneRenderer::RenderSceneDepthPath()
 // 그림자맵 구현
 //====================================================================================
 
+namespace
+{
+	// 행렬을 비트 패턴 그대로 해시 (조금이라도 움직이면 정적 섀도우 캐시가 무효화된다)
+	uint64 HashMatrixBits(uint64 Seed, const FMatrix& Matrix)
+	{
+		uint64 Words[8];
+		std::memcpy(Words, &Matrix.M[0][0], sizeof(Words));
+		for (uint64 Word : Words)
+		{
+			Seed = HashCombine(Seed, Word);
+		}
+		return Seed;
+	}
+
+	uint64 HashFloatBits(uint64 Seed, float Value)
+	{
+		uint32 Bits;
+		std::memcpy(&Bits, &Value, sizeof(Bits));
+		return HashCombine(Seed, Bits);
+	}
+
+	// 포인트 라이트 반경 구와 AABB의 교차 (면 프러스텀 쿼리 전에 반경 밖의 캐스터를 싸게 걸러낸다)
+	bool IntersectsLightSphere(const FAABB& Bounds, const FVector& Center, float Radius)
+	{
+		const float DX = std::max({ Bounds.Min.X - Center.X, 0.0f, Center.X - Bounds.Max.X });
+		const float DY = std::max({ Bounds.Min.Y - Center.Y, 0.0f, Center.Y - Bounds.Max.Y });
+		const float DZ = std::max({ Bounds.Min.Z - Center.Z, 0.0f, Center.Z - Bounds.Max.Z });
+		return DX * DX + DY * DY + DZ * DZ <= Radius * Radius;
+	}
+}
+
 void FSceneRenderer::RenderShadowMaps()
 {
     FLightManager* LightManager = World->GetLightManager();
 	if (!LightManager) return;
 
 	// 2. 그림자 캐스터(Caster) 메시 수집
+	// 뷰 밖의 메시도 그림자를 드리울 수 있으므로 뷰 컬링 전 후보 전체를 한 번만 수집하고,
+	// 섀도우 요청마다 라이트 프러스텀에 들어오는 캐스터의 배치 구간만 골라 그린다
 	TArray<FMeshBatchElement> ShadowMeshBatches;
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
-	{
-		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
+	TArray<FMeshBatchElement> RequestShadowBatches;
+	ShadowCasterRanges.Empty();
+	CollectMeshBatchesParallel(Proxies.ShadowCasters, ShadowMeshBatches, &CollectBatchCounts, nullptr);
+
+	int32 FirstBatch = 0;
+	for (int32 CasterIndex = 0; CasterIndex < Proxies.ShadowCasters.Num(); ++CasterIndex)
+	{
+		UMeshComponent* MeshComponent = Proxies.ShadowCasters[CasterIndex];
+		FShadowCasterBatchRange Range;
+		Range.Component = MeshComponent;
+		Range.FirstBatch = FirstBatch;
+		Range.NumBatches = CollectBatchCounts[CasterIndex];
+		Range.bStaticMesh = MeshComponent->IsA(UStaticMeshComponent::StaticClass());
+		FirstBatch += Range.NumBatches;
+		if (Range.NumBatches > 0)
 		{
-			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
+			ShadowCasterRanges.Add(Range);
 		}
 	}
 
@@ -337,6 +392,15 @@ void FSceneRenderer::RenderShadowMaps()
 	// 2.2. 큐브맵 슬라이스 할당 (Allocate only)
 	LightManager->AllocateAtlasCubeSlices(RequestsCube); // FLightManager가 RequestsCube의 AssignedSliceIndex와 Size 업데이트
 
+	// 정적 섀도우 캐시: 라이트/캐스터가 직전 패스와 같고 영역도 그대로인 요청은 아틀라스 내용을 재사용한다
+	// 섀도우 AA 기법이 바뀌면 아틀라스에 담긴 값의 의미가 달라지므로 시그니처 시드에 섞는다
+	LightManager->BeginShadowCachePass();
+	EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
+	const uint64 ShadowSignatureSeed = HashCombine(0, static_cast<uint64>(ShadowAAType) + 1);
+	ShadowRequestCount = 0;
+	ShadowRequestCasterCount = 0;
+	ShadowCacheHitCount = 0;
+
 	// --- 1단계: 2D 아틀라스 렌더링 (Spot + Directional) ---
 	{
 		ID3D11DepthStencilView* AtlasDSV2D = LightManager->GetShadowAtlasDSV2D();
@@ -348,8 +412,9 @@ void FSceneRenderer::RenderShadowMaps()
 			ID3D11ShaderResourceView* NullSRV[2] = { nullptr, nullptr };
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(9, 2, NullSRV);
 			
+			// 재사용할 영역이 하나도 없으면 아틀라스 전체를 한 번에 지우고, 있으면 다시 그리는 영역만 지운다
+			const bool bClearWholeAtlas = !LightManager->HasReusableShadowCache2D();
 			float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f};
-			EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
 			switch (ShadowAAType)
 			{
 			case EShadowAATechnique::PCF:
@@ -358,7 +423,10 @@ void FSceneRenderer::RenderShadowMaps()
 			case EShadowAATechnique::VSM:
 				{
 					RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
-					RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
+					if (bClearWholeAtlas)
+					{
+						RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
+					}
 					break;
 				}				
 			default:
@@ -366,7 +434,10 @@ void FSceneRenderer::RenderShadowMaps()
 				break;
 			}
 
-			RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
+			if (bClearWholeAtlas)
+			{
+				RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
+			}
 
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
@@ -377,8 +448,21 @@ void FSceneRenderer::RenderShadowMaps()
 				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
 				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
+				// 뎁스 패스 렌더링 (라이트 프러스텀 밖의 캐스터는 제외, 직전 패스 내용이 그대로면 건너뜀)
+				const uint64 Signature = CollectShadowCasterBatches(Request, false, ShadowSignatureSeed, ShadowMeshBatches, RequestShadowBatches);
+				if (LightManager->IsShadowCacheValid(Request, Signature, false))
+				{
+					++ShadowCacheHitCount;
+				}
+				else if (Request.Size > 0)
+				{
+					if (!bClearWholeAtlas)
+					{
+						ClearShadowAtlasRegion();
+					}
+					RenderShadowDepthPass(Request, RequestShadowBatches);
+				}
+				LightManager->MarkShadowCached(Request, Signature, false);
 
 				FShadowMapData Data;
 				if (Request.Size > 0) // 렌더링 성공
@@ -436,9 +520,19 @@ void FSceneRenderer::RenderShadowMaps()
 				ID3D11DepthStencilView* FaceDSV = LightManager->GetShadowCubeFaceDSV(SliceIndex, FaceIndex);
 				if (FaceDSV)
 				{
-					RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
-					RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
-					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					// 면 단위로 캐시를 판정하므로 정적인 면은 Clear도 드로우도 하지 않는다
+					const uint64 Signature = CollectShadowCasterBatches(Request, true, ShadowSignatureSeed, ShadowMeshBatches, RequestShadowBatches);
+					if (LightManager->IsShadowCacheValid(Request, Signature, true))
+					{
+						++ShadowCacheHitCount;
+					}
+					else
+					{
+						RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
+						RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
+						RenderShadowDepthPass(Request, RequestShadowBatches);
+					}
+					LightManager->MarkShadowCached(Request, Signature, true);
 				}
 			}
 		}
@@ -454,6 +548,116 @@ void FSceneRenderer::RenderShadowMaps()
 	
 	// ViewProjBufferType 복구 (라이트 시점 Override 일 경우 마지막 라이트 시점으로 설정됨)
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(OriginViewProjBuffer));
+
+	// 요청별 캐스터 수 / 캐시 적중률 통계 (아틀라스 정보는 GatherVisibleProxies에서 이미 채움)
+	FShadowStats ShadowStats = FShadowStatManager::GetInstance().GetStats();
+	ShadowStats.ShadowRequests = ShadowRequestCount;
+	ShadowStats.ShadowRequestCasters = ShadowRequestCasterCount;
+	ShadowStats.ShadowCacheHits = ShadowCacheHitCount;
+	ShadowStats.CalculateRequestStats();
+	FShadowStatManager::GetInstance().UpdateStats(ShadowStats);
+}
+
+void FSceneRenderer::ClearShadowAtlasRegion()
+{
+	static UShader* FullScreenTriangleVS = nullptr;
+	static UShader* RegionClearPS = nullptr;
+	if (!FullScreenTriangleVS)
+	{
+		FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+	}
+	if (!RegionClearPS)
+	{
+		RegionClearPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/ShadowRegionClear_PS.hlsl");
+	}
+	if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !RegionClearPS || !RegionClearPS->GetPixelShader())
+	{
+		return;
+	}
+
+	// 뷰포트가 요청 영역으로 잡혀 있으므로 전체 화면 삼각형이 그 영역만 덮는다
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::AlwaysWrite);
+	RHIDevice->PrepareShader(FullScreenTriangleVS, RegionClearPS);
+	RHIDevice->DrawFullScreenQuad();
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+}
+
+uint64 FSceneRenderer::CollectShadowCasterBatches(const FShadowRenderRequest& ShadowRequest, bool bCubeFace, uint64 SignatureSeed,
+	const TArray<FMeshBatchElement>& InCasterBatches, TArray<FMeshBatchElement>& OutBatches)
+{
+	OutBatches.Empty();
+	if (ShadowRequest.Size == 0)
+	{
+		return 0;
+	}
+
+	// 셰이더와 같은 View * Projection에서 평면을 뽑으므로 래스터라이저가 어차피 잘라낼 캐스터만 빠진다
+	const FFrustum LightFrustum = CreateFrustumFromViewProjection(ShadowRequest.ViewMatrix * ShadowRequest.ProjectionMatrix);
+	QueryVisibleComponents(LightFrustum, ShadowVisibleSet);
+
+	// 시그니처: 라이트 행렬/위치/반경 + 살아남은 캐스터들의 배치 (버퍼, 구간, 월드 행렬)
+	uint64 Signature = HashMatrixBits(SignatureSeed, ShadowRequest.ViewMatrix);
+	Signature = HashMatrixBits(Signature, ShadowRequest.ProjectionMatrix);
+	Signature = HashFloatBits(Signature, ShadowRequest.WorldLocation.X);
+	Signature = HashFloatBits(Signature, ShadowRequest.WorldLocation.Y);
+	Signature = HashFloatBits(Signature, ShadowRequest.WorldLocation.Z);
+	Signature = HashFloatBits(Signature, ShadowRequest.Radius);
+	bool bCacheable = true;
+
+	++CullingStats.ShadowViews;
+	++ShadowRequestCount;
+	for (const FShadowCasterBatchRange& Range : ShadowCasterRanges)
+	{
+		// 포인트 라이트는 반경 밖 캐스터를 면 프러스텀 검사 전에 제외 (여섯 면 모두 같은 구를 쓴다)
+		if (bCubeFace)
+		{
+			const FAABB WorldBounds = Range.Component->GetWorldAABB();
+			if (WorldBounds.IsValid() && !IntersectsLightSphere(WorldBounds, ShadowRequest.WorldLocation, ShadowRequest.Radius))
+			{
+				++CullingStats.ShadowCastersCulled;
+				continue;
+			}
+		}
+
+		if (!IsComponentVisible(LightFrustum, ShadowVisibleSet, Range.Component))
+		{
+			++CullingStats.ShadowCastersCulled;
+			continue;
+		}
+
+		++CullingStats.ShadowCastersDrawn;
+		++ShadowRequestCasterCount;
+		const auto First = InCasterBatches.begin() + Range.FirstBatch;
+		OutBatches.insert(OutBatches.end(), First, First + Range.NumBatches);
+
+		// 스킨드 메시처럼 같은 버퍼/행렬로도 모양이 바뀌는 캐스터가 있으면 캐시하지 않는다
+		if (!Range.bStaticMesh)
+		{
+			bCacheable = false;
+			continue;
+		}
+		if (!bCacheable)
+		{
+			continue;
+		}
+
+		Signature = HashCombine(Signature, reinterpret_cast<uint64>(Range.Component));
+		for (int32 BatchIndex = Range.FirstBatch; BatchIndex < Range.FirstBatch + Range.NumBatches; ++BatchIndex)
+		{
+			const FMeshBatchElement& Batch = InCasterBatches[BatchIndex];
+			Signature = HashCombine(Signature, reinterpret_cast<uint64>(Batch.VertexBuffer));
+			Signature = HashCombine(Signature, reinterpret_cast<uint64>(Batch.IndexBuffer));
+			Signature = HashCombine(Signature, (static_cast<uint64>(Batch.IndexCount) << 32) | Batch.StartIndex);
+			Signature = HashCombine(Signature, Batch.BaseVertexIndex);
+			Signature = HashMatrixBits(Signature, Batch.WorldMatrix);
+		}
+	}
+
+	if (!bCacheable)
+	{
+		return 0;
+	}
+	return Signature != 0 ? Signature : 1;
 }
 
 void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
@@ -677,9 +881,9 @@ void FSceneRenderer::PrepareView()
 
 void FSceneRenderer::GatherVisibleProxies()
 {
-	// NOTE: 일단 컴포넌트 단위와 데칼 관련 이슈 해결까지 컬링 무시
-	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
-	//PerformFrustumCulling();
+	// 컴포넌트 단위 절두체 컬링 수행 -> 결과가 멤버 변수 VisibleComponentSet에 저장됨
+	CullingStats.Reset();
+	PerformFrustumCulling();
 	FSkinningStatManager::GetInstance().ResetStats();
 
 	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
@@ -751,7 +955,28 @@ void FSceneRenderer::GatherVisibleProxies()
 
 						if (bShouldAdd)
 						{
-							Proxies.Meshes.Add(MeshComponent);
+							++CullingStats.TotalMeshes;
+
+							// 그림자는 라이트 프러스텀 기준으로 RenderShadowMaps에서 따로 컬링
+							if (MeshComponent->IsCastShadows())
+							{
+								Proxies.ShadowCasters.Add(MeshComponent);
+							}
+
+							if (IsComponentVisible(View->ViewFrustum, VisibleComponentSet, MeshComponent))
+							{
+								Proxies.Meshes.Add(MeshComponent);
+
+								// 다음 게임 Tick이 이 결과로 애니메이션 업데이트 빈도를 정한다
+								if (USkeletalMeshComponent* SkeletalComponent = Cast<USkeletalMeshComponent>(MeshComponent))
+								{
+									SkeletalComponent->MarkRenderedForAnimation(ComputeScreenSize(SkeletalComponent));
+								}
+							}
+							else
+							{
+								++CullingStats.CulledMeshes;
+							}
 						}
 					}
 					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
@@ -760,7 +985,12 @@ void FSceneRenderer::GatherVisibleProxies()
 					}
 					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent); DecalComponent && bDrawDecals)
 					{
-						Proxies.Decals.Add(DecalComponent);
+						// 데칼은 투영 볼륨(OBB)이 화면에 걸칠 때만 그린다
+						++CullingStats.TotalDecals;
+						if (IsOBBVisible(View->ViewFrustum, DecalComponent->GetWorldOBB()))
+						{
+							Proxies.Decals.Add(DecalComponent);
+						}
 					}
 					else if (ULineComponent* LineComponent = Cast<ULineComponent>(PrimitiveComponent))
 					{
@@ -816,6 +1046,9 @@ void FSceneRenderer::GatherVisibleProxies()
 		CollectComponentsFromActor(Actor, false);
 	}
 
+	CullingStats.VisibleMeshes = Proxies.Meshes.Num();
+	CullingStats.VisibleDecals = Proxies.Decals.Num();
+
 	// 라이트 통계 업데이트
 	FLightStats LightStats;
 	LightStats.TotalPointLights = SceneLocals.PointLights.Num();
@@ -914,10 +1147,13 @@ void FSceneRenderer::PerformTileLightCulling()
 	TileCullingBuffer.bUseTileCulling = bTileCullingEnabled ? 1 : 0;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartX = View->ViewRect.MinX;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartY = View->ViewRect.MinY;  // ShowFlag에 따라 설정
+	TileCullingBuffer.ClusterSliceCount = FTileLightCuller::ClusterSliceCount;
+	TileCullingBuffer.ClusterSliceScale = TileLightCuller->GetClusterSliceScale();
+	TileCullingBuffer.ClusterSliceBias = TileLightCuller->GetClusterSliceBias();
 
 	RHIDevice->SetAndUpdateConstantBuffer(TileCullingBuffer);
 
-	// Structured Buffer SRV를 t2 슬롯에 바인딩 (타일 컬링 활성화 시에만)
+	// Structured Buffer SRV를 t2 슬롯에 바인딩 (타일 컬링 활성화 시에만, 클러스터 헤더 + 인덱스 목록)
 	if (bTileCullingEnabled)
 	{
 		ID3D11ShaderResourceView* TileLightIndexSRV = TileLightCuller->GetLightIndexBufferSRV();
@@ -930,32 +1166,76 @@ void FSceneRenderer::PerformTileLightCulling()
 
 void FSceneRenderer::PerformFrustumCulling()
 {
-	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
+	QueryVisibleComponents(View->ViewFrustum, VisibleComponentSet);
+}
 
-	// Todo: 프로스텀 컬링 수행, 추후 프로스텀 컬링이 컴포넌트 단위로 변경되면 적용
+void FSceneRenderer::QueryVisibleComponents(const FFrustum& Frustum, TSet<UPrimitiveComponent*>& OutVisibleSet)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 
-	//World->GetPartitionManager()->FrustumQuery(ViewFrustum)
+	PotentiallyVisibleComponents.Empty();
+	OutVisibleSet.Empty();
 
-	//for (AActor* Actor : World->GetActors())
-	//{
-	//	if (!Actor || Actor->GetActorHiddenInEditor()) continue;
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	const FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (BVH)
+	{
+		BVH->QueryFrustumComponents(Frustum, PotentiallyVisibleComponents);
+		OutVisibleSet.reserve(PotentiallyVisibleComponents.Num());
+		OutVisibleSet.insert(PotentiallyVisibleComponents.begin(), PotentiallyVisibleComponents.end());
+	}
 
-	//	// 절두체 컬링을 통과한 액터만 목록에 추가
-	//	if (ViewFrustum.Intersects(Actor->GetBounds()))
-	//	{
-	//		PotentiallyVisibleActors.Add(Actor);
-	//	}
-	//}
+	CullingStats.CullingTimeMS += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+float FSceneRenderer::ComputeScreenSize(const UPrimitiveComponent* Component) const
+{
+	if (View->ProjectionMode != ECameraProjectionMode::Perspective)
+	{
+		return 1.0f;
+	}
+
+	const FAABB WorldBounds = Component->GetWorldAABB();
+	if (!WorldBounds.IsValid())
+	{
+		return 1.0f;
+	}
+
+	// 구 반지름 / (거리 * tan(FOV/2)) = 지름 / 그 거리의 화면 높이
+	const float Radius = WorldBounds.GetHalfExtent().Length();
+	const float Distance = FMath::Max((WorldBounds.GetCenter() - View->ViewLocation).Length(), 1.0f);
+	const float TanHalfFOV = std::tan(DegreesToRadians(View->FieldOfView) * 0.5f);
+	return Radius / (Distance * FMath::Max(TanHalfFOV, KINDA_SMALL_NUMBER));
+}
+
+bool FSceneRenderer::IsComponentVisible(const FFrustum& Frustum, const TSet<UPrimitiveComponent*>& VisibleSet, UPrimitiveComponent* Component) const
+{
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	const FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+
+	// BVH에 없는 컴포넌트, 더티 큐에 남아 바운드가 늦은 컴포넌트,
+	// 포즈에 따라 바운드가 바뀌는 스킨드 메시는 현재 AABB로 직접 판정
+	const bool bUseBVHResult = BVH && BVH->Contains(Component) && !Partition->IsDirty(Component)
+		&& !Component->IsA(USkinnedMeshComponent::StaticClass());
+	if (bUseBVHResult)
+	{
+		return VisibleSet.Contains(Component);
+	}
+
+	const FAABB WorldBounds = Component->GetWorldAABB();
+	if (!WorldBounds.IsValid())
+	{
+		return true; // 아직 바운드를 모르는 컴포넌트는 그린다
+	}
+	return IsAABBVisible(Frustum, WorldBounds);
 }
 
 void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 {
 	// --- 1. 수집 (Collect) ---
+	// 메시 컴포넌트는 워커 스레드에서 나눠 수집 (스키닝 업로드 등 D3D 갱신은 그 전에 직렬로)
 	MeshBatchElements.Empty();
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
-	{
-		MeshComponent->CollectMeshBatches(MeshBatchElements, View);
-	}
+	CollectMeshBatchesParallel(Proxies.Meshes, MeshBatchElements, nullptr, &DrawStats.Opaque);
 
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
 	{
@@ -969,12 +1249,121 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 	}
 
 	// --- 2. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
+	// 배치는 제자리에 두고 (64-bit 키, 인덱스)만 정렬. 같은 상태 안에서는 앞에서 뒤로 (Early-Z)
+	const uint64 SortStart = FPlatformTime::Cycles64();
+	DrawSorter.Reset();
+	for (int32 Index = 0; Index < MeshBatchElements.Num(); ++Index)
+	{
+		DrawSorter.Add(MeshBatchElements[Index], Index, EMeshDrawPass::Opaque, View->ViewMatrix, false);
+	}
+	DrawSorter.Sort();
+	DrawStats.Opaque.SortTimeMS += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - SortStart);
+	DrawStats.Opaque.NumDraws += DrawSorter.Num();
+
+	// --- 2.5 자동 인스턴싱: 같은 메시 섹션/머티리얼/셰이더 배치를 인스턴스드 드로우 하나로 ---
+	const uint64 MergeStart = FPlatformTime::Cycles64();
+	FMeshInstanceMerger& InstanceMerger = OwnerRenderer->GetInstanceMerger();
+	const bool bMerged = InstanceMerger.Merge(RHIDevice, MeshBatchElements, DrawSorter.GetEntries(), DrawStats.Opaque);
+	const TArray<FMeshDrawSortEntry>& OpaqueDraws = bMerged ? InstanceMerger.GetMergedDraws() : DrawSorter.GetEntries();
+	DrawStats.Opaque.MergeTimeMS += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - MergeStart);
 
 	// --- 3. 그리기 (Draw) ---
 	{
 		GPU_TIME_PROFILE("GPUSkinning")
-		DrawMeshBatches(MeshBatchElements, true);
+		DrawMeshBatches(MeshBatchElements, OpaqueDraws.GetData(), OpaqueDraws.Num(), &DrawStats.Opaque);
+	}
+	MeshBatchElements.Empty();
+}
+
+void FSceneRenderer::CollectMeshBatchesParallel(const TArray<UMeshComponent*>& Components, TArray<FMeshBatchElement>& OutBatches,
+	TArray<int32>* OutBatchCounts, FMeshDrawPassStats* OutStats)
+{
+	// 청크 하나가 맡는 최소 컴포넌트 수 (이보다 적으면 Job 오버헤드가 더 크다)
+	constexpr int32 MinComponentsPerChunk = 32;
+
+	const int32 NumComponents = Components.Num();
+	if (OutBatchCounts)
+	{
+		OutBatchCounts->SetNum(NumComponents);
+	}
+	if (NumComponents == 0)
+	{
+		return;
+	}
+
+	const uint64 CollectStart = FPlatformTime::Cycles64();
+
+	// 1. 직렬 준비: 스키닝/버퍼 업로드 같은 즉시 컨텍스트 작업 + 월드 행렬 캐시 채우기
+	for (UMeshComponent* MeshComponent : Components)
+	{
+		MeshComponent->PrepareMeshBatches(View);
+	}
+
+	// 2. 수집: 청크마다 자기 버퍼에만 쓰므로 락이 필요 없다
+	FJobSystem& JobSystem = FJobSystem::GetInstance();
+	const int32 NumChunks = std::min(JobSystem.GetNumWorkers() + 1,
+		(NumComponents + MinComponentsPerChunk - 1) / MinComponentsPerChunk);
+
+	if (NumChunks <= 1)
+	{
+		for (int32 Index = 0; Index < NumComponents; ++Index)
+		{
+			const int32 Before = OutBatches.Num();
+			Components[Index]->CollectMeshBatches(OutBatches, View);
+			if (OutBatchCounts)
+			{
+				(*OutBatchCounts)[Index] = OutBatches.Num() - Before;
+			}
+		}
+	}
+	else
+	{
+		if (CollectChunkBatches.Num() < NumChunks)
+		{
+			CollectChunkBatches.SetNum(NumChunks);
+		}
+
+		const int32 ChunkSize = (NumComponents + NumChunks - 1) / NumChunks;
+		JobSystem.ParallelFor(NumChunks, 1, [&](int32 BeginChunk, int32 EndChunk)
+		{
+			for (int32 Chunk = BeginChunk; Chunk < EndChunk; ++Chunk)
+			{
+				TArray<FMeshBatchElement>& ChunkBatches = CollectChunkBatches[Chunk];
+				ChunkBatches.Empty();
+
+				const int32 Begin = Chunk * ChunkSize;
+				const int32 End = std::min(NumComponents, Begin + ChunkSize);
+				for (int32 Index = Begin; Index < End; ++Index)
+				{
+					const int32 Before = ChunkBatches.Num();
+					Components[Index]->CollectMeshBatches(ChunkBatches, View);
+					if (OutBatchCounts)
+					{
+						(*OutBatchCounts)[Index] = ChunkBatches.Num() - Before;
+					}
+				}
+			}
+		});
+
+		// 3. 청크 순서대로 이어 붙이면 직렬 수집과 같은 순서가 된다
+		int32 TotalBatches = OutBatches.Num();
+		for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+		{
+			TotalBatches += CollectChunkBatches[Chunk].Num();
+		}
+		OutBatches.Reserve(TotalBatches);
+		for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+		{
+			TArray<FMeshBatchElement>& ChunkBatches = CollectChunkBatches[Chunk];
+			OutBatches.insert(OutBatches.end(), std::make_move_iterator(ChunkBatches.begin()), std::make_move_iterator(ChunkBatches.end()));
+			ChunkBatches.Empty();
+		}
+	}
+
+	if (OutStats)
+	{
+		OutStats->CollectTimeMS += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CollectStart);
+		OutStats->CollectChunks += static_cast<uint32>(std::max(NumChunks, 1));
 	}
 }
 
@@ -982,6 +1371,13 @@ void FSceneRenderer::RenderParticlePass()
 {
 	GPU_TIME_PROFILE("Particle_Draw")
 
+	// 기본은 파티클 Job을 기다리지 않는다. 각 컴포넌트는 자기 완료 핸들이 끝난 결과만 RenderData로 교체하고 (TrySync),
+	// 진행 중인 Job은 렌더 중인 것과 다른 페이로드 슬롯에 쓰므로 시뮬레이션이 렌더링과 겹쳐 돈다
+	if (World->GetRenderSettings().ShouldWaitForParticleJobs())
+	{
+		FParticleAsyncUpdater::WaitForAllParticleJobs();
+	}
+
 	if (Proxies.Particles.empty())
 		return;
 
@@ -1051,38 +1447,38 @@ void FSceneRenderer::RenderParticlePass()
 		ParticleComp->CollectMeshBatches(MeshBatchElements, View);
 	}
 
-	TArray<FMeshBatchElement> MeshParticleBatchElements;
-	TArray<FMeshBatchElement> SpriteParticleBatchElements;
-
-	for (const FMeshBatchElement& Batch : MeshBatchElements)
+	// 스프라이트(깊이 쓰기 X)와 메시 파티클을 패스 필드로 갈라 한 번에 정렬한다
+	// 스프라이트는 반투명이므로 같은 상태 안에서 뒤에서 앞으로
+	const uint64 SortStart = FPlatformTime::Cycles64();
+	DrawSorter.Reset();
+	for (int32 Index = 0; Index < MeshBatchElements.Num(); ++Index)
 	{
-		if (Batch.bIsDepthWrite)
-		{
-			MeshParticleBatchElements.Add(Batch);
-		}
-		else
-		{
-			SpriteParticleBatchElements.Add(Batch);
-		}
+		const FMeshBatchElement& Batch = MeshBatchElements[Index];
+		const bool bSprite = !Batch.bIsDepthWrite;
+		DrawSorter.Add(Batch, Index, bSprite ? EMeshDrawPass::ParticleSprite : EMeshDrawPass::ParticleMesh, View->ViewMatrix, bSprite);
 	}
+	DrawSorter.Sort();
+	DrawStats.Particle.SortTimeMS += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - SortStart);
+	DrawStats.Particle.NumDraws += DrawSorter.Num();
 
-	MeshBatchElements.Empty();
+	const FMeshDrawSortEntry* SortedDraws = DrawSorter.GetEntries().GetData();
+	const int32 NumSpriteDraws = DrawSorter.FindFirstOfPass(EMeshDrawPass::ParticleMesh);
+	const int32 NumMeshDraws = DrawSorter.Num() - NumSpriteDraws;
 
-	FParticleStatManager::GetInstance().AddDrawCalls(SpriteParticleBatchElements.Num());
-	FParticleStatManager::GetInstance().AddDrawCalls(MeshParticleBatchElements.Num());
-	SpriteParticleBatchElements.Sort();
-	if (!SpriteParticleBatchElements.IsEmpty())
+	FParticleStatManager::GetInstance().AddDrawCalls(NumSpriteDraws);
+	FParticleStatManager::GetInstance().AddDrawCalls(NumMeshDraws);
+	if (NumSpriteDraws > 0)
 	{
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
-		DrawMeshBatches(SpriteParticleBatchElements, true);
+		DrawMeshBatches(MeshBatchElements, SortedDraws, NumSpriteDraws, &DrawStats.Particle);
 	}
 	
-	MeshParticleBatchElements.Sort();
-	if (!MeshParticleBatchElements.IsEmpty())
+	if (NumMeshDraws > 0)
 	{
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
-		DrawMeshBatches(MeshParticleBatchElements, true);
+		DrawMeshBatches(MeshBatchElements, SortedDraws + NumSpriteDraws, NumMeshDraws, &DrawStats.Particle);
 	}
+	MeshBatchElements.Empty();
 
 	// Renderer 복구
 	ID3D11ShaderResourceView* NullSRV[1] = { nullptr };
@@ -1112,7 +1508,7 @@ void FSceneRenderer::RenderDecalPass()
 	if (!BVH)
 		return;
 
-	FDecalStatManager::GetInstance().AddTotalDecalCount(Proxies.Decals.Num());	// TODO: 추후 월드 컴포넌트 추가/삭제 이벤트에서 데칼 컴포넌트의 개수만 추적하도록 수정 필요
+	FDecalStatManager::GetInstance().AddTotalDecalCount(CullingStats.TotalDecals);	// TODO: 추후 월드 컴포넌트 추가/삭제 이벤트에서 데칼 컴포넌트의 개수만 추적하도록 수정 필요
 	FDecalStatManager::GetInstance().AddVisibleDecalCount(Proxies.Decals.Num());	// 그릴 Decal 개수 수집
 
 	// ViewMode에 따라 조명 모델 매크로 설정
@@ -1174,6 +1570,7 @@ void FSceneRenderer::RenderDecalPass()
 		MeshBatchElements.Empty();
 		for (UPrimitiveComponent* Target : TargetPrimitives)
 		{
+			Target->PrepareMeshBatches(View);
 			Target->CollectMeshBatches(MeshBatchElements, View);
 		}
 		for (FMeshBatchElement& BatchElement : MeshBatchElements)
@@ -1479,7 +1876,18 @@ void FSceneRenderer::RenderFinalOverlayLines()
 // 수집한 Batch 그리기
 void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
 {
-	if (InMeshBatches.IsEmpty()) return;
+	DrawMeshBatches(InMeshBatches, nullptr, InMeshBatches.Num(), nullptr);
+
+	// 루프 종료 후 리스트 비우기 (옵션)
+	if (bClearListAfterDraw)
+	{
+		InMeshBatches.Empty();
+	}
+}
+
+void FSceneRenderer::DrawMeshBatches(const TArray<FMeshBatchElement>& InMeshBatches, const FMeshDrawSortEntry* SortedDraws, int32 NumDraws, FMeshDrawPassStats* OutStats)
+{
+	if (NumDraws <= 0) return;
 	constexpr UINT ParticleInstanceDataSlot = 14;
 
 	// RHI 상태 초기 설정 (Opaque Pass 기본값)
@@ -1517,9 +1925,10 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	// SubUV 상태 캐시 (샘플러 변경 추적용)
 	bool bCurrentUseSubUV = false;
 
-	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	// 정렬된 리스트 순회 (정렬 목록이 있으면 그 인덱스 순서대로)
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
 	{
+		const FMeshBatchElement& Batch = InMeshBatches[SortedDraws ? SortedDraws[DrawIndex].Index : DrawIndex];
 		// --- 필수 요소 유효성 검사 ---
 		const bool bMissingShaders = (!Batch.VertexShader || !Batch.PixelShader);
 		const bool bNeedsGeometryBuffers = (!Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0) ||
@@ -1541,6 +1950,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 
 			CurrentVertexShader = Batch.VertexShader;
 			CurrentPixelShader = Batch.PixelShader;
+			if (OutStats) { ++OutStats->ShaderChanges; }
 		}
 
 		// --- 2. 픽셀 상태 (텍스처, 샘플러, 재질CBuffer) 변경 (캐싱됨) ---
@@ -1625,6 +2035,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			CurrentMaterial = Batch.Material;
 			CurrentInstanceSRV = Batch.InstanceShaderResourceView;
 			bCurrentUseSubUV = bUseSubUV;
+			if (OutStats) { ++OutStats->MaterialChanges; }
 		}
 
 		if (Batch.GPUSkinMatrixSRV != CurrentSkinMatrixSRV || Batch.GPUSkinNormalMatrixSRV != CurrentSkinNormalMatrixSRV)
@@ -1672,6 +2083,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			UINT offsets[2] = { 0, 0 };
 
 			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 2, vbs, strides, offsets);
+			if (OutStats) { ++OutStats->VertexBufferChanges; }
 
 			DXGI_FORMAT IndexFormat = Batch.IndexBuffer ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_UNKNOWN;
 			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, IndexFormat, 0);
@@ -1692,6 +2104,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			UINT stride = Batch.VertexStride;
 			UINT offset = 0;
 			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &stride, &offset);
+			if (OutStats) { ++OutStats->VertexBufferChanges; }
 			DXGI_FORMAT IndexFormat = Batch.IndexBuffer ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_UNKNOWN;
 			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, IndexFormat, 0);
 			RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
@@ -1737,6 +2150,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			RHIDevice->SetAndUpdateConstantBuffer(ParticleEmitterType);
 		}
 		
+		if (OutStats) { ++OutStats->SubmittedDraws; }
 		if (Batch.bInstancedDraw)
 		{
 			if (Batch.IndexBuffer && Batch.VertexBuffer && Batch.VertexStride > 0)
@@ -1754,16 +2168,11 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		}
 	}
 
-	// 루프 종료 후 리스트 비우기 (옵션)
-	if (bClearListAfterDraw)
+	if (CurrentInstancingSRV)
 	{
-		InMeshBatches.Empty();
-		if (CurrentInstancingSRV)
-		{
-			ID3D11ShaderResourceView* SRV = nullptr;
-			RHIDevice->GetDeviceContext()->VSSetShaderResources(ParticleInstanceDataSlot, 1, &SRV);
-			CurrentInstancingSRV = nullptr;
-		}
+		ID3D11ShaderResourceView* SRV = nullptr;
+		RHIDevice->GetDeviceContext()->VSSetShaderResources(ParticleInstanceDataSlot, 1, &SRV);
+		CurrentInstancingSRV = nullptr;
 	}
 }
 
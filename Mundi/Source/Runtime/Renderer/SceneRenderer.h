@@ -1,5 +1,8 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "CullingStats.h"
+#include "MeshDrawSort.h"
+#include "MeshDrawStats.h"
 
 // TODO : Post Processing 떼어내기, 전방선언으로라든지...
 #include "PostProcessing/FadeInOutPass.h"
@@ -39,12 +42,15 @@ struct FCandidateDrawable;
 struct FVisibleRenderProxySet
 {
 	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
-	TArray<UMeshComponent*> Meshes;
+	TArray<UMeshComponent*> Meshes;		// 뷰 프러스텀 컬링을 통과한 메시
 	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
 	TArray<UDecalComponent*> Decals;
 	TArray<UTextRenderComponent*> Texts;
 	TArray<UParticleSystemComponent*> Particles;
 
+	// 뷰 컬링과 무관한 그림자 캐스터 후보 (라이트 프러스텀마다 따로 컬링)
+	TArray<UMeshComponent*> ShadowCasters;
+
 	// --- Type 2: In-Scene Editor (PP X, Depth-Test O or X) ---
 	TArray<ULineComponent*> EditorLines;	// 그리드(depth test O), 본 라인(depth test X) 등
 	TArray<UPrimitiveComponent*> EditorPrimitives; // 빛 기즈모, *에디터 아이콘 빌보드*
@@ -89,6 +95,14 @@ private:
 
 	void RenderShadowMaps();
 	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
+	/**
+	 * @brief 섀도우 요청의 라이트 프러스텀(포인트 라이트는 반경 구 + 면 프러스텀)에 들어오는 캐스터의 배치만 골라 OutBatches에 담습니다.
+	 * @return 정적 섀도우 캐시용 시그니처. 변형될 수 있는 캐스터(스킨드 메시 등)가 섞여 있으면 0
+	 */
+	uint64 CollectShadowCasterBatches(const FShadowRenderRequest& ShadowRequest, bool bCubeFace, uint64 SignatureSeed,
+		const TArray<FMeshBatchElement>& InCasterBatches, TArray<FMeshBatchElement>& OutBatches);
+	/** @brief 현재 뷰포트(아틀라스 영역)만 먼 깊이로 지웁니다. VSM 타겟이 바인딩되어 있으면 모멘트도 함께 지웁니다. */
+	void ClearShadowAtlasRegion();
 
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
@@ -96,9 +110,18 @@ private:
 	/** @brief 렌더링에 필요한 뷰 행렬, 절두체 등 프레임 데이터를 준비합니다. */
 	void PrepareView();
 
-	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
+	/** @brief 월드 파티션 BVH로 뷰 절두체 컬링을 수행합니다. (결과는 VisibleComponentSet) */
 	void PerformFrustumCulling();
 
+	/** @brief BVH에 프러스텀 쿼리를 보내 보이는 컴포넌트 집합을 채웁니다. */
+	void QueryVisibleComponents(const FFrustum& Frustum, TSet<UPrimitiveComponent*>& OutVisibleSet);
+
+	/** @brief BVH 쿼리 결과로 가시성을 판단합니다. BVH 바운드가 최신이 아닌 컴포넌트는 AABB를 직접 검사합니다. */
+	bool IsComponentVisible(const FFrustum& Frustum, const TSet<UPrimitiveComponent*>& VisibleSet, UPrimitiveComponent* Component) const;
+
+	/** @brief 바운딩 구 지름 / 화면 높이 (직교 투영은 1). 애니메이션 업데이트 빈도 결정에 쓰입니다. */
+	float ComputeScreenSize(const UPrimitiveComponent* Component) const;
+
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
 	void GatherVisibleProxies();
 
@@ -108,7 +131,22 @@ private:
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewMode InRenderViewMode);
 
+	/**
+	 * @brief 메시 컴포넌트들의 배치를 워커 스레드에서 나눠 수집해 OutBatches 뒤에 붙입니다.
+	 * PrepareMeshBatches(D3D 리소스 갱신)는 먼저 메인 스레드에서 직렬로 돌고, 결과 순서는 직렬 수집과 같습니다.
+	 * @param OutBatchCounts 컴포넌트별 배치 수 (Components와 같은 인덱스, nullptr 가능)
+	 * @param OutStats       수집 시간/청크 수를 더할 곳 (nullptr 가능)
+	 */
+	void CollectMeshBatchesParallel(const TArray<UMeshComponent*>& Components, TArray<FMeshBatchElement>& OutBatches,
+		TArray<int32>* OutBatchCounts, FMeshDrawPassStats* OutStats);
+
 	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	/**
+	 * @brief 정렬된 (키, 인덱스) 목록 순서대로 InMeshBatches를 그립니다. 배치 자체는 옮기지 않습니다.
+	 * @param SortedDraws nullptr이면 InMeshBatches 순서 그대로 NumDraws개
+	 * @param OutStats    셰이더/머티리얼/버텍스 버퍼 재바인딩 횟수를 더할 곳 (nullptr 가능)
+	 */
+	void DrawMeshBatches(const TArray<FMeshBatchElement>& InMeshBatches, const FMeshDrawSortEntry* SortedDraws, int32 NumDraws, FMeshDrawPassStats* OutStats);
 
 	void RenderParticlePass();
 	void RenderDecalPass();
@@ -146,12 +184,42 @@ private:
 	// 씬 전역 설정
 	FSceneGlobals SceneGlobals;
 
-	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
+	// BVH 프러스텀 쿼리 출력 버퍼 (쿼리마다 다시 씀)
 	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
+	// 뷰 프러스텀 컬링 결과
+	TSet<UPrimitiveComponent*> VisibleComponentSet;
+	// 섀도우 요청(라이트 프러스텀)마다 다시 쓰는 컬링 결과
+	TSet<UPrimitiveComponent*> ShadowVisibleSet;
+
+	// 섀도우 캐스터별 배치 구간 (캐스터 배치는 한 번만 수집하고 라이트마다 골라 쓴다)
+	struct FShadowCasterBatchRange
+	{
+		UMeshComponent* Component = nullptr;
+		int32 FirstBatch = 0;
+		int32 NumBatches = 0;
+		bool bStaticMesh = false; // 정점이 변하지 않는 캐스터만 정적 섀도우 캐시 대상
+	};
+	TArray<FShadowCasterBatchRange> ShadowCasterRanges;
+
+	// 이번 섀도우 패스의 요청별 캐스터 수 / 정적 캐시 결과 (패스 끝에서 FShadowStats로 넘긴다)
+	uint32 ShadowRequestCount = 0;
+	uint32 ShadowRequestCasterCount = 0;
+	uint32 ShadowCacheHitCount = 0;
+
+	// 이번 뷰의 컬링 통계
+	FCullingStats CullingStats;
+
+	// 정렬 키로 그리는 패스(Opaque, Particle)의 드로우 리스트 정렬기와 통계
+	FMeshDrawSorter DrawSorter;
+	FMeshDrawStats DrawStats;
 
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
 
+	// 병렬 수집용 청크별 배치 버퍼와 컴포넌트별 배치 수 (한 프레임 안의 패스끼리 용량을 재사용)
+	TArray<TArray<FMeshBatchElement>> CollectChunkBatches;
+	TArray<int32> CollectBatchCounts;
+
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
 
@@ -1,9 +1,17 @@
 ﻿#include "pch.h"
 #include "Shader.h"
 #include "Hash.h"
+#include <shared_mutex>
 
 IMPLEMENT_CLASS(UShader)
 
+namespace
+{
+	// 메시 배치 수집이 워커 스레드에서 돌기 때문에 변형 맵 조회/추가를 보호한다
+	// (조회는 공유 잠금, 컴파일/추가는 단독 잠금. 핫 리로드는 메인 스레드에서 수집 밖에서만 일어난다)
+	std::shared_mutex GShaderVariantLock;
+}
+
 // 컴파일 로직을 처리하는 비공개 헬퍼 함수
 static bool CompileShaderInternal(
 	const FWideString& InFilePath,
@@ -162,12 +170,21 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
 	uint64 Key = GenerateShaderKey(InMacros);
 
 	// 2. 맵에 이미 컴파일된 Variant가 있는지 확인
+	{
+		std::shared_lock<std::shared_mutex> ReadLock(GShaderVariantLock);
+		if (FShaderVariant* Found = ShaderVariantMap.Find(Key))
+		{
+			return Found; // 찾았으면 즉시 반환
+		}
+	}
+
+	// 3. 맵에 없음 -> 새로 컴파일 (잠근 뒤 다른 스레드가 먼저 컴파일했는지 다시 확인)
+	std::unique_lock<std::shared_mutex> WriteLock(GShaderVariantLock);
 	if (FShaderVariant* Found = ShaderVariantMap.Find(Key))
 	{
-		return Found; // 찾았으면 즉시 반환
+		return Found;
 	}
 
-	// 3. 맵에 없음 -> 새로 컴파일
 	FShaderVariant NewShaderVariant;
 	bool bSuccess = CompileVariantInternal(InDevice, FilePath, InMacros, NewShaderVariant);
 
@@ -343,6 +360,20 @@ void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPat
 		descArray.Add({"BLENDINDICES", 0, DXGI_FORMAT_R32G32B32A32_UINT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0});
 		descArray.Add({"BLENDWEIGHT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0});
 	}
+
+	// 자동 인스턴싱 변형: slot 1에 FStaticMeshInstanceData
+	if (HasMacro(InOutVariant.SourceMacros, MACRO_USE_INSTANCING))
+	{
+		for (UINT Row = 0; Row < 4; ++Row)
+		{
+			descArray.Add({"INSTANCE_WORLD", Row, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, static_cast<UINT>(offsetof(FStaticMeshInstanceData, WorldMatrix) + Row * 16), D3D11_INPUT_PER_INSTANCE_DATA, 1});
+		}
+		for (UINT Row = 0; Row < 4; ++Row)
+		{
+			descArray.Add({"INSTANCE_INVWORLD", Row, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, static_cast<UINT>(offsetof(FStaticMeshInstanceData, WorldInverseTranspose) + Row * 16), D3D11_INPUT_PER_INSTANCE_DATA, 1});
+		}
+		descArray.Add({"INSTANCE_UUID", 0, DXGI_FORMAT_R32_UINT, 1, static_cast<UINT>(offsetof(FStaticMeshInstanceData, ObjectID)), D3D11_INPUT_PER_INSTANCE_DATA, 1});
+	}
 	
 	const D3D11_INPUT_ELEMENT_DESC* layout = descArray.data();
 	uint32 layoutCount = static_cast<uint32>(descArray.size());
@@ -543,6 +574,7 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 {
 	// 이미 파싱된 파일 목록 초기화
 	IncludedFiles.clear();
+	bSupportsInstancing = false;
 
 	// 파싱할 파일 큐
 	TArray<FString> FilesToParse;
@@ -591,6 +623,12 @@ void UShader::ParseIncludeFiles(const FString& ShaderPath)
 			}
 			Line = Line.substr(FirstNonSpace);
 
+			// 인스턴싱 분기 (#if USE_INSTANCING 등)
+			if (Line[0] == '#' && Line.find(MACRO_USE_INSTANCING) != FString::npos)
+			{
+				bSupportsInstancing = true;
+			}
+
 			// #include 지시문 찾기
 			if (Line.compare(0, 8, "#include") == 0)
 			{
@@ -66,9 +66,13 @@ public:
 
 	static bool HasMacro(const TArray<FShaderMacro>& InMacros, const FString& InMacroName);
 
+	/** 소스(include 포함)가 USE_INSTANCING 분기를 갖고 있어 자동 인스턴싱 변형을 만들 수 있는지 */
+	bool SupportsInstancing() const { return bSupportsInstancing; }
+
 	// ───── Shader Macro Constants ────────────────────────────
 	static constexpr const char* MACRO_USE_GPU_SKINNING = "USE_GPU_SKINNING";
 	static constexpr const char* MACRO_USE_CARTOON_SHADING = "USE_CARTOON_SHADING";
+	static constexpr const char* MACRO_USE_INSTANCING = "USE_INSTANCING";
 	static constexpr const char* MACRO_HAS_TEXTURE = "HAS_TEXTURE";
 	static constexpr const char* MACRO_HAS_NORMAL_TEXTURE = "HAS_NORMAL_TEXTURE";
 	static constexpr const char* MACRO_LIGHTING_MODEL_PHONG = "LIGHTING_MODEL_PHONG";
@@ -86,6 +90,9 @@ private:
 	TArray<FString> IncludedFiles;
 	TMap<FString, std::filesystem::file_time_type> IncludedFileTimestamps;
 
+	// ParseIncludeFiles에서 USE_INSTANCING 지시문을 찾으면 true
+	bool bSupportsInstancing = false;
+
 	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, FShaderVariant& InOutVariant);
 	void ReleaseResources();
 
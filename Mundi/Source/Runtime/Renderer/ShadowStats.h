@@ -21,6 +21,13 @@ struct FShadowStats
 	float ShadowAtlasCubeMemoryMB = 0.0f;
 	float TotalShadowMemoryMB = 0.0f;
 
+	// 요청(2D 영역 / 큐브 면)별 캐스터 컬링과 정적 섀도우 캐시
+	uint32 ShadowRequests = 0;            // 이번 섀도우 패스에서 처리한 요청 수
+	uint32 ShadowRequestCasters = 0;      // 요청마다 컬링을 통과한 캐스터 수의 합
+	float AvgCastersPerRequest = 0.0f;
+	uint32 ShadowCacheHits = 0;           // 아틀라스 내용을 재사용해 다시 그리지 않은 요청 수
+	float ShadowCacheHitRate = 0.0f;      // % (0 ~ 100)
+
 	// 모든 통계를 0으로 리셋
 	void Reset()
 	{
@@ -34,6 +41,18 @@ struct FShadowStats
 		ShadowAtlas2DMemoryMB = 0.0f;
 		ShadowAtlasCubeMemoryMB = 0.0f;
 		TotalShadowMemoryMB = 0.0f;
+		ShadowRequests = 0;
+		ShadowRequestCasters = 0;
+		AvgCastersPerRequest = 0.0f;
+		ShadowCacheHits = 0;
+		ShadowCacheHitRate = 0.0f;
+	}
+
+	// 요청당 평균 캐스터 수 / 캐시 적중률 계산
+	void CalculateRequestStats()
+	{
+		AvgCastersPerRequest = ShadowRequests > 0 ? (float)ShadowRequestCasters / ShadowRequests : 0.0f;
+		ShadowCacheHitRate = ShadowRequests > 0 ? 100.0f * ShadowCacheHits / ShadowRequests : 0.0f;
 	}
 
 	// 전체 섀도우 캐스팅 라이트 수 계산
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "SkinnedMeshComponent.h"
+#include "Source/Runtime/Engine/Animation/AnimUpdateRate.h"
 #include "StatsOverlayD2D.h"
 #include "UEContainer.h"
 
@@ -20,6 +21,13 @@ struct FSkinningStats
 
     FString SkinningType = "CPU";
 
+    // 애니메이션 업데이트 빈도 단계별 컴포넌트 수 (컬링된 것 포함)
+    // 뷰마다 다시 모으는 위 항목과 달리 컴포넌트 Tick에서 프레임당 한 번 기록한다 (ResetAnimUpdateRates)
+    uint32 AnimUpdateTierCounts[static_cast<int32>(EAnimUpdateRateTier::Count)] = {};
+    // 이번 프레임에 실제로 평가한 / 건너뛴 컴포넌트 수
+    uint32 AnimEvaluatedCount = 0;
+    uint32 AnimSkippedCount = 0;
+
     FSkinningStats() {};
 
     FSkinningStats(const FSkinningStats& other)
@@ -28,6 +36,12 @@ struct FSkinningStats
         TotalBones = other.TotalBones;
         TotalVertices = other.TotalVertices;
         SkinningType = other.SkinningType;
+        for (int32 i = 0; i < static_cast<int32>(EAnimUpdateRateTier::Count); ++i)
+        {
+            AnimUpdateTierCounts[i] = other.AnimUpdateTierCounts[i];
+        }
+        AnimEvaluatedCount = other.AnimEvaluatedCount;
+        AnimSkippedCount = other.AnimSkippedCount;
     };
 
     void AddStats(const FSkinningStats& other)
@@ -35,6 +49,12 @@ struct FSkinningStats
         TotalSkeletals += other.TotalSkeletals;
         TotalBones += other.TotalBones;
         TotalVertices += other.TotalVertices;
+        for (int32 i = 0; i < static_cast<int32>(EAnimUpdateRateTier::Count); ++i)
+        {
+            AnimUpdateTierCounts[i] += other.AnimUpdateTierCounts[i];
+        }
+        AnimEvaluatedCount += other.AnimEvaluatedCount;
+        AnimSkippedCount += other.AnimSkippedCount;
     }
 
     void Reset()
@@ -43,6 +63,16 @@ struct FSkinningStats
         TotalBones = 0;
         TotalVertices = 0;
     }
+
+    void ResetAnimUpdateRates()
+    {
+        for (uint32& Count : AnimUpdateTierCounts)
+        {
+            Count = 0;
+        }
+        AnimEvaluatedCount = 0;
+        AnimSkippedCount = 0;
+    }
 };
 
 class FSkinningStatManager
@@ -64,11 +94,18 @@ public:
         return CurrentStats;
     }
 
+    // 뷰마다 호출 (애니메이션 업데이트 빈도 집계는 유지)
     void ResetStats()
     {
         CurrentStats.Reset();
     }
 
+    // 프레임마다 오버레이를 그린 뒤 호출
+    void ResetAnimUpdateStats()
+    {
+        CurrentStats.ResetAnimUpdateRates();
+    }
+
     void UpdateSkinningType(bool bEnableGPUSkinning)
     {
         CurrentStats.SkinningType = bEnableGPUSkinning ? "GPU" : "CPU";
@@ -95,6 +132,25 @@ public:
         }
     }
 
+    // 스켈레탈 컴포넌트 Tick에서 프레임당 한 번 (뷰 수와 무관)
+    void AddAnimUpdateRate(const FAnimUpdateRateParams& UpdateRate)
+    {
+        if (!UStatsOverlayD2D::Get().IsSkinningVisible())
+        {
+            return;
+        }
+
+        CurrentStats.AnimUpdateTierCounts[static_cast<int32>(UpdateRate.GetTier())]++;
+        if (UpdateRate.ShouldEvaluate())
+        {
+            CurrentStats.AnimEvaluatedCount++;
+        }
+        else
+        {
+            CurrentStats.AnimSkippedCount++;
+        }
+    }
+
 private:
     FSkinningStatManager() = default;
     ~FSkinningStatManager() = default;
@@ -1,7 +1,7 @@
 ﻿#pragma once
 #include "UEContainer.h"
 
-// 타일 기반 라이트 컬링 통계
+// 타일/클러스터 기반 라이트 컬링 통계
 // 성능 메트릭과 컬링 효율성을 추적
 struct FTileCullingStats
 {
@@ -10,23 +10,28 @@ struct FTileCullingStats
 	uint32 TileCountY = 0;
 	uint32 TotalTileCount = 0;
 
+	// 클러스터 차원 (타일 x 깊이 슬라이스, 2D 타일 컬링은 슬라이스 1개)
+	uint32 ClusterSliceCount = 0;
+	uint32 TotalClusterCount = 0;
+
 	// 라이트 개수
 	uint32 TotalPointLights = 0;
 	uint32 TotalSpotLights = 0;
 	uint32 TotalLights = 0;
 
-	// 타일당 라이트 통계
-	uint32 MinLightsPerTile = 0;
-	uint32 MaxLightsPerTile = 0;
-	float AvgLightsPerTile = 0.0f;
+	// 클러스터당 라이트 통계
+	uint32 MinLightsPerCluster = 0;
+	uint32 MaxLightsPerCluster = 0;
+	float AvgLightsPerCluster = 0.0f;
 
 	// 컬링 효율성 메트릭
 	float CullingEfficiency = 0.0f; // 컬링된 라이트 비율 (%)
-	uint32 TotalLightTests = 0;     // 전체 라이트-타일 테스트 수
-	uint32 TotalLightsPassed = 0;   // 컬링을 통과한 라이트 수
+	uint32 TotalLightTests = 0;     // 전체 라이트-클러스터 조합 수
+	uint32 TotalLightsPassed = 0;   // 컬링을 통과한 라이트 수 (기록된 인덱스 수)
 
 	// 성능 메트릭
 	float ComputeShaderTimeMS = 0.0f;
+	float CullTimeMS = 0.0f;        // CPU 컬링 시간
 	uint32 LightIndexBufferSizeBytes = 0;
 
 	// 시각화 모드
@@ -47,16 +52,19 @@ struct FTileCullingStats
 		TileCountX = 0;
 		TileCountY = 0;
 		TotalTileCount = 0;
+		ClusterSliceCount = 0;
+		TotalClusterCount = 0;
 		TotalPointLights = 0;
 		TotalSpotLights = 0;
 		TotalLights = 0;
-		MinLightsPerTile = 0;
-		MaxLightsPerTile = 0;
-		AvgLightsPerTile = 0.0f;
+		MinLightsPerCluster = 0;
+		MaxLightsPerCluster = 0;
+		AvgLightsPerCluster = 0.0f;
 		CullingEfficiency = 0.0f;
 		TotalLightTests = 0;
 		TotalLightsPassed = 0;
 		ComputeShaderTimeMS = 0.0f;
+		CullTimeMS = 0.0f;
 		LightIndexBufferSizeBytes = 0;
 	}
 
@@ -66,9 +74,9 @@ struct FTileCullingStats
 		TotalLights = TotalPointLights + TotalSpotLights;
 		TotalTileCount = TileCountX * TileCountY;
 
-		if (TotalTileCount > 0)
+		if (TotalClusterCount > 0)
 		{
-			AvgLightsPerTile = static_cast<float>(TotalLightsPassed) / static_cast<float>(TotalTileCount);
+			AvgLightsPerCluster = static_cast<float>(TotalLightsPassed) / static_cast<float>(TotalClusterCount);
 		}
 
 		if (TotalLightTests > 0)
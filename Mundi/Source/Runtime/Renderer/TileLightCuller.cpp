@@ -1,6 +1,9 @@
 ﻿#include "pch.h"
 #include "TileLightCuller.h"
+#include "JobSystem.h"
+#include "PlatformTime.h"
 #include <algorithm>
+#include <cmath>
 
 FTileLightCuller::FTileLightCuller()
 	: RHI(nullptr)
@@ -8,8 +11,11 @@ FTileLightCuller::FTileLightCuller()
 	, TileCountX(0)
 	, TileCountY(0)
 	, TotalTileCount(0)
+	, SliceScale(0.0f)
+	, SliceBias(0.0f)
 	, LightIndexBuffer(nullptr)
 	, LightIndexBufferSRV(nullptr)
+	, LightIndexBufferCapacity(0)
 {
 }
 
@@ -36,20 +42,341 @@ void FTileLightCuller::CullLights(
 	UINT ViewportWidth,
 	UINT ViewportHeight)
 {
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
 	// 타일 그리드 계산
 	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
 	TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
 	TotalTileCount = TileCountX * TileCountY;
+	const uint32 ClusterCount = TotalTileCount * ClusterSliceCount;
 
 	// 통계 초기화
 	Stats.Reset();
 	Stats.TileCountX = TileCountX;
 	Stats.TileCountY = TileCountY;
 	Stats.TotalTileCount = TotalTileCount;
+	Stats.ClusterSliceCount = ClusterSliceCount;
+	Stats.TotalClusterCount = ClusterCount;
 	Stats.TotalPointLights = PointLights.Num();
 	Stats.TotalSpotLights = SpotLights.Num();
 	Stats.TotalLights = PointLights.Num() + SpotLights.Num();
 
+	// 1. 지수 깊이 슬라이스 경계 (셰이더는 SliceScale/SliceBias로 같은 값을 역산)
+	const float Near = FMath::Max(NearPlane, 0.01f);
+	const float Far = FMath::Max(FarPlane, Near * 1.01f);
+	const float LogDepthRange = std::log2(Far / Near);
+	SliceScale = static_cast<float>(ClusterSliceCount) / LogDepthRange;
+	SliceBias = -static_cast<float>(ClusterSliceCount) * std::log2(Near) / LogDepthRange;
+	for (UINT Slice = 0; Slice <= ClusterSliceCount; ++Slice)
+	{
+		SliceDepths[Slice] = Near * std::pow(Far / Near, static_cast<float>(Slice) / static_cast<float>(ClusterSliceCount));
+	}
+
+	// 2. 라이트를 뷰 공간 구로 한 번만 변환 (깊이 범위 밖은 여기서 버림)
+	ClusterLights.Empty();
+	ClusterLights.Reserve(PointLights.Num() + SpotLights.Num());
+	FClusterLight ClusterLight;
+	for (int32 i = 0; i < PointLights.Num(); ++i)
+	{
+		if (BuildClusterLight(PointLights[i].Position, PointLights[i].AttenuationRadius, static_cast<uint32>(i), ViewMatrix, ClusterLight))
+		{
+			ClusterLights.Add(ClusterLight);
+		}
+	}
+	for (int32 i = 0; i < SpotLights.Num(); ++i)
+	{
+		// Spot Light도 구체로 근사 (이전 타일 컬링과 동일)
+		if (BuildClusterLight(SpotLights[i].Position, SpotLights[i].AttenuationRadius, (1u << 16) | static_cast<uint32>(i), ViewMatrix, ClusterLight))
+		{
+			ClusterLights.Add(ClusterLight);
+		}
+	}
+
+	// 3. 슬라이스별 분배 (슬라이스끼리는 쓰는 데이터가 겹치지 않으므로 워커에 나눈다)
+	if (SliceScratch.Num() != static_cast<int32>(ClusterSliceCount))
+	{
+		SliceScratch.SetNum(static_cast<int32>(ClusterSliceCount));
+	}
+	// 직교 투영은 M[3][3] = 1, 원근 투영은 M[2][3] = 1
+	const bool bOrthographic = ProjMatrix.M[3][3] == 1.0f;
+	const float Width = static_cast<float>(ViewportWidth);
+	const float Height = static_cast<float>(ViewportHeight);
+	FJobSystem::GetInstance().ParallelFor(static_cast<int32>(ClusterSliceCount), 1, [&](int32 Begin, int32 End)
+	{
+		for (int32 Slice = Begin; Slice < End; ++Slice)
+		{
+			BinSlice(Slice, ProjMatrix, bOrthographic, Width, Height);
+		}
+	});
+
+	// 4. 슬라이스 인덱스 목록을 이어 붙일 위치 계산
+	const uint32 HeaderSize = ClusterCount * 2;
+	uint32 TotalIndices = 0;
+	Stats.MinLightsPerCluster = UINT_MAX;
+	for (FClusterSliceScratch& Scratch : SliceScratch)
+	{
+		Scratch.BaseOffset = HeaderSize + TotalIndices;
+		TotalIndices += static_cast<uint32>(Scratch.Indices.Num());
+		Stats.MinLightsPerCluster = FMath::Min(Stats.MinLightsPerCluster, Scratch.MinCount);
+		Stats.MaxLightsPerCluster = FMath::Max(Stats.MaxLightsPerCluster, Scratch.MaxCount);
+	}
+
+	// 5. (Offset, Count) 헤더와 인덱스 목록을 최종 버퍼에 기록 (memset 없이 전부 덮어쓴다)
+	const uint32 RequiredSize = HeaderSize + TotalIndices;
+	if (ClusterLightData.Num() != static_cast<int32>(RequiredSize))
+	{
+		ClusterLightData.SetNum(RequiredSize);
+	}
+	FJobSystem::GetInstance().ParallelFor(static_cast<int32>(ClusterSliceCount), 1, [&](int32 Begin, int32 End)
+	{
+		for (int32 Slice = Begin; Slice < End; ++Slice)
+		{
+			const FClusterSliceScratch& Scratch = SliceScratch[Slice];
+			uint32* Header = ClusterLightData.GetData() + static_cast<size_t>(Slice) * TotalTileCount * 2;
+			for (uint32 Tile = 0; Tile < TotalTileCount; ++Tile)
+			{
+				const uint32 Count = Scratch.Counts[Tile];
+				Header[Tile * 2] = Scratch.BaseOffset + (Scratch.Cursors[Tile] - Count);
+				Header[Tile * 2 + 1] = Count;
+			}
+			if (!Scratch.Indices.IsEmpty())
+			{
+				memcpy(ClusterLightData.GetData() + Scratch.BaseOffset, Scratch.Indices.GetData(), Scratch.Indices.Num() * sizeof(uint32));
+			}
+		}
+	});
+
+	// 통계: 테스트 수는 전수 검사 기준 (라이트 x 클러스터), 통과 수는 실제로 기록된 인덱스 수
+	Stats.TotalLightTests = Stats.TotalLights * ClusterCount;
+	Stats.TotalLightsPassed = TotalIndices;
+	if (ClusterCount > 0)
+	{
+		Stats.AvgLightsPerCluster = static_cast<float>(TotalIndices) / static_cast<float>(ClusterCount);
+	}
+	if (Stats.MinLightsPerCluster == UINT_MAX)
+	{
+		Stats.MinLightsPerCluster = 0;
+	}
+	Stats.CalculateStats();
+	Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
+	Stats.CullTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+
+	UploadToGPU(ClusterLightData);
+}
+
+bool FTileLightCuller::BuildClusterLight(const FVector& WorldPos, float Radius, uint32 PackedIndex, const FMatrix& ViewMatrix, FClusterLight& OutLight) const
+{
+	// 행 벡터 * 행렬을 SSE 한 줄로 (x * Row0 + y * Row1 + z * Row2 + Row3)
+	const __m128 ViewPos = _mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(_mm_set1_ps(WorldPos.X), ViewMatrix.Rows[0]), _mm_mul_ps(_mm_set1_ps(WorldPos.Y), ViewMatrix.Rows[1])),
+		_mm_add_ps(_mm_mul_ps(_mm_set1_ps(WorldPos.Z), ViewMatrix.Rows[2]), ViewMatrix.Rows[3]));
+	alignas(16) float ViewXYZW[4];
+	_mm_store_ps(ViewXYZW, ViewPos);
+
+	const float MinZ = ViewXYZW[2] - Radius;
+	const float MaxZ = ViewXYZW[2] + Radius;
+	if (Radius <= 0.0f || MaxZ < SliceDepths[0] || MinZ > SliceDepths[ClusterSliceCount])
+	{
+		return false;
+	}
+
+	OutLight.ViewCenter = FVector(ViewXYZW[0], ViewXYZW[1], ViewXYZW[2]);
+	OutLight.Radius = Radius;
+	OutLight.PackedIndex = PackedIndex;
+	OutLight.SliceMin = GetSliceIndex(FMath::Max(MinZ, SliceDepths[0]));
+	OutLight.SliceMax = GetSliceIndex(FMath::Min(MaxZ, SliceDepths[ClusterSliceCount]));
+	return true;
+}
+
+void FTileLightCuller::BinSlice(int32 Slice, const FMatrix& ProjMatrix, bool bOrthographic, float ViewportWidth, float ViewportHeight)
+{
+	FClusterSliceScratch& Scratch = SliceScratch[Slice];
+	Scratch.Counts.SetNum(TotalTileCount);
+	Scratch.Cursors.SetNum(TotalTileCount);
+	memset(Scratch.Counts.GetData(), 0, TotalTileCount * sizeof(uint32));
+	Scratch.Rects.Empty();
+
+	const float SliceNear = SliceDepths[Slice];
+	const float SliceFar = SliceDepths[Slice + 1];
+	const float P00 = ProjMatrix.M[0][0];
+	const float P11 = ProjMatrix.M[1][1];
+	// 원근: NDC = P00 * x / z + P20, 직교: NDC = P00 * x + P30
+	const float OffsetX = bOrthographic ? ProjMatrix.M[3][0] : ProjMatrix.M[2][0];
+	const float OffsetY = bOrthographic ? ProjMatrix.M[3][1] : ProjMatrix.M[2][1];
+	const float PixelsPerTile = static_cast<float>(TileSize);
+	const int32 LastTileX = static_cast<int32>(TileCountX) - 1;
+	const int32 LastTileY = static_cast<int32>(TileCountY) - 1;
+
+	// Pass 1: 라이트별 타일 사각형 + 타일별 개수
+	for (const FClusterLight& Light : ClusterLights)
+	{
+		if (Slice < Light.SliceMin || Slice > Light.SliceMax)
+		{
+			continue;
+		}
+
+		// 슬라이스 슬랩과 구의 교차 깊이 범위
+		const FVector& C = Light.ViewCenter;
+		const float SlabNear = FMath::Max(SliceNear, C.Z - Light.Radius);
+		const float SlabFar = FMath::Min(SliceFar, C.Z + Light.Radius);
+		if (SlabNear > SlabFar)
+		{
+			continue;
+		}
+
+		// 중심 깊이가 슬랩 밖이면 가까운 경계면의 단면 원이 가장 크다
+		float SectionRadius = Light.Radius;
+		const float DepthGap = (C.Z < SlabNear) ? (SlabNear - C.Z) : ((C.Z > SlabFar) ? (C.Z - SlabFar) : 0.0f);
+		if (DepthGap > 0.0f)
+		{
+			SectionRadius = std::sqrt(FMath::Max(Light.Radius * Light.Radius - DepthGap * DepthGap, 0.0f));
+		}
+
+		// 단면을 감싸는 뷰 공간 박스 [MinX, MaxX] x [MinY, MaxY] x [SlabNear, SlabFar]를 투영
+		const float MinX = C.X - SectionRadius;
+		const float MaxX = C.X + SectionRadius;
+		const float MinY = C.Y - SectionRadius;
+		const float MaxY = C.Y + SectionRadius;
+		float NdcMinX, NdcMaxX, NdcMinY, NdcMaxY;
+		if (bOrthographic)
+		{
+			NdcMinX = P00 * MinX + OffsetX;
+			NdcMaxX = P00 * MaxX + OffsetX;
+			NdcMinY = P11 * MinY + OffsetY;
+			NdcMaxY = P11 * MaxY + OffsetY;
+		}
+		else
+		{
+			// 음수 좌표는 가까운 깊이에서, 양수 좌표는 먼 깊이에서 가장 안쪽으로 투영된다 (반대쪽 끝은 그 역)
+			NdcMinX = P00 * MinX / (MinX < 0.0f ? SlabNear : SlabFar) + OffsetX;
+			NdcMaxX = P00 * MaxX / (MaxX > 0.0f ? SlabNear : SlabFar) + OffsetX;
+			NdcMinY = P11 * MinY / (MinY < 0.0f ? SlabNear : SlabFar) + OffsetY;
+			NdcMaxY = P11 * MaxY / (MaxY > 0.0f ? SlabNear : SlabFar) + OffsetY;
+		}
+		if (NdcMaxX < -1.0f || NdcMinX > 1.0f || NdcMaxY < -1.0f || NdcMinY > 1.0f)
+		{
+			continue;
+		}
+
+		// NDC → 픽셀 → 타일 (화면 Y는 아래로 증가)
+		const float PixelMinX = (NdcMinX * 0.5f + 0.5f) * ViewportWidth;
+		const float PixelMaxX = (NdcMaxX * 0.5f + 0.5f) * ViewportWidth;
+		const float PixelMinY = (0.5f - NdcMaxY * 0.5f) * ViewportHeight;
+		const float PixelMaxY = (0.5f - NdcMinY * 0.5f) * ViewportHeight;
+
+		FClusterLightRect Rect;
+		Rect.MinX = static_cast<uint16>(FMath::Clamp(static_cast<int32>(std::floor(PixelMinX / PixelsPerTile)), 0, LastTileX));
+		Rect.MaxX = static_cast<uint16>(FMath::Clamp(static_cast<int32>(std::floor(PixelMaxX / PixelsPerTile)), 0, LastTileX));
+		Rect.MinY = static_cast<uint16>(FMath::Clamp(static_cast<int32>(std::floor(PixelMinY / PixelsPerTile)), 0, LastTileY));
+		Rect.MaxY = static_cast<uint16>(FMath::Clamp(static_cast<int32>(std::floor(PixelMaxY / PixelsPerTile)), 0, LastTileY));
+		Rect.PackedIndex = Light.PackedIndex;
+		Scratch.Rects.Add(Rect);
+
+		for (uint32 TileY = Rect.MinY; TileY <= Rect.MaxY; ++TileY)
+		{
+			uint32* Row = Scratch.Counts.GetData() + TileY * TileCountX;
+			for (uint32 TileX = Rect.MinX; TileX <= Rect.MaxX; ++TileX)
+			{
+				++Row[TileX];
+			}
+		}
+	}
+
+	// Prefix Sum: 타일별 시작 위치
+	uint32 Running = 0;
+	Scratch.MinCount = UINT_MAX;
+	Scratch.MaxCount = 0;
+	for (uint32 Tile = 0; Tile < TotalTileCount; ++Tile)
+	{
+		const uint32 Count = Scratch.Counts[Tile];
+		Scratch.Cursors[Tile] = Running;
+		Running += Count;
+		Scratch.MinCount = FMath::Min(Scratch.MinCount, Count);
+		Scratch.MaxCount = FMath::Max(Scratch.MaxCount, Count);
+	}
+
+	// Pass 2: 사각형을 다시 돌면서 인덱스 채우기 (라이트 순서 유지)
+	Scratch.Indices.SetNum(Running);
+	uint32* Indices = Scratch.Indices.GetData();
+	for (const FClusterLightRect& Rect : Scratch.Rects)
+	{
+		for (uint32 TileY = Rect.MinY; TileY <= Rect.MaxY; ++TileY)
+		{
+			uint32* RowCursor = Scratch.Cursors.GetData() + TileY * TileCountX;
+			for (uint32 TileX = Rect.MinX; TileX <= Rect.MaxX; ++TileX)
+			{
+				Indices[RowCursor[TileX]++] = Rect.PackedIndex;
+			}
+		}
+	}
+}
+
+int32 FTileLightCuller::GetSliceIndex(float ViewZ) const
+{
+	const int32 Slice = static_cast<int32>(std::floor(std::log2(FMath::Max(ViewZ, 1.0e-4f)) * SliceScale + SliceBias));
+	return FMath::Clamp(Slice, 0, static_cast<int32>(ClusterSliceCount) - 1);
+}
+
+void FTileLightCuller::UploadToGPU(const TArray<uint32>& Data)
+{
+	if (!RHI || Data.IsEmpty())
+	{
+		return;
+	}
+
+	const UINT RequiredSize = static_cast<UINT>(Data.Num());
+	if (LightIndexBuffer && RequiredSize > LightIndexBufferCapacity)
+	{
+		// 라이트가 늘거나 뷰포트가 커지면 여유를 두고 다시 만든다
+		LightIndexBufferSRV->Release();
+		LightIndexBufferSRV = nullptr;
+		LightIndexBuffer->Release();
+		LightIndexBuffer = nullptr;
+	}
+
+	if (!LightIndexBuffer)
+	{
+		const UINT Capacity = RequiredSize + RequiredSize / 4;
+		HRESULT hr = RHI->CreateStructuredBuffer(sizeof(uint32), Capacity, nullptr, &LightIndexBuffer);
+		if (FAILED(hr))
+		{
+			LightIndexBuffer = nullptr;
+			LightIndexBufferCapacity = 0;
+			return;
+		}
+		RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
+		LightIndexBufferCapacity = Capacity;
+	}
+
+	RHI->UpdateStructuredBuffer(LightIndexBuffer, Data.GetData(), RequiredSize * sizeof(uint32));
+}
+
+void FTileLightCuller::CullLightsPerTileFrustum(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float NearPlane,
+	float FarPlane,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	// 타일 그리드 계산
+	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
+	TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
+	TotalTileCount = TileCountX * TileCountY;
+
+	// 통계 초기화
+	Stats.Reset();
+	Stats.TileCountX = TileCountX;
+	Stats.TileCountY = TileCountY;
+	Stats.TotalTileCount = TotalTileCount;
+	Stats.TotalPointLights = PointLights.Num();
+	Stats.TotalSpotLights = SpotLights.Num();
+	Stats.TotalLights = PointLights.Num() + SpotLights.Num();
+	Stats.ClusterSliceCount = 1;
+	Stats.TotalClusterCount = TotalTileCount;
+
 	// 타일 라이트 인덱스 버퍼 크기 재조정
 	UINT RequiredSize = TotalTileCount * MaxLightsPerTile;
 	if (TileLightIndices.Num() != RequiredSize)
@@ -64,8 +391,9 @@ void FTileLightCuller::CullLights(
 	FMatrix InvViewProj = ProjMatrix.InversePerspectiveProjection() * ViewMatrix.InverseAffine();
 
 	// 각 타일에 대해 컬링 수행
-	Stats.MinLightsPerTile = UINT_MAX;
-	Stats.MaxLightsPerTile = 0;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Stats.MinLightsPerCluster = UINT_MAX;
+	Stats.MaxLightsPerCluster = 0;
 	uint32 TotalLightsAcrossAllTiles = 0;
 
 	for (UINT TileY = 0; TileY < TileCountY; ++TileY)
@@ -112,8 +440,8 @@ void FTileLightCuller::CullLights(
 			TileLightIndices[TileDataOffset] = LightCount;
 
 			// 통계 업데이트
-			Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, LightCount);
-			Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, LightCount);
+			Stats.MinLightsPerCluster = FMath::Min(Stats.MinLightsPerCluster, LightCount);
+			Stats.MaxLightsPerCluster = FMath::Max(Stats.MaxLightsPerCluster, LightCount);
 			TotalLightsAcrossAllTiles += LightCount;
 		}
 	}
@@ -121,40 +449,14 @@ void FTileLightCuller::CullLights(
 	// 평균 계산
 	if (TotalTileCount > 0)
 	{
-		Stats.AvgLightsPerTile = static_cast<float>(TotalLightsAcrossAllTiles) / static_cast<float>(TotalTileCount);
+		Stats.AvgLightsPerCluster = static_cast<float>(TotalLightsAcrossAllTiles) / static_cast<float>(TotalTileCount);
 	}
 
 	// 컬링 효율성 계산
 	Stats.CalculateStats();
+	Stats.CullTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
 
-	// GPU 버퍼 생성 또는 업데이트
-	if (!LightIndexBuffer)
-	{
-		// 버퍼 생성
-		HRESULT hr = RHI->CreateStructuredBuffer(
-			sizeof(uint32),
-			RequiredSize,
-			TileLightIndices.GetData(),
-			&LightIndexBuffer
-		);
-
-		if (SUCCEEDED(hr))
-		{
-			// SRV 생성
-			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
-		}
-
-		Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
-	}
-	else
-	{
-		// 기존 버퍼 업데이트
-		RHI->UpdateStructuredBuffer(
-			LightIndexBuffer,
-			TileLightIndices.GetData(),
-			RequiredSize * sizeof(uint32)
-		);
-	}
+	Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
 }
 
 FFrustum FTileLightCuller::CreateTileFrustum(
@@ -414,6 +716,10 @@ void FTileLightCuller::Release()
 		LightIndexBuffer->Release();
 		LightIndexBuffer = nullptr;
 	}
+	LightIndexBufferCapacity = 0;
 
 	TileLightIndices.Empty();
+	ClusterLightData.Empty();
+	ClusterLights.Empty();
+	SliceScratch.Empty();
 }
@@ -4,18 +4,23 @@
 #include "D3D11RHI.h"
 #include "Frustum.h"
 
-// 타일 기반 라이트 컬링을 CPU에서 수행하는 클래스
-// Conservative(near, far) frustum 방식으로 각 타일에 영향을 주는 라이트를 계산
+// 클러스터(타일 x 지수 깊이 슬라이스) 기반 라이트 컬링을 CPU에서 수행하는 클래스
+// - 라이트를 뷰 공간으로 한 번만 변환한 뒤, 슬라이스별 화면 사각형으로 클러스터에 바로 분배 (평면 테스트 없음)
+// - 슬라이스는 Job System 워커에 나눠서 처리
+// - 결과는 [클러스터별 (Offset, Count)] + [압축된 라이트 인덱스 목록] 하나의 Structured Buffer
 class FTileLightCuller
 {
 public:
+	// 깊이 슬라이스 개수 (Near~Far를 지수 간격으로 분할)
+	static constexpr UINT ClusterSliceCount = 16;
+
 	FTileLightCuller();
 	~FTileLightCuller();
 
-	// 초기화 (Structured Buffer 생성)
+	// 초기화 (RHI가 nullptr이면 GPU 업로드 없이 CPU 컬링만 수행 - 벤치마크용)
 	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16);
 
-	// 타일 컬링 수행 (매 프레임 호출)
+	// 클러스터 컬링 수행 (매 프레임 호출)
 	void CullLights(
 		const TArray<FPointLightInfo>& PointLights,
 		const TArray<FSpotLightInfo>& SpotLights,
@@ -27,9 +32,29 @@ public:
 		UINT ViewportHeight
 	);
 
+	// 이전 방식: 2D 타일마다 프러스텀을 만들어 모든 라이트를 평면 테스트 (벤치마크 비교용, GPU 업로드 없음)
+	void CullLightsPerTileFrustum(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
 	// 컬링 결과를 Structured Buffer에 업데이트하고 SRV 반환
 	ID3D11ShaderResourceView* GetLightIndexBufferSRV();
 
+	// 셰이더의 슬라이스 계산용: Slice = floor(log2(ViewZ) * Scale + Bias)
+	float GetClusterSliceScale() const { return SliceScale; }
+	float GetClusterSliceBias() const { return SliceBias; }
+
+	// CPU 측 결과 (CullLights: 클러스터 레이아웃, CullLightsPerTileFrustum: 타일당 256 슬롯 레이아웃)
+	const TArray<uint32>& GetClusterLightData() const { return ClusterLightData; }
+	const TArray<uint32>& GetTileLightIndices() const { return TileLightIndices; }
+
 	// 통계 정보 반환
 	const FTileCullingStats& GetStats() const { return Stats; }
 
@@ -37,6 +62,47 @@ public:
 	void Release();
 
 private:
+	// 뷰 공간으로 변환한 라이트 (구 근사)
+	struct FClusterLight
+	{
+		FVector ViewCenter;
+		float Radius;
+		uint32 PackedIndex;   // 상위 16비트: 타입(0=Point, 1=Spot), 하위 16비트: 인덱스
+		int32 SliceMin;
+		int32 SliceMax;
+	};
+
+	// 한 슬라이스 안에서 라이트가 덮는 타일 사각형 (포함 범위)
+	struct FClusterLightRect
+	{
+		uint16 MinX, MaxX, MinY, MaxY;
+		uint32 PackedIndex;
+	};
+
+	// 슬라이스 하나를 맡은 Job의 작업 공간 (프레임 간 용량 유지)
+	struct FClusterSliceScratch
+	{
+		TArray<uint32> Counts;            // 타일별 라이트 수
+		TArray<uint32> Cursors;           // 타일별 쓰기 위치 (채우기 후에는 Offset + Count)
+		TArray<FClusterLightRect> Rects;
+		TArray<uint32> Indices;           // 슬라이스 로컬 압축 인덱스 목록
+		uint32 BaseOffset = 0;            // 최종 버퍼에서 이 슬라이스 인덱스 목록의 시작 위치
+		uint32 MinCount = 0;
+		uint32 MaxCount = 0;
+	};
+
+	// 라이트 하나를 뷰 공간 구로 변환하고 슬라이스 범위를 계산 (범위 밖이면 false)
+	bool BuildClusterLight(const FVector& WorldPos, float Radius, uint32 PackedIndex, const FMatrix& ViewMatrix, FClusterLight& OutLight) const;
+
+	// 슬라이스 하나의 라이트 분배 (Count → Prefix Sum → Fill)
+	void BinSlice(int32 Slice, const FMatrix& ProjMatrix, bool bOrthographic, float ViewportWidth, float ViewportHeight);
+
+	// 깊이 → 슬라이스 인덱스 (셰이더와 같은 식)
+	int32 GetSliceIndex(float ViewZ) const;
+
+	// CPU 결과를 GPU 버퍼로 (용량이 부족하면 다시 생성)
+	void UploadToGPU(const TArray<uint32>& Data);
+
 	// 타일 프러스텀 생성 (Conservative near/far 방식)
 	FFrustum CreateTileFrustum(
 		UINT TileX,
@@ -71,17 +137,31 @@ private:
 	UINT TileCountY;        // 세로 타일 개수
 	UINT TotalTileCount;    // 전체 타일 개수
 
-	// 타일당 최대 라이트 개수 (보수적으로 설정)
+	// 이전 방식의 타일당 최대 라이트 개수
 	static constexpr UINT MaxLightsPerTile = 256;
 
-	// 타일별 라이트 인덱스 저장
+	// 이전 방식 결과 (CullLightsPerTileFrustum 전용)
 	// [TileIndex * MaxLightsPerTile] 위치에 라이트 개수 저장
 	// [TileIndex * MaxLightsPerTile + 1 ~ ...] 위치에 라이트 인덱스 저장
 	TArray<uint32> TileLightIndices;
 
+	// 클러스터 결과 (GPU로 올라가는 데이터)
+	// [ClusterIndex * 2] = 인덱스 목록 시작 위치 (버퍼 전체 기준), [ClusterIndex * 2 + 1] = 라이트 개수
+	// [ClusterCount * 2 ~ ...] = 압축된 라이트 인덱스 목록
+	// ClusterIndex = (Slice * TileCountY + TileY) * TileCountX + TileX
+	TArray<uint32> ClusterLightData;
+
+	// 클러스터 컬링 작업 데이터
+	TArray<FClusterLight> ClusterLights;
+	TArray<FClusterSliceScratch> SliceScratch;
+	float SliceDepths[ClusterSliceCount + 1] = {};
+	float SliceScale;
+	float SliceBias;
+
 	// GPU 리소스
 	ID3D11Buffer* LightIndexBuffer;
 	ID3D11ShaderResourceView* LightIndexBufferSRV;
+	UINT LightIndexBufferCapacity;   // 원소(uint32) 개수
 
 	// 통계
 	FTileCullingStats Stats;
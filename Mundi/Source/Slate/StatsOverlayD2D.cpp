@@ -13,8 +13,12 @@
 #include "TileCullingStats.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "CullingStats.h"
+#include "MeshDrawStats.h"
 #include "SkinningStats.h"
+#include "SceneComponent.h"
 #include "Source/Runtime/Engine/Particle/ParticleStats.h"
+#include "Source/Runtime/Engine/Particle/ParticleEmitter.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -174,7 +178,10 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning) || !SwapChain)
+	// 패널이 꺼져 있어도 프레임 경계에서 카운터는 비운다
+	const uint32 WorldTransformRecomposes = USceneComponent::ConsumeWorldTransformRecomposeCount();
+
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning && !bShowParticle && !bShowCulling && !bShowDraw) || !SwapChain)
 	{
 		return;
 	}
@@ -289,21 +296,26 @@ void UStatsOverlayD2D::Draw()
 	{
 		const FTileCullingStats& TileStats = FTileCullingStatManager::GetInstance().GetStats();
 
+		// 이름은 가장 느린 이미터 하나만, 오버레이를 그릴 때 조회
+		const FString SlowestName = SlowestSort->Emitter ? SlowestSort->Emitter->GetName() : FString("-");
+
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nBuffer: %u KB",
+		swprintf_s(Buf, L"[Tile Culling Stats]\nClusters: %u x %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.2f / %u\nCulling Eff: %.1f%%\nCPU Cull: %.3f ms\nBuffer: %u KB",
 			TileStats.TileCountX,
 			TileStats.TileCountY,
-			TileStats.TotalTileCount,
+			TileStats.ClusterSliceCount,
+			TileStats.TotalClusterCount,
 			TileStats.TotalLights,
 			TileStats.TotalPointLights,
 			TileStats.TotalSpotLights,
-			TileStats.MinLightsPerTile,
-			TileStats.AvgLightsPerTile,
-			TileStats.MaxLightsPerTile,
+			TileStats.MinLightsPerCluster,
+			TileStats.AvgLightsPerCluster,
+			TileStats.MaxLightsPerCluster,
 			TileStats.CullingEfficiency,
+			TileStats.CullTimeMS,
 			TileStats.LightIndexBufferSizeBytes / 1024);
 
-		const float tilePanelHeight = 160.0f;
+		const float tilePanelHeight = 180.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + tilePanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushCyan);
 
@@ -334,7 +346,7 @@ void UStatsOverlayD2D::Draw()
 		const FShadowStats& ShadowStats = FShadowStatManager::GetInstance().GetStats();
 
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB",
+		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB\n\nRequests: %u (Casters/Req: %.1f)\nCache Hits: %u (%.1f%%)",
 			ShadowStats.TotalShadowCastingLights,
 			ShadowStats.ShadowCastingPointLights,
 			ShadowStats.ShadowCastingSpotLights,
@@ -346,9 +358,13 @@ void UStatsOverlayD2D::Draw()
 			ShadowStats.ShadowAtlasCubeSize,
 			ShadowStats.ShadowCubeArrayCount,
 			ShadowStats.ShadowAtlasCubeMemoryMB,
-			ShadowStats.TotalShadowMemoryMB);
+			ShadowStats.TotalShadowMemoryMB,
+			ShadowStats.ShadowRequests,
+			ShadowStats.AvgCastersPerRequest,
+			ShadowStats.ShadowCacheHits,
+			ShadowStats.ShadowCacheHitRate);
 
-		const float shadowPanelHeight = 260.0f;
+		const float shadowPanelHeight = 340.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + shadowPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushDeepPink);
 
@@ -369,14 +385,21 @@ void UStatsOverlayD2D::Draw()
 		double VertexBuffer = FScopeCycleCounter::GetTimeProfile("VertexBuffer").GetTime();
 		double StructuredBuffer = FScopeCycleCounter::GetTimeProfile("StructuredBuffer").GetTime();
 		double SkeletalAABB = FScopeCycleCounter::GetTimeProfile("SkeletalAABB").GetTime();
+		double AnimationUpdate = FScopeCycleCounter::GetTimeProfile("Animation_Update").GetTime();
 
 		const FSkinningStats& SkinningStats = FSkinningStatManager::GetInstance().GetStats();
 		FWideString AllSkinningType = UTF8ToWide(SkinningStats.SkinningType);		
-		wchar_t Buf[512];
+		const uint32* TierCounts = SkinningStats.AnimUpdateTierCounts;
+		wchar_t Buf[768];
 		swprintf_s(
 			Buf,
 			L"[Skeletal Stats]\n All Skinning Type : %s\n Total Skeletals : %u\n Total Bones : %u\n Total Vertices : %u\n"
+			L"[Anim Update Rate]\n"
+			L" Full/Half/Third/Quarter : %u/%u/%u/%u\n"
+			L" Offscreen : %u\n"
+			L" Evaluated/Skipped : %u/%u\n"
 			L"[Times]\n"
+			L" Anim Update : %.3f\n"
 			L" CPU Skinning : %.3f\n"
 			L" Vertex Buffer : %.3f\n"
 			L" GPU Draw Time : %.3f\n"
@@ -386,6 +409,14 @@ void UStatsOverlayD2D::Draw()
 			SkinningStats.TotalSkeletals,
 			SkinningStats.TotalBones,
 			SkinningStats.TotalVertices,
+			TierCounts[static_cast<int32>(EAnimUpdateRateTier::Full)],
+			TierCounts[static_cast<int32>(EAnimUpdateRateTier::Half)],
+			TierCounts[static_cast<int32>(EAnimUpdateRateTier::Third)],
+			TierCounts[static_cast<int32>(EAnimUpdateRateTier::Quarter)],
+			TierCounts[static_cast<int32>(EAnimUpdateRateTier::Offscreen)],
+			SkinningStats.AnimEvaluatedCount,
+			SkinningStats.AnimSkippedCount,
+			AnimationUpdate,
 			CPUSkinning,
 			VertexBuffer,
 			GPUSkinning,
@@ -393,7 +424,7 @@ void UStatsOverlayD2D::Draw()
 			SkeletalAABB
 		);
 
-		const float SkinningPanelHeight = 180.0f;
+		const float SkinningPanelHeight = 260.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 50.0f, NextY + SkinningPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushDeepPink);
 		NextY += SkinningPanelHeight + Space;		
@@ -407,33 +438,106 @@ void UStatsOverlayD2D::Draw()
 		double CollectBatchesTime = FScopeCycleCounter::GetTimeProfile("Particle_CollectBatches").GetTime();
 		double GPUDrawTime = FGPUProfiler::GetInstance().GetStat("Particle_Draw");
 
+		const FParticleEmitterSortStat* SlowestSort = ParticleStats.FindSlowestSort();
+		const FParticleEmitterSortStat EmptySort;
+		if (!SlowestSort)
+		{
+			SlowestSort = &EmptySort;
+		}
+
 		wchar_t Buf[512];
 		swprintf_s(
 		   Buf,
 		   L"[Particle Stats]\n"
 		   L" Active Particles : %u\n"       // uint32
 		   L" Draw Calls       : %u\n"       // uint32
+		   L" Heap Allocs      : %u\n"       // uint32 (페이로드 + Job 풀 미스)
 		   L"[Times (ms)]\n"
 		   L" Simulation (CPU) : %.3f\n"     // double (Tick)
 		   L" Collect Batches (CPU): %.3f\n"     // double (CollectBatches/Sort/Map)
-		   L" GPU Draw Time    : %.3f\n",    // double
+		   L" GPU Draw Time    : %.3f\n"     // double
+		   L"[Sort (ms)]\n"
+		   L" Total (%u emitters) : %.3f\n"
+		   L" Slowest : %hs\n"
+		   L"   %hs, %u particles : %.3f\n",
        
 		   ParticleStats.TotalActiveParticles,
 		   ParticleStats.DrawCalls,
+		   ParticleStats.HeapAllocations,
 		   SimulationTime,
 		   CollectBatchesTime,
-		   GPUDrawTime
+		   GPUDrawTime,
+		   static_cast<uint32>(ParticleStats.EmitterSorts.Num()),
+		   ParticleStats.TotalSortTimeMs,
+		   SlowestName.c_str(),
+		   GetParticleSortAlgorithmName(SlowestSort->Algorithm),
+		   SlowestSort->NumParticles,
+		   SlowestSort->SortTimeMs
 		);
 
-		constexpr float ParticlePanelHeight = 160.0f;
+		constexpr float ParticlePanelHeight = 250.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 50.0f, NextY + ParticlePanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushCyan);
 		NextY += ParticlePanelHeight + Space;		
 	}
+
+	if (bShowCulling)
+	{
+		const FCullingStats& CullStats = FCullingStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Culling Stats]\nMeshes: %u / %u (Culled: %u)\nDecals: %u / %u\nShadow Views: %u\nShadow Casters: %u drawn, %u culled\nQuery Time: %.3f ms\nWorld Transforms Recomposed: %u",
+			CullStats.VisibleMeshes,
+			CullStats.TotalMeshes,
+			CullStats.CulledMeshes,
+			CullStats.VisibleDecals,
+			CullStats.TotalDecals,
+			CullStats.ShadowViews,
+			CullStats.ShadowCastersDrawn,
+			CullStats.ShadowCastersCulled,
+			CullStats.CullingTimeMS,
+			WorldTransformRecomposes);
+
+		const float CullingPanelHeight = 145.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + CullingPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushLightGreen);
+		NextY += CullingPanelHeight + Space;
+	}
+
+	if (bShowDraw)
+	{
+		const FMeshDrawStats& DrawStats = FMeshDrawStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Draw Sort Stats]\nOpaque: %u draws, collect %.3f ms (%u chunks), sort %.3f ms\n  Instancing: %u -> %u draws (%u objs in %u), %.3f ms\n  Shader/Material/VB: %u / %u / %u\nParticle: %u draws, sort %.3f ms\n  Shader/Material/VB: %u / %u / %u",
+			DrawStats.Opaque.NumDraws,
+			DrawStats.Opaque.CollectTimeMS,
+			DrawStats.Opaque.CollectChunks,
+			DrawStats.Opaque.SortTimeMS,
+			DrawStats.Opaque.NumDraws,
+			DrawStats.Opaque.SubmittedDraws,
+			DrawStats.Opaque.InstancedObjects,
+			DrawStats.Opaque.InstancedDraws,
+			DrawStats.Opaque.MergeTimeMS,
+			DrawStats.Opaque.ShaderChanges,
+			DrawStats.Opaque.MaterialChanges,
+			DrawStats.Opaque.VertexBufferChanges,
+			DrawStats.Particle.NumDraws,
+			DrawStats.Particle.SortTimeMS,
+			DrawStats.Particle.ShaderChanges,
+			DrawStats.Particle.MaterialChanges,
+			DrawStats.Particle.VertexBufferChanges);
+
+		const float DrawPanelHeight = 130.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + DrawPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushLightGreen);
+		NextY += DrawPanelHeight + Space;
+	}
 	D2DContext->EndDraw();
 	D2DContext->SetTarget(nullptr);
 
 	FParticleStatManager::GetInstance().ResetStats();
+	FSkinningStatManager::GetInstance().ResetAnimUpdateStats();
 	FScopeCycleCounter::TimeProfileInit();
 
 	SafeRelease(TargetBmp);
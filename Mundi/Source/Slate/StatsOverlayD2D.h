@@ -20,6 +20,8 @@ public:
     void SetShowShadow(bool b) { bShowShadow = b; }
     void SetShowSkinning(bool b) { bShowSkinning = b; }
     void SetShowParticle(bool b) { bShowParticle = b; }
+    void SetShowCulling(bool b) { bShowCulling = b; }
+    void SetShowDraw(bool b) { bShowDraw = b; }
     void ToggleFPS() { bShowFPS = !bShowFPS; }
     void ToggleMemory() { bShowMemory = !bShowMemory; }
     void TogglePicking() { bShowPicking = !bShowPicking; }
@@ -29,6 +31,8 @@ public:
     void ToggleShadow() { bShowShadow = !bShowShadow; }
     void ToggleSkinning() { bShowSkinning = !bShowSkinning; }
     void ToggleParticle() { bShowParticle = !bShowParticle; }
+    void ToggleCulling() { bShowCulling = !bShowCulling; }
+    void ToggleDraw() { bShowDraw = !bShowDraw; }
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -38,6 +42,8 @@ public:
     bool IsShadowVisible() const { return bShowShadow; }
     bool IsSkinningVisible() const { return bShowSkinning; }
     bool IsParticleVisible() const { return bShowParticle; }
+    bool IsCullingVisible() const { return bShowCulling; }
+    bool IsDrawVisible() const { return bShowDraw; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -59,6 +65,8 @@ private:
     bool bShowLights = false;
     bool bShowSkinning = false;
     bool bShowParticle = false;
+    bool bShowCulling = false;
+    bool bShowDraw = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
@@ -12,6 +12,11 @@
 #include <mutex>
 
 #include "Source/Runtime/Debug/CrashHandler.h"
+#include "Source/Runtime/Core/Object/ObjectBenchmark.h"
+#include "Source/Runtime/Engine/Animation/AnimationBenchmark.h"
+#include "Source/Runtime/Engine/Particle/ParticleBenchmark.h"
+#include "Source/Runtime/Engine/Spatial/SpatialBenchmark.h"
+#include "Source/Runtime/Renderer/RendererBenchmark.h"
 
 using std::max;
 using std::min;
@@ -64,6 +69,17 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
+	HelpCommandList.Add("STAT DRAW");
+	HelpCommandList.Add("BENCH");
+	HelpCommandList.Add("BENCH PARTICLE");
+	HelpCommandList.Add("BENCH BVH");
+	HelpCommandList.Add("BENCH SHAPES");
+	HelpCommandList.Add("BENCH SKINNING");
+	HelpCommandList.Add("BENCH ANIMCOMPRESS");
+	HelpCommandList.Add("BENCH POSE");
+	HelpCommandList.Add("BENCH CAST");
+	HelpCommandList.Add("BENCH LIGHTS");
+	HelpCommandList.Add("BENCH DRAWSORT");
 	
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -337,6 +353,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT DECAL");
 		AddLog("- STAT ALL");
 		AddLog("- STAT LIGHT");
+		AddLog("- STAT CULLING");
+		AddLog("- STAT DRAW");
 		AddLog("- STAT NONE");
 	}
 	else if (Stricmp(command_line, "STAT FPS") == 0)
@@ -364,6 +382,16 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleTileCulling();
 		AddLog("STAT LIGHT TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT CULLING") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleCulling();
+		AddLog("STAT CULLING TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT DRAW") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleDraw();
+		AddLog("STAT DRAW TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT ALL") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(true);
@@ -382,6 +410,56 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowTileCulling(false);
 		AddLog("STAT: OFF");
 	}
+	else if (Stricmp(command_line, "BENCH") == 0)
+	{
+		AddLog("BENCH commands (결과는 로그로 출력):");
+		AddLog("- BENCH PARTICLE");
+		AddLog("- BENCH BVH");
+		AddLog("- BENCH SHAPES");
+		AddLog("- BENCH SKINNING");
+		AddLog("- BENCH ANIMCOMPRESS");
+		AddLog("- BENCH POSE");
+		AddLog("- BENCH CAST");
+		AddLog("- BENCH LIGHTS");
+		AddLog("- BENCH DRAWSORT");
+	}
+	else if (Stricmp(command_line, "BENCH PARTICLE") == 0)
+	{
+		FParticleBenchmark::RunLayoutBenchmark();
+	}
+	else if (Stricmp(command_line, "BENCH BVH") == 0)
+	{
+		FSpatialBenchmark::RunFrustumQueryBenchmark();
+		FSpatialBenchmark::RunIncrementalUpdateCheck();
+	}
+	else if (Stricmp(command_line, "BENCH SHAPES") == 0)
+	{
+		FSpatialBenchmark::RunShapeBroadphaseBenchmark();
+	}
+	else if (Stricmp(command_line, "BENCH SKINNING") == 0)
+	{
+		FAnimationBenchmark::RunCPUSkinningBenchmark();
+	}
+	else if (Stricmp(command_line, "BENCH ANIMCOMPRESS") == 0)
+	{
+		FAnimationBenchmark::RunCompressionBenchmark();
+	}
+	else if (Stricmp(command_line, "BENCH POSE") == 0)
+	{
+		FAnimationBenchmark::RunPoseBenchmark();
+	}
+	else if (Stricmp(command_line, "BENCH CAST") == 0)
+	{
+		FObjectBenchmark::RunCastBenchmark();
+	}
+	else if (Stricmp(command_line, "BENCH LIGHTS") == 0)
+	{
+		FRendererBenchmark::RunLightCullingBenchmark();
+	}
+	else if (Stricmp(command_line, "BENCH DRAWSORT") == 0)
+	{
+		FRendererBenchmark::RunDrawSortBenchmark();
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
@@ -1937,8 +1937,8 @@ void SSkeletalMeshViewerWindow::OnRender()
                             {
                                 if (PreviewMesh && PreviewMesh->GetAttachSocketName().ToString() == SelectedSocket.SocketName)
                                 {
-                                    // 베이스 클래스 포인터로 캐스팅해서 public OnTransformUpdated 호출
-                                    static_cast<USceneComponent*>(PreviewMesh)->OnTransformUpdated();
+                                    // 소켓 데이터만 바뀌어 포즈 리비전이 그대로이므로 직접 전파
+                                    PreviewMesh->PropagateTransformUpdate();
                                 }
                             }
                         }
@@ -1413,6 +1413,9 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				UStatsOverlayD2D::Get().SetShowLights(false);
 				UStatsOverlayD2D::Get().SetShowShadow(false);
 				UStatsOverlayD2D::Get().SetShowSkinning(false);
+				UStatsOverlayD2D::Get().SetShowParticle(false);
+				UStatsOverlayD2D::Get().SetShowCulling(false);
+				UStatsOverlayD2D::Get().SetShowDraw(false);
 			}
 
 			if (ImGui::IsItemHovered())
@@ -1522,6 +1525,26 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				ImGui::SetTooltip("파티클 통계를 표시합니다.");
 			}
 
+			bool bCullingStats = UStatsOverlayD2D::Get().IsCullingVisible();
+			if (ImGui::Checkbox(" CULLING", &bCullingStats))
+			{
+				UStatsOverlayD2D::Get().ToggleCulling();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("프러스텀 컬링 통계를 표시합니다. (보이는/컬링된 메시, 데칼, 라이트별 그림자 캐스터)");
+			}
+
+			bool bDrawStats = UStatsOverlayD2D::Get().IsDrawVisible();
+			if (ImGui::Checkbox(" DRAW", &bDrawStats))
+			{
+				UStatsOverlayD2D::Get().ToggleDraw();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("드로우 리스트 정렬 시간과 패스별 셰이더/머티리얼/버텍스 버퍼 변경 횟수를 표시합니다.");
+			}
+
 			ImGui::EndMenu();
 		}
 
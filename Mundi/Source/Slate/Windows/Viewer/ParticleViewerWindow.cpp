@@ -765,6 +765,29 @@ void SParticleViewerWindow::OnRender()
 
 					ImGui::Spacing();
 
+                    // Use SoA Layout
+                    {
+                        ImGui::Text("Use SoA Layout");
+                        if (ImGui::IsItemHovered())
+                        {
+                            ImGui::SetTooltip("시뮬레이션 메모리 레이아웃\n- SoA: 위치/속도/크기/색/수명을 SIMD로 갱신 (파티클 수가 많을 때 유리)\n- AoS: 기존 파티클 구조체 단위 갱신\nSprite/Mesh 이미터에만 적용됩니다.");
+                        }
+                        ImGui::NextColumn();
+
+						if (ImGui::Checkbox("##UseSoALayout", &RequiredModule->bUseSoALayout))
+						{
+							if (CurrentParticleSystem && PreviewComponent)
+							{
+								CurrentParticleSystem->BuildRuntimeCache();
+								PreviewComponent->ResetAndActivate();
+							}
+						}
+
+						ImGui::NextColumn();
+					}
+
+					ImGui::Spacing();
+
                     // SubUV Settings (스프라이트 시트 애니메이션)
                     {
                         ImGui::TextColored(ImVec4(0.5f, 0.8f, 1.0f, 1.0f), "SubUV (Sprite Sheet)");
@@ -2280,6 +2303,13 @@ void SParticleViewerWindow::OnRender()
                     ImGui::DragFloat("Radius Scale", &CollisionModule->RadiusScale, 0.05f, 0.01f, 10.0f, "%.2f");
                     if (ImGui::IsItemHovered()) ImGui::SetTooltip("파티클 충돌 반지름 스케일\n파티클 크기 대비 충돌 영역 크기\n1.0 = 파티클 크기와 동일");
 
+                    // 시스템 에셋 단위 값 (모든 이미터 공유)
+                    if (CurrentParticleSystem)
+                    {
+                        ImGui::DragFloat("Query Radius (System)", &CurrentParticleSystem->CollisionQueryRadius, 10.0f, 10.0f, 100000.0f, "%.0f");
+                        if (ImGui::IsItemHovered()) ImGui::SetTooltip("충돌체를 모을 반경 (컴포넌트 위치 기준)\n파티클이 도달할 수 있는 거리만큼이면 충분\nParticleSystem 에셋에 저장됨");
+                    }
+
                     ImGui::Spacing();
 
                 	// Events Section
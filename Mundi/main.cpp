@@ -19,6 +19,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 
     FCrashHandler::Init();  
 
+    // 정적 초기화로 모든 클래스가 등록된 뒤 클래스 트리 번호를 매긴다 (IsA/Cast를 정수 비교로)
+    UClass::BuildClassTree();
+
     if (!GEngine.Startup(hInstance))
         return -1;
 